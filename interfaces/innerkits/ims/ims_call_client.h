@@ -16,9 +16,15 @@
 #ifndef TELEPHONY_IMS_CALL_CLIENT_H
 #define TELEPHONY_IMS_CALL_CLIENT_H
 
+#include <atomic>
+#include <random>
+
+#include "event_handler.h"
 #include "event_runner.h"
+#include "file_descriptor_listener.h"
 #include "ims_call_interface.h"
 #include "ims_core_service_interface.h"
+#include "ims_event_channel.h"
 #include "iremote_stub.h"
 #include "ffrt.h"
 #include "singleton.h"
@@ -26,6 +32,44 @@
 
 namespace OHOS {
 namespace Telephony {
+/**
+ * @brief Connection state of the ims call service proxy.
+ *
+ * DISCONNECTED: no proxy cached, a connect attempt is allowed once the backoff deadline passed.
+ * CONNECTING: one caller is building the proxy, every other caller fails fast.
+ * CONNECTED: the cached proxy is valid and returned at once.
+ * DEAD: the ims service died or was removed, wait for it to be added again or for the backoff deadline.
+ */
+enum class ImsConnectState : int32_t {
+    DISCONNECTED = 0,
+    CONNECTING,
+    CONNECTED,
+    DEAD,
+};
+
+struct ImsConnectionStats {
+    ImsConnectState state = ImsConnectState::DISCONNECTED;
+    uint32_t connectAttempts = 0;
+    uint32_t connectFailures = 0;
+    uint32_t reconnectCount = 0;
+    uint32_t remoteDiedCount = 0;
+    int64_t lastReconnectCostMs = 0;
+    int64_t maxReconnectCostMs = 0;
+    int64_t nextRetryDelayMs = 0;
+    bool eventChannelEnabled = false;
+    uint64_t channelEventCount = 0;
+    uint64_t channelDroppedCount = 0;
+};
+
+struct ImsCapabilityPushStats {
+    uint64_t requests = 0;
+    uint64_t pushes = 0;
+    // requests whose every capability already had its state in the ims service
+    uint64_t suppressed = 0;
+    uint64_t pushedCapabilities = 0;
+    uint64_t suppressedCapabilities = 0;
+};
+
 class ImsCallClient {
     DECLARE_DELAYED_SINGLETON(ImsCallClient);
 
@@ -37,6 +81,27 @@ public:
      */
     sptr<ImsCallInterface> GetImsCallProxy();
 
+    /**
+     * @brief Get the connection state of the ims call service
+     *
+     * @return ImsConnectState
+     */
+    ImsConnectState GetConnectState();
+
+    /**
+     * @brief Get the connection state and reconnect metrics, used by dump
+     *
+     * @param stats Indicates the connection statistics output
+     */
+    void GetConnectionStats(ImsConnectionStats &stats);
+
+    /**
+     * @brief Get the counters of the ims capability updates, used by dump
+     *
+     * @param stats Indicates the capability push statistics output
+     */
+    void GetImsCapabilityPushStats(ImsCapabilityPushStats &stats);
+
     /**
      * @brief Get the remote object ptr, initiate a listener and subscribe the system ability
      */
@@ -166,6 +231,19 @@ public:
      */
     int32_t KickOutFromConference(int32_t slotId, int32_t index);
 
+    /**
+     * @brief Execute a batch of call operations in one request
+     *
+     * @param slotId Indicates the card slot index number
+     * @param operations The operation list, at most IMS_BATCH_OPERATION_MAX_SIZE items
+     * @param results Returns the result of every operation, in the order of {operations}
+     * @return Returns TELEPHONY_SUCCESS when the batch was delivered, others on failure.
+     * TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL, TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL and
+     * TELEPHONY_ERR_WRITE_DATA_FAIL mean that no operation was run.
+     */
+    int32_t ExecuteBatchRequest(
+        int32_t slotId, const std::vector<ImsBatchOperation> &operations, std::vector<int32_t> &results);
+
     /**
      * @brief IMS SendUpdateCallMediaModeRequest interface
      *
@@ -614,7 +692,8 @@ public:
     int32_t GetColp(int32_t slotId, int32_t index);
 
     /**
-     * @brief Update Ims Capabilities
+     * @brief Update Ims Capabilities, only the capabilities whose state differs from the one last accepted by
+     * the connected ims service are sent, in one call
      *
      * @param slotId Indicates the card slot index number,
      * ranging from 0 to the maximum card slot index number supported by the device.
@@ -661,24 +740,117 @@ private:
         void OnRemoveSystemAbility(int32_t systemAbilityId, const std::string &deviceId) override;
     };
 
+    class ImsServiceDeathRecipient : public IRemoteObject::DeathRecipient {
+    public:
+        explicit ImsServiceDeathRecipient(ImsCallClient &client) : client_(client) {}
+        ~ImsServiceDeathRecipient() override = default;
+        void OnRemoteDied(const wptr<IRemoteObject> &remote) override
+        {
+            client_.OnRemoteDied(remote);
+        }
+
+    private:
+        ImsCallClient &client_;
+    };
+
+    class ImsEventChannelListener : public AppExecFwk::FileDescriptorListener {
+    public:
+        explicit ImsEventChannelListener(ImsCallClient &client) : client_(client) {}
+        ~ImsEventChannelListener() override = default;
+        void OnReadable(int32_t fileDescriptor) override
+        {
+            client_.OnEventChannelReadable();
+        }
+
+    private:
+        ImsCallClient &client_;
+    };
+
     /**
      * Is Connect ImsCall Remote Object
      *
      * @return bool
      */
     bool IsConnect();
-    int32_t RegisterImsCallCallback();
+    int32_t RegisterImsCallCallback(const sptr<ImsCallInterface> &proxy);
     int32_t ReConnectService();
     void Clean();
+    bool TryEnterConnecting();
+    sptr<ImsCallInterface> ConnectService();
+    sptr<ImsCallInterface> CreateImsCallProxy();
+    void OnConnectSuccess(int64_t startTime);
+    void OnConnectFailed();
+    void MarkServiceDead();
+    void ResetBackoff();
+    void OnRemoteDied(const wptr<IRemoteObject> &remote);
+    void SetupEventChannel(const sptr<ImsCallInterface> &proxy);
+    void ReleaseEventChannel();
+    void OnEventChannelReadable();
+    int32_t DispatchChannelEvent(const sptr<ImsCallCallbackInterface> &callback, const ImsEventRecord &record);
+    void GetChangedImsCapabilities(int32_t slotId, const ImsCapabilityList &imsCapabilityList,
+        ImsCapabilityList &changedList);
+    void RecordPushedImsCapabilities(int32_t slotId, const ImsCapabilityList &pushedList);
+    void ClearPushedImsCapabilities();
+
+    struct CapabilityPushTicket {
+        uint64_t epoch = 0;
+        uint64_t sequence = 0;
+        // another push of the slot was in flight when this one started
+        bool isOverlapped = false;
+    };
+    struct CapabilityPushState {
+        uint64_t startedCount = 0;
+        uint32_t inFlightCount = 0;
+    };
+    CapabilityPushTicket StartImsCapabilityPush(int32_t slotId, const ImsCapabilityList &changedList);
+    void FinishImsCapabilityPush(int32_t slotId, const CapabilityPushTicket &ticket,
+        const ImsCapabilityList &changedList, bool isAccepted);
 
 private:
     sptr<ImsCoreServiceInterface> imsCoreServiceProxy_ = nullptr;
     sptr<ImsCallInterface> imsCallProxy_ = nullptr;
     sptr<ImsCallCallbackInterface> imsCallCallback_ = nullptr;
+    sptr<IRemoteObject::DeathRecipient> deathRecipient_ = nullptr;
+    std::atomic<ImsConnectState> connectState_ { ImsConnectState::DISCONNECTED };
+    std::atomic<int64_t> nextRetryTime_ { 0 };
+    std::atomic<int64_t> disconnectTime_ { 0 };
+    std::atomic<uint32_t> consecutiveFailures_ { 0 };
+    std::atomic<uint32_t> connectAttempts_ { 0 };
+    std::atomic<uint32_t> connectFailures_ { 0 };
+    std::atomic<uint32_t> reconnectCount_ { 0 };
+    std::atomic<uint32_t> remoteDiedCount_ { 0 };
+    std::atomic<int64_t> lastReconnectCostMs_ { 0 };
+    std::atomic<int64_t> maxReconnectCostMs_ { 0 };
+    ffrt::mutex jitterLock_ {};
+    std::minstd_rand jitterEngine_ { std::random_device {}() };
+    /**
+     * High rate video and rtt reports arrive through {eventChannel_} once the ims service accepted it,
+     * the fd listener of {eventChannelHandler_} drains the ring on its own runner.
+     */
+    std::shared_ptr<ImsEventChannel> eventChannel_ = nullptr;
+    std::shared_ptr<AppExecFwk::EventHandler> eventChannelHandler_ = nullptr;
+    std::atomic<uint64_t> channelEventCount_ { 0 };
+    ffrt::mutex channelLock_ {};
     std::map<int32_t, std::shared_ptr<AppExecFwk::EventHandler>> handlerMap_;
-    ffrt::shared_mutex clientLock_{};
+    ffrt::shared_mutex clientLock_ {};
     sptr<ISystemAbilityStatusChange> statusChangeListener_ = nullptr;
     ffrt::mutex mutexMap_{};
+    /**
+     * Guards the recorded capabilities and is not held across the ipc. A push forgets the capabilities it
+     * sends and records them once accepted, unless it overlapped another push of the slot. A new connection
+     * starts with no recorded capability.
+     */
+    ffrt::mutex capabilityLock_ {};
+    // slot to the capability type and radio tech, to the enable state accepted by the ims service
+    std::map<int32_t, std::map<std::pair<int32_t, int32_t>, bool>> pushedCapabilities_;
+    std::map<int32_t, CapabilityPushState> capabilityPushStates_;
+    // bumped on every new connection, a push started before it records nothing
+    uint64_t capabilityEpoch_ = 0;
+    std::atomic<uint64_t> capabilityRequests_ { 0 };
+    std::atomic<uint64_t> capabilityPushes_ { 0 };
+    std::atomic<uint64_t> capabilitySuppressed_ { 0 };
+    std::atomic<uint64_t> pushedCapabilityCount_ { 0 };
+    std::atomic<uint64_t> suppressedCapabilityCount_ { 0 };
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -16,6 +16,7 @@
 #ifndef TELEPHONY_IMS_CALL_INTERFACE_H
 #define TELEPHONY_IMS_CALL_INTERFACE_H
 
+#include "ashmem.h"
 #include "cellular_call_data_struct.h"
 #include "ims_call_callback_interface.h"
 #include "ims_call_types.h"
@@ -118,6 +119,19 @@ public:
      */
     virtual int32_t KickOutFromConference(int32_t slotId, int32_t index) = 0;
 
+    /**
+     * @brief Execute a batch of call operations in one request
+     *
+     * @param slotId Indicates the card slot index number
+     * @param operations The operation list, at most IMS_BATCH_OPERATION_MAX_SIZE items
+     * @param results Returns the result of every operation, in the order of {operations}
+     * @return Returns TELEPHONY_SUCCESS when the batch was delivered, others on failure. On the caller side
+     * TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL, TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL and
+     * TELEPHONY_ERR_WRITE_DATA_FAIL mean that no operation was run.
+     */
+    virtual int32_t ExecuteBatchRequest(
+        int32_t slotId, const std::vector<ImsBatchOperation> &operations, std::vector<int32_t> &results) = 0;
+
     /**
      * @brief IMS SendUpdateCallMediaModeRequest interface
      *
@@ -572,6 +586,16 @@ public:
      */
     virtual int32_t RegisterImsCallCallback(const sptr<ImsCallCallbackInterface> &callback) = 0;
 
+    /**
+     * @brief Offer the shared memory event channel, the ims service publishes the high rate events
+     * listed in ImsEventChannelType through it instead of the callback once it accepts
+     *
+     * @param ashmem Indicates the shared memory holding the ring buffer
+     * @param eventFd Indicates the eventfd rung after every published event
+     * @return Returns TELEPHONY_SUCCESS when the ims service accepts the channel, others on failure.
+     */
+    virtual int32_t RegisterImsEventChannel(const sptr<Ashmem> &ashmem, int32_t eventFd) = 0;
+
     /**
      * @brief Update Ims Capabilities
      *
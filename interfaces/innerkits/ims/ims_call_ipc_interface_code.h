@@ -38,6 +38,7 @@ enum class ImsCallInterfaceCode {
     IMS_SEND_CALL_MEDIA_MODE_RESPONSE,
     IMS_CANCEL_CALL_UPGRADE,
     IMS_REQUEST_CAMERA_CAPABILITIES,
+    IMS_BATCH_REQUEST,
 
     /****************** dtmf rtt ******************/
     IMS_START_DTMF = 5100,
@@ -96,7 +97,8 @@ enum class ImsCallInterfaceCode {
 
     /****************** callback ******************/
     IMS_CALL_REGISTER_CALLBACK = 5500,
+    IMS_CALL_REGISTER_EVENT_CHANNEL,
 };
 } // namespace Telephony
 } // namespace OHOS
-#endif // TELEPHONY_IMS_CALL_IPC_INTERFACE_CODE_H
\ No newline at end of file
+#endif // TELEPHONY_IMS_CALL_IPC_INTERFACE_CODE_H
\ No newline at end of file
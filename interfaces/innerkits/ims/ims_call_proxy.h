@@ -38,6 +38,8 @@ public:
     int32_t CombineConference(int32_t slotId) override;
     int32_t InviteToConference(int32_t slotId, const std::vector<std::string> &numberList) override;
     int32_t KickOutFromConference(int32_t slotId, int32_t index) override;
+    int32_t ExecuteBatchRequest(
+        int32_t slotId, const std::vector<ImsBatchOperation> &operations, std::vector<int32_t> &results) override;
     int32_t SendUpdateCallMediaModeRequest(const ImsCallInfo &callInfo, ImsCallType callType) override;
     int32_t SendUpdateCallMediaModeResponse(const ImsCallInfo &callInfo, ImsCallType callType) override;
     int32_t CancelCallUpgrade(int32_t slotId, int32_t callIndex) override;
@@ -93,6 +95,7 @@ public:
     int32_t GetColp(int32_t slotId, int32_t index) override;
 
     int32_t RegisterImsCallCallback(const sptr<ImsCallCallbackInterface> &callback) override;
+    int32_t RegisterImsEventChannel(const sptr<Ashmem> &ashmem, int32_t eventFd) override;
     int32_t UpdateImsCapabilities(int32_t slotId, const ImsCapabilityList &imsCapabilityList) override;
     int32_t GetUtImpuFromNetwork(int32_t slotId, std::string &impu) override;
     int32_t NotifyOperatorConfigChanged(int32_t slotId, int32_t state) override;
@@ -103,6 +106,8 @@ private:
     int32_t WriteCommonInfo(int32_t slotId, std::string funcName, MessageParcel &in, int32_t callType);
     int32_t SendRequest(MessageParcel &in, int32_t eventId);
     int32_t SendRequest(int32_t slotId, MessageParcel &in, int32_t eventId);
+    int32_t InnerSendRequest(
+        const sptr<IRemoteObject> &remote, int32_t code, MessageParcel &in, MessageParcel &out, MessageOption &option);
 
 private:
     static inline BrokerDelegator<ImsCallProxy> delegator_;
@@ -24,6 +24,7 @@
 namespace OHOS {
 namespace Telephony {
 const int32_t kMaxNumberLength = 255;
+const int32_t IMS_BATCH_OPERATION_MAX_SIZE = 32;
 const int32_t SLOT_0 = 0;
 const int32_t SLOT_1 = 1;
 
@@ -230,6 +231,43 @@ struct ImsCallInfo {
     bool isRTT = false;
 };
 
+/**
+ * @brief Indicates the operation carried by one item of a batch request.
+ */
+enum class ImsBatchOperationType : int32_t {
+    /**
+     * Indicates hang up the call described by callInfo.
+     */
+    BATCH_HANG_UP = 0,
+    /**
+     * Indicates reject the call described by callInfo, param is the ImsRejectReason.
+     */
+    BATCH_REJECT_WITH_REASON = 1,
+    /**
+     * Indicates kick out callInfo.index from the conference.
+     */
+    BATCH_KICK_OUT_FROM_CONFERENCE = 2,
+};
+
+/**
+ * @brief Indicates one item of a batch request, sent to the ims service as raw data
+ * so that a whole list of call operations takes a single ipc round trip.
+ */
+struct ImsBatchOperation {
+    /**
+     * Indicates the operation type.
+     */
+    ImsBatchOperationType type = ImsBatchOperationType::BATCH_HANG_UP;
+    /**
+     * Indicates the call the operation applies to.
+     */
+    ImsCallInfo callInfo;
+    /**
+     * Indicates the extra parameter of the operation, e.g. the reject reason.
+     */
+    int32_t param = 0;
+};
+
 /**
  * @brief Indicates the call status information.
  */
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_IMS_EVENT_CHANNEL_H
+#define TELEPHONY_IMS_EVENT_CHANNEL_H
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+#include "ashmem.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief Event types the ims service may publish through the shared memory channel.
+ *
+ * Only high rate and loss tolerant reports belong here, call control responses and call state
+ * reports always go through the binder callback.
+ */
+enum class ImsEventChannelType : int32_t {
+    PEER_DIMENSIONS_CHANGED = 0,
+    CALL_DATA_USAGE_CHANGED,
+    CAMERA_CAPABILITIES_CHANGED,
+    CALL_SESSION_EVENT_CHANGED,
+    RTT_EVENT_CHANGED,
+    EVENT_TYPE_BUTT,
+};
+
+static constexpr uint32_t IMS_EVENT_CHANNEL_MAGIC = 0x494D5345;
+static constexpr uint32_t IMS_EVENT_CHANNEL_VERSION = 1;
+static constexpr uint32_t IMS_EVENT_CHANNEL_CAPACITY = 256;
+static constexpr uint32_t IMS_EVENT_PAYLOAD_MAX_SIZE = 32;
+static constexpr size_t IMS_EVENT_CACHE_LINE_SIZE = 64;
+
+struct ImsEventRecord {
+    int32_t type = 0;
+    int32_t slotId = 0;
+    uint32_t length = 0;
+    uint8_t payload[IMS_EVENT_PAYLOAD_MAX_SIZE] = { 0 };
+};
+
+/**
+ * @brief Layout of the head of the shared memory, the records follow it.
+ *
+ * The consumer owns {readIndex}, the producer owns {writeIndex} and {droppedCount}. Both indexes
+ * only grow, the record slot is the index masked with {capacity} - 1.
+ */
+struct ImsEventRingHeader {
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t capacity = 0;
+    uint32_t recordSize = 0;
+    alignas(IMS_EVENT_CACHE_LINE_SIZE) std::atomic<uint64_t> writeIndex { 0 };
+    std::atomic<uint64_t> droppedCount { 0 };
+    alignas(IMS_EVENT_CACHE_LINE_SIZE) std::atomic<uint64_t> readIndex { 0 };
+};
+
+/**
+ * @brief Single producer single consumer ring buffer in ashmem with an eventfd doorbell.
+ *
+ * The cellular call service creates the channel and hands the ashmem and the eventfd to the ims
+ * service, which attaches to them and publishes events. A full ring drops the new event and counts it.
+ */
+class ImsEventChannel {
+public:
+    ~ImsEventChannel();
+
+    /**
+     * @brief Create the shared memory and the doorbell, used by the consumer
+     *
+     * @param capacity Indicates the record count, must be a power of two
+     * @return the channel, nullptr on failure
+     */
+    static std::shared_ptr<ImsEventChannel> Create(uint32_t capacity = IMS_EVENT_CHANNEL_CAPACITY);
+
+    /**
+     * @brief Map the shared memory received from the consumer, used by the producer
+     *
+     * @param ashmem Indicates the shared memory created by {Create}
+     * @param eventFd Indicates the doorbell, the channel takes its ownership
+     * @return the channel, nullptr when the memory layout is not accepted
+     */
+    static std::shared_ptr<ImsEventChannel> Attach(const sptr<Ashmem> &ashmem, int32_t eventFd);
+
+    sptr<Ashmem> GetAshmem() const;
+    int32_t GetEventFd() const;
+
+    /**
+     * @brief Publish one event and ring the doorbell
+     *
+     * @return Returns true on success, false when the ring is full or the payload is too large
+     */
+    bool Publish(int32_t slotId, ImsEventChannelType type, const void *data, uint32_t length);
+
+    template<typename T>
+    bool Publish(int32_t slotId, ImsEventChannelType type, const T &info)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "event payload must be trivially copyable");
+        static_assert(sizeof(T) <= IMS_EVENT_PAYLOAD_MAX_SIZE, "event payload is too large");
+        return Publish(slotId, type, &info, sizeof(T));
+    }
+
+    /**
+     * @brief Take the oldest event out of the ring
+     *
+     * @return Returns true when {record} is filled, false when the ring is empty
+     */
+    bool Consume(ImsEventRecord &record);
+
+    /**
+     * @brief Reset the doorbell, the consumer calls it before draining the ring
+     */
+    void ClearDoorbell();
+
+    uint32_t GetCapacity() const;
+    uint64_t GetDroppedCount() const;
+
+private:
+    ImsEventChannel(const sptr<Ashmem> &ashmem, int32_t eventFd, void *base, size_t mapSize);
+    static size_t GetMapSize(uint32_t capacity);
+    ImsEventRecord *GetRecord(uint64_t index) const;
+
+private:
+    sptr<Ashmem> ashmem_ = nullptr;
+    int32_t eventFd_ = -1;
+    void *base_ = nullptr;
+    size_t mapSize_ = 0;
+    ImsEventRingHeader *header_ = nullptr;
+    ImsEventRecord *records_ = nullptr;
+    uint32_t capacity_ = 0;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_IMS_EVENT_CHANNEL_H
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_DATASHARE_POOL_H
+#define TELEPHONY_CELLULAR_CALL_DATASHARE_POOL_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cellular_call_clock.h"
+#include "data_ability_observer_interface.h"
+#include "ffrt.h"
+#include "global_params_data.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * A connection nobody used for this long is released, the next query connects again.
+ */
+static constexpr int64_t DATASHARE_IDLE_TIMEOUT_MS = 30 * 1000;
+
+enum class DataShareOperation : uint32_t {
+    QUERY_ECC_LIST = 0,
+    QUERY_SETTING,
+    REGISTER_OBSERVER,
+    COUNT,
+};
+
+struct DataShareOperationStats {
+    uint64_t count = 0;
+    uint64_t failures = 0;
+    int64_t totalCostMs = 0;
+    int64_t maxCostMs = 0;
+};
+
+struct DataSharePoolStats {
+    uint64_t connects = 0;
+    uint64_t connectFailures = 0;
+    uint64_t reuses = 0;
+    uint64_t reconnects = 0;
+    uint64_t expires = 0;
+    uint32_t activeConnections = 0;
+    DataShareOperationStats operations[static_cast<uint32_t>(DataShareOperation::COUNT)];
+};
+
+/**
+ * @brief One connection to a data share provider, released when the last reference goes away.
+ *
+ * A method returns TELEPHONY_ERR_LOCAL_PTR_NULL when the provider did not answer, the pool then
+ * considers the provider dead and connects again.
+ */
+class CellularCallDataShareConnection {
+public:
+    virtual ~CellularCallDataShareConnection() = default;
+
+    /**
+     * @brief Query the ecc rows whose numeric is one of {numerics} or whose mcc is one of {mccs}
+     */
+    virtual int32_t QueryEccList(const std::string &uriString, const std::vector<std::string> &numerics,
+        const std::vector<std::string> &mccs, std::vector<EccNum> &eccVec) = 0;
+    virtual int32_t Query(const std::string &uriString, const std::string &key, std::string &value) = 0;
+    virtual int32_t RegisterObserver(const std::string &uriString,
+        const sptr<AAFwk::IDataAbilityObserver> &observer) = 0;
+};
+
+/**
+ * @brief Connections to the data share providers, shared by the queries of the same provider.
+ *
+ * A connection is created on first use and kept while it is referenced. When the last query on it ends an
+ * idle timer is armed on {CellularCallClock}, a query before it fires reuses the connection.
+ */
+class CellularCallDataSharePool : public std::enable_shared_from_this<CellularCallDataSharePool> {
+public:
+    using Connector = std::function<std::shared_ptr<CellularCallDataShareConnection>(const std::string &uri,
+        const std::string &extUri)>;
+    using Operation = std::function<int32_t(CellularCallDataShareConnection &connection)>;
+
+    explicit CellularCallDataSharePool(const Connector &connector);
+    ~CellularCallDataSharePool() = default;
+
+    /**
+     * @brief Replace the way connections are created, the current connections are dropped
+     */
+    void SetConnector(const Connector &connector);
+
+    /**
+     * @brief Run an operation on the connection of a provider
+     *
+     * @param type Indicates the operation, used for the latency statistics
+     * @param uri Indicates the uri the connection is created with
+     * @param extUri Indicates the extension uri the connection is created with
+     * @param operation Indicates the work done on the connection
+     * @return Returns the result of {operation}, TELEPHONY_ERR_LOCAL_PTR_NULL when no connection could be made
+     */
+    int32_t Execute(DataShareOperation type, const std::string &uri, const std::string &extUri,
+        const Operation &operation);
+
+    /**
+     * @brief Drop every connection, the ones still in use are released when their query ends
+     */
+    void Reset();
+
+    void GetStats(DataSharePoolStats &stats);
+
+private:
+    struct Entry {
+        std::shared_ptr<CellularCallDataShareConnection> connection = nullptr;
+        uint32_t refCount = 0;
+        // changes on every release, a stale idle timer does not expire a connection used again since
+        uint64_t generation = 0;
+        CellularCallClock::TimerId idleTimerId = 0;
+    };
+
+    std::shared_ptr<CellularCallDataShareConnection> Acquire(const std::string &key, const std::string &uri,
+        const std::string &extUri, bool &isReused);
+    void Release(const std::string &key, const std::shared_ptr<CellularCallDataShareConnection> &connection);
+    void Drop(const std::string &key, const std::shared_ptr<CellularCallDataShareConnection> &connection);
+    void OnIdleTimeout(const std::string &key, uint64_t generation);
+    void RecordOperation(DataShareOperation type, int32_t ret, int64_t costMs);
+
+private:
+    ffrt::mutex mutex_;
+    Connector connector_ = nullptr;
+    std::map<std::string, Entry> entries_;
+    uint64_t nextGeneration_ = 1;
+    DataSharePoolStats stats_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_DATASHARE_POOL_H
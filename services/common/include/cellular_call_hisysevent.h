@@ -89,6 +89,12 @@ public:
     static void WriteVoNRSwitchChangeEvent(const int32_t enable);
     static void WriteImsCallModeBehaviorEvent(
         const CallModeBehaviorType type, const CallBehaviorParameterInfo &info, const int32_t requestResult);
+    static void WriteIpcStatisticsEvent(const int32_t direction, const int64_t totalCount, const int64_t errorCount,
+        const int32_t topCode, const int64_t topCount, const int64_t maxCostUs);
+    static void WriteQueueLatencyFaultEvent(const int32_t slotId, const int32_t eventId, const int64_t waitMs,
+        const int64_t runMs, const int64_t shedCount);
+    static void WriteStartupBehaviorEvent(
+        const std::string &stage, const int64_t spendTimeMs, const std::string &phases);
 #ifdef SECURITY_GUARDE_ENABLE
     static void WriteCallTansferEvent(uint8_t state);
 #endif
@@ -29,6 +29,7 @@
 #include "system_ability_definition.h"
 #include "uri.h"
 
+#include "cellular_call_datashare_pool.h"
 #include "global_params_data.h"
 
 namespace OHOS {
@@ -38,15 +39,35 @@ class CellularCallRdbHelper : public DelayedSingleton<CellularCallRdbHelper> {
 
 public:
     int32_t QueryEccList(const std::string &numeric, std::vector<EccNum> &eccVec);
+
+    /**
+     * @brief Query the ecc rows of several PLMNs and of whole countries in one round trip
+     *
+     * @param numerics Indicates the MCC and MNC of the PLMNs
+     * @param mccs Indicates the countries whose every PLMN is wanted
+     * @param eccVec Returns the rows found, a PLMN without a row in the database has none
+     * @return Returns TELEPHONY_SUCCESS when the database answered
+     */
+    int32_t QueryEccLists(const std::vector<std::string> &numerics, const std::vector<std::string> &mccs,
+        std::vector<EccNum> &eccVec);
     void RegisterEccDataObserver(sptr<AAFwk::IDataAbilityObserver> &settingsCallback);
     int32_t Query(const std::string &uriString, const std::string &key, std::string &value);
 
+    /**
+     * @brief Replace the way the provider connections are made, nullptr restores the data share helper
+     */
+    void SetConnector(const CellularCallDataSharePool::Connector &connector);
+
+    void GetDataShareStats(DataSharePoolStats &stats);
+
 private:
-    std::shared_ptr<DataShare::DataShareHelper> CreateDataAbilityHelper(const std::string &uri,
+    static std::shared_ptr<CellularCallDataShareConnection> CreateConnection(const std::string &uri,
+        const std::string &extUri);
+    static std::shared_ptr<DataShare::DataShareHelper> CreateDataAbilityHelper(const std::string &uri,
         const std::string &extUri = "");
 
 private:
-    Uri globalEccUri_;
+    std::shared_ptr<CellularCallDataSharePool> dataSharePool_;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_datashare_pool.h"
+
+#include <algorithm>
+
+#include "telephony_errors.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+CellularCallDataSharePool::CellularCallDataSharePool(const Connector &connector) : connector_(connector) {}
+
+void CellularCallDataSharePool::SetConnector(const Connector &connector)
+{
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        connector_ = connector;
+    }
+    Reset();
+}
+
+int32_t CellularCallDataSharePool::Execute(DataShareOperation type, const std::string &uri,
+    const std::string &extUri, const Operation &operation)
+{
+    if (operation == nullptr) {
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    std::string key = uri + "|" + extUri;
+    int64_t startMs = CellularCallClock::GetInstance()->NowMs();
+    bool isReused = false;
+    std::shared_ptr<CellularCallDataShareConnection> connection = Acquire(key, uri, extUri, isReused);
+    int32_t ret = TELEPHONY_ERR_LOCAL_PTR_NULL;
+    if (connection != nullptr) {
+        ret = operation(*connection);
+        if (ret == TELEPHONY_ERR_LOCAL_PTR_NULL && isReused) {
+            // the provider went away since the connection was made, a fresh connection gets the new one
+            TELEPHONY_LOGW("provider of %{public}s does not answer, reconnect", uri.c_str());
+            Drop(key, connection);
+            connection = Acquire(key, uri, extUri, isReused);
+            if (connection != nullptr) {
+                std::lock_guard<ffrt::mutex> lock(mutex_);
+                stats_.reconnects++;
+            }
+            ret = connection == nullptr ? TELEPHONY_ERR_LOCAL_PTR_NULL : operation(*connection);
+        }
+        if (connection != nullptr) {
+            Release(key, connection);
+        }
+    }
+    RecordOperation(type, ret, CellularCallClock::GetInstance()->NowMs() - startMs);
+    return ret;
+}
+
+std::shared_ptr<CellularCallDataShareConnection> CellularCallDataSharePool::Acquire(const std::string &key,
+    const std::string &uri, const std::string &extUri, bool &isReused)
+{
+    Connector connector = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end() && it->second.connection != nullptr) {
+            Entry &entry = it->second;
+            if (entry.idleTimerId != 0) {
+                CellularCallClock::GetInstance()->Cancel(entry.idleTimerId);
+                entry.idleTimerId = 0;
+            }
+            entry.refCount++;
+            stats_.reuses++;
+            isReused = true;
+            return entry.connection;
+        }
+        connector = connector_;
+    }
+    isReused = false;
+    if (connector == nullptr) {
+        return nullptr;
+    }
+    // connecting binds the provider, it is not done under the lock
+    std::shared_ptr<CellularCallDataShareConnection> connection = connector(uri, extUri);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (connection == nullptr) {
+        stats_.connectFailures++;
+        return nullptr;
+    }
+    stats_.connects++;
+    Entry &entry = entries_[key];
+    if (entry.connection != nullptr) {
+        // another query connected meanwhile, keep a single connection per provider
+        if (entry.idleTimerId != 0) {
+            CellularCallClock::GetInstance()->Cancel(entry.idleTimerId);
+            entry.idleTimerId = 0;
+        }
+        entry.refCount++;
+        return entry.connection;
+    }
+    entry.connection = connection;
+    entry.refCount = 1;
+    entry.generation = nextGeneration_++;
+    return connection;
+}
+
+void CellularCallDataSharePool::Release(const std::string &key,
+    const std::shared_ptr<CellularCallDataShareConnection> &connection)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->second.connection != connection) {
+        // dropped while in use, the last reference releases it
+        return;
+    }
+    Entry &entry = it->second;
+    if (entry.refCount > 0) {
+        entry.refCount--;
+    }
+    if (entry.refCount > 0) {
+        return;
+    }
+    entry.generation = nextGeneration_++;
+    uint64_t generation = entry.generation;
+    std::weak_ptr<CellularCallDataSharePool> weakPool = weak_from_this();
+    entry.idleTimerId = CellularCallClock::GetInstance()->PostDelayed([weakPool, key, generation]() {
+        auto pool = weakPool.lock();
+        if (pool != nullptr) {
+            pool->OnIdleTimeout(key, generation);
+        }
+    }, DATASHARE_IDLE_TIMEOUT_MS);
+}
+
+void CellularCallDataSharePool::Drop(const std::string &key,
+    const std::shared_ptr<CellularCallDataShareConnection> &connection)
+{
+    std::shared_ptr<CellularCallDataShareConnection> dropped = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end() || it->second.connection != connection) {
+            return;
+        }
+        if (it->second.idleTimerId != 0) {
+            CellularCallClock::GetInstance()->Cancel(it->second.idleTimerId);
+        }
+        dropped = std::move(it->second.connection);
+        entries_.erase(it);
+    }
+}
+
+void CellularCallDataSharePool::OnIdleTimeout(const std::string &key, uint64_t generation)
+{
+    std::shared_ptr<CellularCallDataShareConnection> expired = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end() || it->second.generation != generation || it->second.refCount > 0) {
+            return;
+        }
+        expired = std::move(it->second.connection);
+        entries_.erase(it);
+        stats_.expires++;
+    }
+    TELEPHONY_LOGI("release idle data share connection");
+}
+
+void CellularCallDataSharePool::Reset()
+{
+    std::map<std::string, Entry> entries;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        for (const auto &it : entries_) {
+            if (it.second.idleTimerId != 0) {
+                CellularCallClock::GetInstance()->Cancel(it.second.idleTimerId);
+            }
+        }
+        entries.swap(entries_);
+    }
+}
+
+void CellularCallDataSharePool::RecordOperation(DataShareOperation type, int32_t ret, int64_t costMs)
+{
+    uint32_t index = static_cast<uint32_t>(type);
+    if (index >= static_cast<uint32_t>(DataShareOperation::COUNT)) {
+        return;
+    }
+    costMs = std::max<int64_t>(costMs, 0);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    DataShareOperationStats &stats = stats_.operations[index];
+    stats.count++;
+    if (ret != TELEPHONY_SUCCESS) {
+        stats.failures++;
+    }
+    stats.totalCostMs += costMs;
+    stats.maxCostMs = std::max(stats.maxCostMs, costMs);
+}
+
+void CellularCallDataSharePool::GetStats(DataSharePoolStats &stats)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    stats = stats_;
+    stats.activeConnections = static_cast<uint32_t>(entries_.size());
+}
+} // namespace Telephony
+} // namespace OHOS
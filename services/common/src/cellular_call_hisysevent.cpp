@@ -18,6 +18,7 @@
 #include <securec.h>
 
 #include "call_manager_errors.h"
+#include "cellular_call_clock.h"
 #include "telephony_errors.h"
 #include "telephony_log_wrapper.h"
 #ifdef SECURITY_GUARDE_ENABLE
@@ -46,6 +47,9 @@ static constexpr const char *CALL_MODE_SEND_REQUEST_EVENT = "CALL_MODE_SEND_REQU
 static constexpr const char *CALL_MODE_SEND_RESPONSE_EVENT = "CALL_MODE_SEND_RESPONSE";
 static constexpr const char *CALL_MODE_RECEIVE_RESPONSE_EVENT = "CALL_MODE_RECEIVE_RESPONSE";
 static constexpr const char *CALL_MODE_RECEIVE_REQUEST_EVENT = "CALL_MODE_RECEIVE_REQUEST";
+static constexpr const char *IPC_STATISTICS_EVENT = "CELLULAR_CALL_IPC_STATISTICS";
+static constexpr const char *QUEUE_LATENCY_EVENT = "CELLULAR_CALL_QUEUE_LATENCY";
+static constexpr const char *STARTUP_EVENT = "CELLULAR_CALL_STARTUP";
 
 // KEY
 static constexpr const char *MODULE_NAME_KEY = "MODULE";
@@ -59,6 +63,19 @@ static constexpr const char *ERROR_TYPE_KEY = "ERROR_TYPE";
 static constexpr const char *ERROR_MSG_KEY = "ERROR_MSG";
 static constexpr const char *RESTART_COUNT_KEY = "RESTART_COUNT";
 static constexpr const char *SWITCH_KEY = "SWITCH_KEY";
+static constexpr const char *IPC_DIRECTION_KEY = "IPC_DIRECTION";
+static constexpr const char *TOTAL_COUNT_KEY = "TOTAL_COUNT";
+static constexpr const char *ERROR_COUNT_KEY = "ERROR_COUNT";
+static constexpr const char *TOP_CODE_KEY = "TOP_CODE";
+static constexpr const char *TOP_COUNT_KEY = "TOP_COUNT";
+static constexpr const char *MAX_COST_KEY = "MAX_COST_US";
+static constexpr const char *EVENT_ID_KEY = "EVENT_ID";
+static constexpr const char *WAIT_TIME_KEY = "WAIT_TIME_MS";
+static constexpr const char *RUN_TIME_KEY = "RUN_TIME_MS";
+static constexpr const char *SHED_COUNT_KEY = "SHED_COUNT";
+static constexpr const char *STARTUP_STAGE_KEY = "STAGE";
+static constexpr const char *SPEND_TIME_KEY = "SPEND_TIME_MS";
+static constexpr const char *PHASES_KEY = "PHASES";
 
 // VALUE
 static constexpr const char *CELLULAR_CALL_MODULE = "CELLULAR_CALL";
@@ -198,6 +215,26 @@ void CellularCallHiSysEvent::WriteVoNRSwitchChangeEvent(const int32_t enable)
     HiWriteBehaviorEvent(VONR_SWITCH_STATE_EVENT, SWITCH_KEY, enable);
 }
 
+void CellularCallHiSysEvent::WriteIpcStatisticsEvent(const int32_t direction, const int64_t totalCount,
+    const int64_t errorCount, const int32_t topCode, const int64_t topCount, const int64_t maxCostUs)
+{
+    HiWriteBehaviorEvent(IPC_STATISTICS_EVENT, IPC_DIRECTION_KEY, direction, TOTAL_COUNT_KEY, totalCount,
+        ERROR_COUNT_KEY, errorCount, TOP_CODE_KEY, topCode, TOP_COUNT_KEY, topCount, MAX_COST_KEY, maxCostUs);
+}
+
+void CellularCallHiSysEvent::WriteQueueLatencyFaultEvent(const int32_t slotId, const int32_t eventId,
+    const int64_t waitMs, const int64_t runMs, const int64_t shedCount)
+{
+    HiWriteFaultEvent(QUEUE_LATENCY_EVENT, MODULE_NAME_KEY, CELLULAR_CALL_MODULE, SLOT_ID_KEY, slotId, EVENT_ID_KEY,
+        eventId, WAIT_TIME_KEY, waitMs, RUN_TIME_KEY, runMs, SHED_COUNT_KEY, shedCount);
+}
+
+void CellularCallHiSysEvent::WriteStartupBehaviorEvent(
+    const std::string &stage, const int64_t spendTimeMs, const std::string &phases)
+{
+    HiWriteBehaviorEvent(STARTUP_EVENT, STARTUP_STAGE_KEY, stage, SPEND_TIME_KEY, spendTimeMs, PHASES_KEY, phases);
+}
+
 void CellularCallHiSysEvent::WriteImsCallModeBehaviorEvent(
     const CallModeBehaviorType type, const CallBehaviorParameterInfo &info, const int32_t requestResult)
 {
@@ -390,21 +427,17 @@ void CellularCallHiSysEvent::GetCallParameterInfo(CallBehaviorParameterInfo &inf
 
 void CellularCallHiSysEvent::SetIncomingStartTime()
 {
-    incomingStartTime_ =
-        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
-            .count();
+    incomingStartTime_ = CellularCallClock::GetInstance()->NowMs();
 }
 
 void CellularCallHiSysEvent::JudgingIncomingTimeOut(
     const int32_t slotId, const int32_t callType, const int32_t videoState)
 {
-    int64_t incomingEndTime =
-        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
-            .count();
+    int64_t incomingEndTime = CellularCallClock::GetInstance()->NowMs();
     if ((incomingEndTime - incomingStartTime_) > NORMAL_INCOMING_TIME) {
         WriteIncomingCallFaultEvent(slotId, callType, videoState,
             static_cast<int32_t>(CallErrorCode::CALL_ERROR_INCOMING_TIME_OUT),
-            "incoming time out " + std::to_string(incomingStartTime_ - incomingEndTime));
+            "incoming time out " + std::to_string(incomingEndTime - incomingStartTime_));
     }
 }
 
@@ -25,42 +25,50 @@ static constexpr const char *GLOBAL_ECC_URI_SELECTION =
 static constexpr const char *SETTINGS_DATASHARE_URI =
     "datashare:///com.ohos.settingsdata/entry/settingsdata/SETTINGSDATA?Proxy=true";
 static constexpr const char *SETTINGS_DATASHARE_EXT_URI = "datashare:///com.ohos.settingsdata.DataAbility";
-CellularCallRdbHelper::CellularCallRdbHelper() : globalEccUri_(GLOBAL_ECC_URI_SELECTION) {}
-
-CellularCallRdbHelper::~CellularCallRdbHelper() = default;
+/**
+ * @brief Connection kept by the pool, the data share helper is released with it.
+ */
+class DataShareHelperConnection : public CellularCallDataShareConnection {
+public:
+    explicit DataShareHelperConnection(const std::shared_ptr<DataShare::DataShareHelper> &helper) : helper_(helper) {}
 
-std::shared_ptr<DataShare::DataShareHelper> CellularCallRdbHelper::CreateDataAbilityHelper(
-    const std::string &uri, const std::string &extUri)
-{
-    TELEPHONY_LOGD("Create data ability helper");
-    sptr<ISystemAbilityManager> saManager = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (saManager == nullptr) {
-        TELEPHONY_LOGE("CellularCallRdbHelper GetSystemAbilityManager failed.");
-        return nullptr;
+    ~DataShareHelperConnection() override
+    {
+        helper_->Release();
     }
-    sptr<IRemoteObject> remoteObj = saManager->GetSystemAbility(TELEPHONY_CELLULAR_CALL_SYS_ABILITY_ID);
-    if (remoteObj == nullptr) {
-        TELEPHONY_LOGE("CellularCallRdbHelper GetSystemAbility Service Failed.");
-        return nullptr;
-    }
-    return DataShare::DataShareHelper::Creator(remoteObj, uri, extUri);
-}
 
-int32_t CellularCallRdbHelper::QueryEccList(const std::string &numeric, std::vector<EccNum> &eccVec)
+    int32_t QueryEccList(const std::string &uriString, const std::vector<std::string> &numerics,
+        const std::vector<std::string> &mccs, std::vector<EccNum> &eccVec) override;
+    int32_t Query(const std::string &uriString, const std::string &key, std::string &value) override;
+    int32_t RegisterObserver(const std::string &uriString,
+        const sptr<AAFwk::IDataAbilityObserver> &observer) override;
+
+private:
+    std::shared_ptr<DataShare::DataShareHelper> helper_;
+};
+
+int32_t DataShareHelperConnection::QueryEccList(const std::string &uriString,
+    const std::vector<std::string> &numerics, const std::vector<std::string> &mccs, std::vector<EccNum> &eccVec)
 {
-    std::shared_ptr<DataShare::DataShareHelper> dataShareHelper = CreateDataAbilityHelper(GLOBAL_PARAMS_URI);
-    if (dataShareHelper == nullptr) {
-        TELEPHONY_LOGE("dataShareHelper is null");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
     std::vector<std::string> columns;
     DataShare::DataSharePredicates predicates;
-    predicates.EqualTo(EccData::NUMERIC, numeric);
-    std::shared_ptr<DataShare::DataShareResultSet> result =
-        dataShareHelper->Query(globalEccUri_, predicates, columns);
+    if (numerics.size() == 1 && mccs.empty()) {
+        predicates.EqualTo(EccData::NUMERIC, numerics[0]);
+    } else {
+        if (!numerics.empty()) {
+            predicates.In(EccData::NUMERIC, numerics);
+        }
+        if (!numerics.empty() && !mccs.empty()) {
+            predicates.Or();
+        }
+        if (!mccs.empty()) {
+            predicates.In(EccData::MCC, mccs);
+        }
+    }
+    Uri uri(uriString);
+    std::shared_ptr<DataShare::DataShareResultSet> result = helper_->Query(uri, predicates, columns);
     if (result == nullptr) {
         TELEPHONY_LOGE("CellularCallRdbHelper: query apns error");
-        dataShareHelper->Release();
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
     int rowCnt = 0;
@@ -88,60 +96,131 @@ int32_t CellularCallRdbHelper::QueryEccList(const std::string &numeric, std::vec
         eccVec.push_back(bean);
     }
     result->Close();
-    dataShareHelper->Release();
-    dataShareHelper = nullptr;
     return TELEPHONY_SUCCESS;
 }
 
-int32_t CellularCallRdbHelper::Query(const std::string &uriString, const std::string &key, std::string &value)
+int32_t DataShareHelperConnection::Query(const std::string &uriString, const std::string &key, std::string &value)
 {
-    std::shared_ptr<DataShare::DataShareHelper> settingHelper = CreateDataAbilityHelper(SETTINGS_DATASHARE_URI,
-        SETTINGS_DATASHARE_EXT_URI);
-    if (settingHelper == nullptr) {
-        TELEPHONY_LOGE("settingHelper is null");
-        return TELEPHONY_ERR_LOCAL_PTR_NULL;
-    }
- 
     std::vector<std::string> columns;
     DataShare::DataSharePredicates predicates;
     predicates.EqualTo("KEYWORD", key);
     Uri uri(uriString);
-    auto result = settingHelper->Query(uri, predicates, columns);
+    auto result = helper_->Query(uri, predicates, columns);
     if (result == nullptr) {
         TELEPHONY_LOGE("CellularCallRdbHelper: query error, result is null");
-        settingHelper->Release();
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
- 
     if (result->GoToFirstRow() != DataShare::E_OK) {
         TELEPHONY_LOGE("CellularCallRdbHelper: query error, go to first row error");
         result->Close();
-        settingHelper->Release();
         return TELEPHONY_ERR_DATABASE_READ_FAIL;
     }
- 
     int columnIndex = 0;
     result->GetColumnIndex("VALUE", columnIndex);
     result->GetString(columnIndex, value);
     result->Close();
-    settingHelper->Release();
-    TELEPHONY_LOGI("CellularCallRdbHelper: query success. value:%{public}s.", value.c_str());
     return TELEPHONY_SUCCESS;
 }
 
+int32_t DataShareHelperConnection::RegisterObserver(const std::string &uriString,
+    const sptr<AAFwk::IDataAbilityObserver> &observer)
+{
+    OHOS::Uri uri(uriString);
+    helper_->RegisterObserver(uri, observer);
+    return TELEPHONY_SUCCESS;
+}
+
+CellularCallRdbHelper::CellularCallRdbHelper()
+    : dataSharePool_(std::make_shared<CellularCallDataSharePool>(&CellularCallRdbHelper::CreateConnection))
+{}
+
+CellularCallRdbHelper::~CellularCallRdbHelper()
+{
+    dataSharePool_->Reset();
+}
+
+std::shared_ptr<DataShare::DataShareHelper> CellularCallRdbHelper::CreateDataAbilityHelper(
+    const std::string &uri, const std::string &extUri)
+{
+    TELEPHONY_LOGD("Create data ability helper");
+    sptr<ISystemAbilityManager> saManager = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    if (saManager == nullptr) {
+        TELEPHONY_LOGE("CellularCallRdbHelper GetSystemAbilityManager failed.");
+        return nullptr;
+    }
+    sptr<IRemoteObject> remoteObj = saManager->GetSystemAbility(TELEPHONY_CELLULAR_CALL_SYS_ABILITY_ID);
+    if (remoteObj == nullptr) {
+        TELEPHONY_LOGE("CellularCallRdbHelper GetSystemAbility Service Failed.");
+        return nullptr;
+    }
+    return DataShare::DataShareHelper::Creator(remoteObj, uri, extUri);
+}
+
+std::shared_ptr<CellularCallDataShareConnection> CellularCallRdbHelper::CreateConnection(const std::string &uri,
+    const std::string &extUri)
+{
+    std::shared_ptr<DataShare::DataShareHelper> helper = CreateDataAbilityHelper(uri, extUri);
+    if (helper == nullptr) {
+        TELEPHONY_LOGE("dataShareHelper is null");
+        return nullptr;
+    }
+    return std::make_shared<DataShareHelperConnection>(helper);
+}
+
+void CellularCallRdbHelper::SetConnector(const CellularCallDataSharePool::Connector &connector)
+{
+    dataSharePool_->SetConnector(connector == nullptr ? &CellularCallRdbHelper::CreateConnection : connector);
+}
+
+void CellularCallRdbHelper::GetDataShareStats(DataSharePoolStats &stats)
+{
+    dataSharePool_->GetStats(stats);
+}
+
+int32_t CellularCallRdbHelper::QueryEccList(const std::string &numeric, std::vector<EccNum> &eccVec)
+{
+    return QueryEccLists({ numeric }, {}, eccVec);
+}
+
+int32_t CellularCallRdbHelper::QueryEccLists(const std::vector<std::string> &numerics,
+    const std::vector<std::string> &mccs, std::vector<EccNum> &eccVec)
+{
+    if (numerics.empty() && mccs.empty()) {
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    size_t baseSize = eccVec.size();
+    return dataSharePool_->Execute(DataShareOperation::QUERY_ECC_LIST, GLOBAL_PARAMS_URI, "",
+        [&numerics, &mccs, &eccVec, baseSize](CellularCallDataShareConnection &connection) {
+            // a retry on a new connection does not keep the rows of the failed attempt
+            eccVec.erase(eccVec.begin() + baseSize, eccVec.end());
+            return connection.QueryEccList(GLOBAL_ECC_URI_SELECTION, numerics, mccs, eccVec);
+        });
+}
+
+int32_t CellularCallRdbHelper::Query(const std::string &uriString, const std::string &key, std::string &value)
+{
+    int32_t ret = dataSharePool_->Execute(DataShareOperation::QUERY_SETTING, SETTINGS_DATASHARE_URI,
+        SETTINGS_DATASHARE_EXT_URI, [&uriString, &key, &value](CellularCallDataShareConnection &connection) {
+            return connection.Query(uriString, key, value);
+        });
+    if (ret == TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGI("CellularCallRdbHelper: query success. value:%{public}s.", value.c_str());
+    }
+    return ret;
+}
+
 void CellularCallRdbHelper::RegisterEccDataObserver(sptr<AAFwk::IDataAbilityObserver> &settingsCallback)
 {
     if (settingsCallback == nullptr) {
         return;
     }
-    auto dataShareHelper = CreateDataAbilityHelper(GLOBAL_PARAMS_URI);
-    if (dataShareHelper == nullptr) {
-        TELEPHONY_LOGE("dataShareHelper is nullptr");
-        return;
+    int32_t ret = dataSharePool_->Execute(DataShareOperation::REGISTER_OBSERVER, GLOBAL_PARAMS_URI, "",
+        [&settingsCallback](CellularCallDataShareConnection &connection) {
+            return connection.RegisterObserver(GLOBAL_ECC_URI_SELECTION, settingsCallback);
+        });
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("register ecc data observer failed");
     }
-    OHOS::Uri uri_listen(GLOBAL_ECC_URI_SELECTION);
-    dataShareHelper->RegisterObserver(uri_listen, settingsCallback);
-    dataShareHelper->Release();
 }
 } // namespace Telephony
 } // namespace OHOS
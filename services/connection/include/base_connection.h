@@ -21,6 +21,7 @@
 #include "core_manager_inner.h"
 #include "call_manager_inner_type.h"
 #include "cellular_call_data_struct.h"
+#include "cellular_call_timer_wheel.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -119,6 +120,8 @@ private:
 
 protected:
     std::string phoneNumber_;
+    // shared by the copies of the connection, the pause is cancelled with the last of them
+    std::shared_ptr<CellularCallTimer> postDialTimer_;
 
 private:
     bool flag_ = false;
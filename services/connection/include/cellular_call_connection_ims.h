@@ -77,6 +77,16 @@ public:
      */
     int32_t RejectRequest(int32_t slotId, const std::string &phoneNum, int32_t index);
 
+    /**
+     * Reject a list of calls with batch requests, one ipc round trip for up to
+     * IMS_BATCH_OPERATION_MAX_SIZE calls
+     *
+     * @param slotId
+     * @param calls phone number and call index of every call to reject
+     * @return Error Code: Returns TELEPHONY_SUCCESS when every call was rejected, others on failure.
+     */
+    int32_t RejectAllRequest(int32_t slotId, const std::vector<std::pair<std::string, int32_t>> &calls);
+
     /**
      * HoldCall Request
      *
@@ -223,6 +233,8 @@ public:
 
 private:
     virtual int32_t ProcessPostDialCallChar(int32_t slotId, char c) override;
+    int32_t BuildImsCallInfo(int32_t slotId, const std::string &phoneNum, int32_t index, ImsCallInfo &callInfo);
+    int32_t RejectBatch(int32_t slotId, const std::vector<ImsBatchOperation> &operations);
 
 private:
     ModuleServiceUtils moduleUtils_;
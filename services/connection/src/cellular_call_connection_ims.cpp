@@ -129,19 +129,10 @@ int32_t CellularCallConnectionIMS::RejectRequest(int32_t slotId, const std::stri
     if (moduleUtils_.NeedCallImsService()) {
         TELEPHONY_LOGI("call ims service");
         ImsCallInfo rejectCallInfo;
-        if (memset_s(&rejectCallInfo, sizeof(rejectCallInfo), 0, sizeof(rejectCallInfo)) != EOK) {
-            TELEPHONY_LOGE("return, memset_s error.");
-            return TELEPHONY_ERR_MEMSET_FAIL;
-        }
-        if (static_cast<int32_t>(phoneNum.length() + 1) > kMaxNumberLength) {
-            return TELEPHONY_ERR_STRCPY_FAIL;
+        int32_t ret = BuildImsCallInfo(slotId, phoneNum, index, rejectCallInfo);
+        if (ret != TELEPHONY_SUCCESS) {
+            return ret;
         }
-        if (strcpy_s(rejectCallInfo.phoneNum, strlen(phoneNum.c_str()) + 1, phoneNum.c_str()) != EOK) {
-            TELEPHONY_LOGE("return, strcpy_s fail.");
-            return TELEPHONY_ERR_STRCPY_FAIL;
-        }
-        rejectCallInfo.slotId = slotId;
-        rejectCallInfo.index = index;
         if (DelayedSingleton<ImsCallClient>::GetInstance() == nullptr) {
             TELEPHONY_LOGE("return, ImsCallClient is nullptr.");
             return CALL_ERR_RESOURCE_UNAVAILABLE;
@@ -155,6 +146,93 @@ int32_t CellularCallConnectionIMS::RejectRequest(int32_t slotId, const std::stri
     return TELEPHONY_ERROR;
 }
 
+int32_t CellularCallConnectionIMS::RejectAllRequest(
+    int32_t slotId, const std::vector<std::pair<std::string, int32_t>> &calls)
+{
+    if (!moduleUtils_.NeedCallImsService()) {
+        TELEPHONY_LOGE("ims vendor service does not exist.");
+        return TELEPHONY_ERROR;
+    }
+    int32_t result = TELEPHONY_SUCCESS;
+    std::vector<ImsBatchOperation> operations;
+    for (const auto &call : calls) {
+        ImsBatchOperation operation;
+        operation.type = ImsBatchOperationType::BATCH_REJECT_WITH_REASON;
+        operation.param = static_cast<int32_t>(ImsRejectReason::USER_DECLINE);
+        int32_t ret = BuildImsCallInfo(slotId, call.first, call.second, operation.callInfo);
+        if (ret != TELEPHONY_SUCCESS) {
+            result = ret;
+            continue;
+        }
+        operations.push_back(operation);
+        if (static_cast<int32_t>(operations.size()) == IMS_BATCH_OPERATION_MAX_SIZE) {
+            ret = RejectBatch(slotId, operations);
+            result = (ret != TELEPHONY_SUCCESS) ? ret : result;
+            operations.clear();
+        }
+    }
+    if (!operations.empty()) {
+        int32_t ret = RejectBatch(slotId, operations);
+        result = (ret != TELEPHONY_SUCCESS) ? ret : result;
+    }
+    return result;
+}
+
+int32_t CellularCallConnectionIMS::RejectBatch(int32_t slotId, const std::vector<ImsBatchOperation> &operations)
+{
+    auto imsCallClient = DelayedSingleton<ImsCallClient>::GetInstance();
+    if (imsCallClient == nullptr) {
+        TELEPHONY_LOGE("return, ImsCallClient is nullptr.");
+        return CALL_ERR_RESOURCE_UNAVAILABLE;
+    }
+    std::vector<int32_t> results;
+    int32_t ret = imsCallClient->ExecuteBatchRequest(slotId, operations, results);
+    if (ret == TELEPHONY_SUCCESS) {
+        for (size_t i = 0; i < results.size(); i++) {
+            if (results[i] != TELEPHONY_SUCCESS) {
+                TELEPHONY_LOGE("[slot%{public}d] reject index:%{public}d fail, result:%{public}d", slotId,
+                    operations[i].callInfo.index, results[i]);
+                ret = results[i];
+            }
+        }
+        return ret;
+    }
+    // any other error may come after the service ran the batch, rejecting again would reject twice.
+    // ImsCallProxy returns the three codes below only when no operation was run.
+    if (ret != TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL && ret != TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL &&
+        ret != TELEPHONY_ERR_WRITE_DATA_FAIL) {
+        TELEPHONY_LOGE("[slot%{public}d] batch request fail:%{public}d", slotId, ret);
+        return ret;
+    }
+    // the request was not sent or the ims service does not support batch requests, one request per call
+    TELEPHONY_LOGW("[slot%{public}d] batch request not delivered:%{public}d, reject one by one", slotId, ret);
+    ret = TELEPHONY_SUCCESS;
+    for (const auto &operation : operations) {
+        int32_t result = imsCallClient->Reject(operation.callInfo);
+        ret = (result != TELEPHONY_SUCCESS) ? result : ret;
+    }
+    return ret;
+}
+
+int32_t CellularCallConnectionIMS::BuildImsCallInfo(
+    int32_t slotId, const std::string &phoneNum, int32_t index, ImsCallInfo &callInfo)
+{
+    if (memset_s(&callInfo, sizeof(callInfo), 0, sizeof(callInfo)) != EOK) {
+        TELEPHONY_LOGE("return, memset_s error.");
+        return TELEPHONY_ERR_MEMSET_FAIL;
+    }
+    if (static_cast<int32_t>(phoneNum.length() + 1) > kMaxNumberLength) {
+        return TELEPHONY_ERR_STRCPY_FAIL;
+    }
+    if (strcpy_s(callInfo.phoneNum, strlen(phoneNum.c_str()) + 1, phoneNum.c_str()) != EOK) {
+        TELEPHONY_LOGE("return, strcpy_s fail.");
+        return TELEPHONY_ERR_STRCPY_FAIL;
+    }
+    callInfo.slotId = slotId;
+    callInfo.index = index;
+    return TELEPHONY_SUCCESS;
+}
+
 int32_t CellularCallConnectionIMS::HoldCallRequest(int32_t slotId, bool isRTT)
 {
     if (moduleUtils_.NeedCallImsService()) {
@@ -364,7 +442,8 @@ int32_t CellularCallConnectionIMS::ProcessPostDialCallChar(int32_t slotId, char
         std::shared_ptr<PostDialData> postDial = std::make_shared<PostDialData>();
         postDial->callId = GetIndex();
         postDial->isIms = true;
-        handle->SendEvent(EVENT_EXECUTE_POST_DIAL, postDial, PAUSE_DELAY_TIME);
+        postDialTimer_ = std::make_shared<CellularCallTimer>(
+            handle->GetTimerWheel(), handle->SendPostDialEvent(postDial, PAUSE_DELAY_TIME));
     } else if (StandardizeUtils::IsWaitKey(c)) {
         SetPostDialCallState(PostDialCallState::POST_DIAL_CALL_DELAY);
     }
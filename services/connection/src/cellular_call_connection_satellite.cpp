@@ -173,7 +173,8 @@ int32_t CellularCallConnectionSatellite::ProcessPostDialCallChar(int32_t slotId,
         std::shared_ptr<PostDialData> postDial = std::make_shared<PostDialData>();
         postDial->callId = GetIndex();
         postDial->isIms = false;
-        cellularCallHandle->SendEvent(EVENT_EXECUTE_POST_DIAL, postDial, PAUSE_DELAY_TIME);
+        postDialTimer_ = std::make_shared<CellularCallTimer>(
+            cellularCallHandle->GetTimerWheel(), cellularCallHandle->SendPostDialEvent(postDial, PAUSE_DELAY_TIME));
     } else if (StandardizeUtils::IsWaitKey(c)) {
         SetPostDialCallState(PostDialCallState::POST_DIAL_CALL_DELAY);
     }
@@ -290,7 +290,9 @@ private:
 #ifdef BASE_POWER_IMPROVEMENT_FEATURE
     CellularCallInfo pendingEmcDialCallInfo_;
     bool isPendingEmc_ = false;
-    ffrt::task_handle waitForRadioOn_ = nullptr;
+    // drives waitForRadioOn_ while the slot has no handler and so no timer wheel yet
+    std::shared_ptr<CellularCallTimerWheel> waitForRadioOnWheel_ = nullptr;
+    CellularCallTimer waitForRadioOn_;
 #endif
 };
 } // namespace Telephony
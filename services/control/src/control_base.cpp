@@ -15,6 +15,7 @@
 
 #include "control_base.h"
 
+#include "cellular_call_clock.h"
 #include "cellular_call_config.h"
 #include "cellular_call_hisysevent.h"
 #include "cellular_call_service.h"
@@ -27,7 +28,7 @@
 
 namespace OHOS {
 namespace Telephony {
-const uint32_t WAIT_TIME_SECOND = 5;
+const int64_t WAIT_TIME_MS = 5000;
 
 int32_t ControlBase::DialPreJudgment(const CellularCallInfo &callInfo, bool isEcc)
 {
@@ -193,11 +194,12 @@ int32_t ControlBase::HandleEcc(const CellularCallInfo &callInfo, bool isEcc, boo
     }
     std::unique_lock<std::mutex> lock(mutex_);
     CellularCallConfig cellularCallConfig;
-    while (!cellularCallConfig.IsReadyToCall(callInfo.slotId)) {
-        if (cv_.wait_for(lock, std::chrono::seconds(WAIT_TIME_SECOND)) == std::cv_status::timeout) {
-            TELEPHONY_LOGE("HandleEcc network in service timeout");
-            return CALL_ERR_DIAL_FAILED;
-        }
+    int32_t slotId = callInfo.slotId;
+    bool isReadyToCall = CellularCallClock::GetInstance()->WaitFor(lock, cv_, WAIT_TIME_MS,
+        [&cellularCallConfig, slotId]() { return cellularCallConfig.IsReadyToCall(slotId); });
+    if (!isReadyToCall) {
+        TELEPHONY_LOGE("HandleEcc network in service timeout");
+        return CALL_ERR_DIAL_FAILED;
     }
 
     return TELEPHONY_SUCCESS;
@@ -17,13 +17,11 @@
 
 #include "cellular_call_hisysevent.h"
 #include "cellular_call_register.h"
+#include "cellular_call_service.h"
 #include "emergency_utils.h"
 #include "module_service_utils.h"
 #include "securec.h"
 #include "standardize_utils.h"
-#ifdef BASE_POWER_IMPROVEMENT_FEATURE
-#include "cpp/task_ext.h"
-#endif
 
 namespace OHOS {
 namespace Telephony {
@@ -153,15 +151,29 @@ int32_t IMSControl::SavePendingEmcCallInfo(const CellularCallInfo &callInfo)
         }
         isPendingEmc_ = true;
         auto weak = weak_from_this();
-        constexpr uint64_t WAIT_FOR_RADIO_ON = 10000000;
-        waitForRadioOn_ = ffrt::submit_h([weak, this]() {
+        constexpr int64_t WAIT_FOR_RADIO_ON_MS = 10000;
+        auto onTimeout = [weak, this]() {
             auto strong = weak.lock();
             if (strong != nullptr) {
                 TELEPHONY_LOGI("wait for radio on timeout");
                 strong->ReportHangUpInfo(pendingEmcDialCallInfo_.slotId);
                 isPendingEmc_ = false;
             }
-        }, {}, {}, ffrt::task_attr().delay(WAIT_FOR_RADIO_ON));
+        };
+        SkipWaitForRadioOn();
+        std::shared_ptr<CellularCallTimerWheel> timerWheel = nullptr;
+        auto handler = DelayedSingleton<CellularCallService>::GetInstance()->GetHandler(callInfo.slotId);
+        if (handler != nullptr) {
+            timerWheel = handler->GetTimerWheel();
+        } else {
+            TELEPHONY_LOGW("[slot%{public}d] handler is nullptr, wait for radio on with own wheel", callInfo.slotId);
+            if (waitForRadioOnWheel_ == nullptr) {
+                waitForRadioOnWheel_ = std::make_shared<CellularCallTimerWheel>();
+            }
+            waitForRadioOnWheel_->SetSlotId(callInfo.slotId);
+            timerWheel = waitForRadioOnWheel_;
+        }
+        waitForRadioOn_ = timerWheel->ArmScoped(onTimeout, WAIT_FOR_RADIO_ON_MS);
         return TELEPHONY_SUCCESS;
 }
 #endif
@@ -355,13 +367,13 @@ int32_t IMSControl::HangUpAllConnection(int32_t slotId)
         TELEPHONY_LOGI("connectionMap_ is empty.");
         return TELEPHONY_ERROR;
     }
+    std::vector<std::pair<std::string, int32_t>> calls;
     for (auto &it : connectionMap_) {
-        int32_t index = it.second.GetIndex();
-        std::string number = it.second.GetNumber();
-        connection.RejectRequest(slotId, number, index);
+        calls.emplace_back(it.second.GetNumber(), it.second.GetIndex());
     }
     // The AT command for hanging up all calls is the same as the AT command for rejecting calls,
-    // so the reject interface is reused.
+    // so the reject interface is reused, all calls go to the ims service in one batch request.
+    connection.RejectAllRequest(slotId, calls);
     return TELEPHONY_SUCCESS;
 }
 
@@ -821,10 +833,8 @@ void IMSControl::setPendingEmcFlag(bool flag)
 
 void IMSControl::SkipWaitForRadioOn()
 {
-    if (waitForRadioOn_ != nullptr) {
-        ffrt::skip(waitForRadioOn_);
+    if (waitForRadioOn_.Cancel()) {
         TELEPHONY_LOGI("skip wait for radio on");
-        waitForRadioOn_ = nullptr;
     }
 }
 #endif
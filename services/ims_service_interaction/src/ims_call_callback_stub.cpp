@@ -15,6 +15,8 @@
 
 #include "ims_call_callback_stub.h"
 
+#include "cellular_call_clock.h"
+#include "cellular_call_ipc_metrics.h"
 #include "cellular_call_register.h"
 #include "cellular_call_service.h"
 #include "ims_call_client.h"
@@ -178,7 +180,13 @@ int32_t ImsCallCallbackStub::OnRemoteRequest(
     if (itFunc != requestFuncMap_.end()) {
         auto requestFunc = itFunc->second;
         if (requestFunc != nullptr) {
-            return requestFunc(data, reply);
+            std::shared_ptr<CellularCallClock> clock = CellularCallClock::GetInstance();
+            int64_t startTime = clock->NowUs();
+            int32_t result = requestFunc(data, reply);
+            int64_t cost = clock->NowUs() - startTime;
+            DelayedRefSingleton<CellularCallIpcMetrics>::GetInstance().Record(
+                IpcDirection::IMS_CALLBACK_INBOUND, code, result, data.GetDataSize() + reply.GetDataSize(), cost);
+            return result;
         }
     }
     TELEPHONY_LOGI("Function not found, need check.");
@@ -1011,32 +1019,12 @@ int32_t ImsCallCallbackStub::LastCallFailReasonResponse(int32_t slotId, const Di
     std::shared_ptr<DisconnectedDetails> detailsInfo = std::make_shared<DisconnectedDetails>();
     detailsInfo->reason = details.reason;
     detailsInfo->message = details.message;
-    CellularCallConfig config;
-    auto vecReasonInfo = config.GetImsCallDisconnectResoninfoMappingConfig(slotId);
-    for (auto reasonInfo : vecReasonInfo) {
-        char *p = nullptr;
-        char *ptr = nullptr;
-        ptr = strtok_r((char *)(reasonInfo.c_str()), "|", &p);
-        if (ptr == nullptr) {
-            TELEPHONY_LOGE("strtok_r ptr is null");
-            continue;
-        }
-        int32_t tmpReason = (int32_t)std::atoi(ptr);
-        int flag = false;
-        while (tmpReason == static_cast<int32_t>(detailsInfo->reason)) {
-            ptr = strtok_r(nullptr, "|", &p);
-            if (ptr == nullptr) {
-                break;
-            }
-            if (!flag) {
-                detailsInfo->message = ptr;
-                flag = true;
-            } else {
-                detailsInfo->reason = static_cast<DisconnectedReason>(std::atoi(ptr));
-            }
-        }
-        if (flag) {
-            break;
+    // the mapping is parsed when the operator config is applied
+    DisconnectReasonMapping mapping;
+    if (CellularCallConfig::GetDisconnectReasonMapping(slotId, static_cast<int32_t>(details.reason), mapping)) {
+        detailsInfo->message = mapping.message;
+        if (mapping.hasReason) {
+            detailsInfo->reason = static_cast<DisconnectedReason>(mapping.reason);
         }
     }
     bool ret = TelEventHandler::SendTelEvent(handler, RadioEvent::RADIO_GET_CALL_FAIL_REASON, detailsInfo);
@@ -1429,7 +1417,7 @@ int32_t ImsCallCallbackStub::ReceiveUpdateImsCallRttErrResponse(
 int32_t ImsCallCallbackStub::CallSessionEventChanged(
     int32_t slotId, const ImsCallSessionEventInfo &callSessionEventInfo)
 {
-    TELEPHONY_LOGI("[slot%{public}d] entry", slotId);
+    TELEPHONY_LOGD("[slot%{public}d] entry", slotId);
     auto handler = DelayedSingleton<ImsCallClient>::GetInstance()->GetHandler(slotId);
     if (handler == nullptr) {
         TELEPHONY_LOGE("[slot%{public}d] handler is null", slotId);
@@ -1437,7 +1425,8 @@ int32_t ImsCallCallbackStub::CallSessionEventChanged(
     }
     std::shared_ptr<ImsCallSessionEventInfo> responseInfo = std::make_shared<ImsCallSessionEventInfo>();
     *responseInfo = callSessionEventInfo;
-    bool ret = TelEventHandler::SendTelEvent(handler, RadioEvent::RADIO_CALL_SESSION_EVENT_CHANGED, responseInfo);
+    bool ret = CellularCallHandler::SendTelemetryEvent(
+        handler, RadioEvent::RADIO_CALL_SESSION_EVENT_CHANGED, responseInfo->callIndex, responseInfo);
     if (!ret) {
         TELEPHONY_LOGE("[slot%{public}d] SendEvent failed!", slotId);
         return TELEPHONY_ERR_FAIL;
@@ -1448,7 +1437,7 @@ int32_t ImsCallCallbackStub::CallSessionEventChanged(
 int32_t ImsCallCallbackStub::PeerDimensionsChanged(
     int32_t slotId, const ImsCallPeerDimensionsInfo &callPeerDimensionsInfo)
 {
-    TELEPHONY_LOGI("[slot%{public}d] entry", slotId);
+    TELEPHONY_LOGD("[slot%{public}d] entry", slotId);
     auto handler = DelayedSingleton<ImsCallClient>::GetInstance()->GetHandler(slotId);
     if (handler == nullptr) {
         TELEPHONY_LOGE("[slot%{public}d] handler is null", slotId);
@@ -1456,7 +1445,8 @@ int32_t ImsCallCallbackStub::PeerDimensionsChanged(
     }
     std::shared_ptr<ImsCallPeerDimensionsInfo> responseInfo = std::make_shared<ImsCallPeerDimensionsInfo>();
     *responseInfo = callPeerDimensionsInfo;
-    bool ret = TelEventHandler::SendTelEvent(handler, RadioEvent::RADIO_CALL_PEER_DIMENSIONS_CHANGED, responseInfo);
+    bool ret = CellularCallHandler::SendTelemetryEvent(
+        handler, RadioEvent::RADIO_CALL_PEER_DIMENSIONS_CHANGED, responseInfo->callIndex, responseInfo);
     if (!ret) {
         TELEPHONY_LOGE("[slot%{public}d] SendEvent failed!", slotId);
         return TELEPHONY_ERR_FAIL;
@@ -1466,7 +1456,7 @@ int32_t ImsCallCallbackStub::PeerDimensionsChanged(
 
 int32_t ImsCallCallbackStub::CallDataUsageChanged(int32_t slotId, const ImsCallDataUsageInfo &callDataUsageInfo)
 {
-    TELEPHONY_LOGI("[slot%{public}d] entry", slotId);
+    TELEPHONY_LOGD("[slot%{public}d] entry", slotId);
     auto handler = DelayedSingleton<ImsCallClient>::GetInstance()->GetHandler(slotId);
     if (handler == nullptr) {
         TELEPHONY_LOGE("[slot%{public}d] handler is null", slotId);
@@ -1474,7 +1464,8 @@ int32_t ImsCallCallbackStub::CallDataUsageChanged(int32_t slotId, const ImsCallD
     }
     std::shared_ptr<ImsCallDataUsageInfo> responseInfo = std::make_shared<ImsCallDataUsageInfo>();
     *responseInfo = callDataUsageInfo;
-    bool ret = TelEventHandler::SendTelEvent(handler, RadioEvent::RADIO_CALL_DATA_USAGE_CHANGED, responseInfo);
+    bool ret = CellularCallHandler::SendTelemetryEvent(
+        handler, RadioEvent::RADIO_CALL_DATA_USAGE_CHANGED, responseInfo->callIndex, responseInfo);
     if (!ret) {
         TELEPHONY_LOGE("[slot%{public}d] SendEvent failed!", slotId);
         return TELEPHONY_ERR_FAIL;
@@ -1485,7 +1476,7 @@ int32_t ImsCallCallbackStub::CallDataUsageChanged(int32_t slotId, const ImsCallD
 int32_t ImsCallCallbackStub::CameraCapabilitiesChanged(
     int32_t slotId, const CameraCapabilitiesInfo &cameraCapabilitiesInfo)
 {
-    TELEPHONY_LOGI("[slot%{public}d] entry", slotId);
+    TELEPHONY_LOGD("[slot%{public}d] entry", slotId);
     auto handler = DelayedSingleton<ImsCallClient>::GetInstance()->GetHandler(slotId);
     if (handler == nullptr) {
         TELEPHONY_LOGE("[slot%{public}d] handler is null", slotId);
@@ -1493,7 +1484,8 @@ int32_t ImsCallCallbackStub::CameraCapabilitiesChanged(
     }
     std::shared_ptr<CameraCapabilitiesInfo> responseInfo = std::make_shared<CameraCapabilitiesInfo>();
     *responseInfo = cameraCapabilitiesInfo;
-    bool ret = TelEventHandler::SendTelEvent(handler, RadioEvent::RADIO_CAMERA_CAPABILITIES_CHANGED, responseInfo);
+    bool ret = CellularCallHandler::SendTelemetryEvent(
+        handler, RadioEvent::RADIO_CAMERA_CAPABILITIES_CHANGED, responseInfo->callIndex, responseInfo);
     if (!ret) {
         TELEPHONY_LOGE("[slot%{public}d] SendEvent failed!", slotId);
         return TELEPHONY_ERR_FAIL;
@@ -15,15 +15,25 @@
 
 #include "ims_call_client.h"
 
+#include <algorithm>
+#include <cinttypes>
+
+#include "cellular_call_clock.h"
 #include "cellular_call_hisysevent.h"
 #include "ims_call_callback_stub.h"
 #include "iservice_registry.h"
+#include "securec.h"
 #include "system_ability_definition.h"
 #include "telephony_errors.h"
 #include "telephony_log_wrapper.h"
 
 namespace OHOS {
 namespace Telephony {
+static constexpr int64_t RECONNECT_BACKOFF_BASE_MS = 100;
+static constexpr int64_t RECONNECT_BACKOFF_MAX_MS = 30000;
+static constexpr uint32_t RECONNECT_BACKOFF_MAX_SHIFT = 9;
+static constexpr int64_t RECONNECT_JITTER_DIVISOR = 2;
+
 ImsCallClient::ImsCallClient() = default;
 
 ImsCallClient::~ImsCallClient()
@@ -39,9 +49,7 @@ void ImsCallClient::Init()
         return;
     }
 
-    GetImsCallProxy();
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    if (imsCallProxy_ == nullptr) {
+    if (GetImsCallProxy() == nullptr) {
         TELEPHONY_LOGE("Init, get ims call proxy failed!");
     }
 
@@ -66,10 +74,13 @@ void ImsCallClient::Init()
 void ImsCallClient::UnInit()
 {
     Clean();
+    connectState_.store(ImsConnectState::DISCONNECTED, std::memory_order_release);
+    ResetBackoff();
     if (statusChangeListener_ != nullptr) {
         statusChangeListener_.clear();
         statusChangeListener_ = nullptr;
     }
+    ClearPushedImsCapabilities();
     std::lock_guard<ffrt::mutex> lock(mutexMap_);
     handlerMap_.clear();
 }
@@ -82,6 +93,71 @@ sptr<ImsCallInterface> ImsCallClient::GetImsCallProxy()
             return imsCallProxy_;
         }
     }
+    if (!TryEnterConnecting()) {
+        return nullptr;
+    }
+    return ConnectService();
+}
+
+ImsConnectState ImsCallClient::GetConnectState()
+{
+    return connectState_.load(std::memory_order_acquire);
+}
+
+void ImsCallClient::GetConnectionStats(ImsConnectionStats &stats)
+{
+    stats.state = connectState_.load(std::memory_order_acquire);
+    stats.connectAttempts = connectAttempts_.load(std::memory_order_relaxed);
+    stats.connectFailures = connectFailures_.load(std::memory_order_relaxed);
+    stats.reconnectCount = reconnectCount_.load(std::memory_order_relaxed);
+    stats.remoteDiedCount = remoteDiedCount_.load(std::memory_order_relaxed);
+    stats.lastReconnectCostMs = lastReconnectCostMs_.load(std::memory_order_relaxed);
+    stats.maxReconnectCostMs = maxReconnectCostMs_.load(std::memory_order_relaxed);
+    int64_t now = CellularCallClock::GetInstance()->NowMs();
+    stats.nextRetryDelayMs = std::max<int64_t>(nextRetryTime_.load(std::memory_order_relaxed) - now, 0);
+    stats.channelEventCount = channelEventCount_.load(std::memory_order_relaxed);
+    std::lock_guard<ffrt::mutex> lock(channelLock_);
+    stats.eventChannelEnabled = eventChannel_ != nullptr;
+    stats.channelDroppedCount = eventChannel_ == nullptr ? 0 : eventChannel_->GetDroppedCount();
+}
+
+void ImsCallClient::GetImsCapabilityPushStats(ImsCapabilityPushStats &stats)
+{
+    stats.requests = capabilityRequests_.load(std::memory_order_relaxed);
+    stats.pushes = capabilityPushes_.load(std::memory_order_relaxed);
+    stats.suppressed = capabilitySuppressed_.load(std::memory_order_relaxed);
+    stats.pushedCapabilities = pushedCapabilityCount_.load(std::memory_order_relaxed);
+    stats.suppressedCapabilities = suppressedCapabilityCount_.load(std::memory_order_relaxed);
+}
+
+bool ImsCallClient::TryEnterConnecting()
+{
+    ImsConnectState state = connectState_.load(std::memory_order_acquire);
+    if (state == ImsConnectState::CONNECTING || state == ImsConnectState::CONNECTED) {
+        return false;
+    }
+    if (CellularCallClock::GetInstance()->NowMs() < nextRetryTime_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    return connectState_.compare_exchange_strong(state, ImsConnectState::CONNECTING, std::memory_order_acq_rel);
+}
+
+sptr<ImsCallInterface> ImsCallClient::ConnectService()
+{
+    int64_t startTime = CellularCallClock::GetInstance()->NowMs();
+    connectAttempts_.fetch_add(1, std::memory_order_relaxed);
+    sptr<ImsCallInterface> proxy = CreateImsCallProxy();
+    if (proxy == nullptr) {
+        OnConnectFailed();
+        return nullptr;
+    }
+    OnConnectSuccess(startTime);
+    TELEPHONY_LOGI("GetImsCallProxy success.");
+    return proxy;
+}
+
+sptr<ImsCallInterface> ImsCallClient::CreateImsCallProxy()
+{
     auto managerPtr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
     if (managerPtr == nullptr) {
         TELEPHONY_LOGE("GetImsCallProxy return, get system ability manager error.");
@@ -92,47 +168,129 @@ sptr<ImsCallInterface> ImsCallClient::GetImsCallProxy()
         TELEPHONY_LOGE("GetImsCallProxy return, remote service not exists.");
         return nullptr;
     }
-    std::lock_guard<ffrt::shared_mutex> lock(clientLock_);
-    imsCoreServiceProxy_ = iface_cast<ImsCoreServiceInterface>(remoteObjectPtr);
-    if (imsCoreServiceProxy_ == nullptr) {
+    sptr<ImsCoreServiceInterface> imsCoreServiceProxy = iface_cast<ImsCoreServiceInterface>(remoteObjectPtr);
+    if (imsCoreServiceProxy == nullptr) {
         TELEPHONY_LOGE("GetImsCallProxy return, imsCoreServiceProxy_ is nullptr.");
         return nullptr;
     }
-    sptr<IRemoteObject> imsCallRemoteObjectPtr = imsCoreServiceProxy_->GetProxyObjectPtr(PROXY_IMS_CALL);
+    sptr<IRemoteObject> imsCallRemoteObjectPtr = imsCoreServiceProxy->GetProxyObjectPtr(PROXY_IMS_CALL);
     if (imsCallRemoteObjectPtr == nullptr) {
         TELEPHONY_LOGE("GetImsCallProxy return, ImsCallRemoteObjectPtr is nullptr.");
         return nullptr;
     }
-
-    imsCallProxy_ = iface_cast<ImsCallInterface>(imsCallRemoteObjectPtr);
-    if (imsCallProxy_ == nullptr) {
+    sptr<ImsCallInterface> imsCallProxy = iface_cast<ImsCallInterface>(imsCallRemoteObjectPtr);
+    if (imsCallProxy == nullptr) {
         TELEPHONY_LOGE("GetImsCallProxy return, iface_cast<imsCallProxy_> failed!");
         return nullptr;
     }
+    sptr<IRemoteObject::DeathRecipient> deathRecipient = new (std::nothrow) ImsServiceDeathRecipient(*this);
+    if (deathRecipient == nullptr) {
+        TELEPHONY_LOGE("GetImsCallProxy return, create death recipient failed!");
+        return nullptr;
+    }
+    if (remoteObjectPtr->IsProxyObject() && !remoteObjectPtr->AddDeathRecipient(deathRecipient)) {
+        TELEPHONY_LOGE("GetImsCallProxy return, failed to add death recipient!");
+        return nullptr;
+    }
     // register callback
-    RegisterImsCallCallback();
-    TELEPHONY_LOGI("GetImsCallProxy success.");
-    return imsCallProxy_;
+    if (RegisterImsCallCallback(imsCallProxy) == TELEPHONY_SUCCESS) {
+        SetupEventChannel(imsCallProxy);
+    }
+
+    std::lock_guard<ffrt::shared_mutex> lock(clientLock_);
+    imsCoreServiceProxy_ = imsCoreServiceProxy;
+    imsCallProxy_ = imsCallProxy;
+    deathRecipient_ = deathRecipient;
+    return imsCallProxy;
+}
+
+void ImsCallClient::OnConnectSuccess(int64_t startTime)
+{
+    int64_t now = CellularCallClock::GetInstance()->NowMs();
+    int64_t disconnectTime = disconnectTime_.exchange(0, std::memory_order_acq_rel);
+    if (disconnectTime > 0) {
+        int64_t cost = now - disconnectTime;
+        reconnectCount_.fetch_add(1, std::memory_order_relaxed);
+        lastReconnectCostMs_.store(cost, std::memory_order_relaxed);
+        if (cost > maxReconnectCostMs_.load(std::memory_order_relaxed)) {
+            maxReconnectCostMs_.store(cost, std::memory_order_relaxed);
+        }
+        TELEPHONY_LOGI("ims call service reconnected, cost %{public}" PRId64 "ms, connect %{public}" PRId64 "ms",
+            cost, now - startTime);
+    }
+    // the service behind the new proxy knows none of the capabilities sent before
+    ClearPushedImsCapabilities();
+    ResetBackoff();
+    connectState_.store(ImsConnectState::CONNECTED, std::memory_order_release);
+}
+
+void ImsCallClient::OnConnectFailed()
+{
+    connectFailures_.fetch_add(1, std::memory_order_relaxed);
+    uint32_t failures = consecutiveFailures_.fetch_add(1, std::memory_order_relaxed);
+    int64_t delay = std::min(RECONNECT_BACKOFF_BASE_MS << std::min(failures, RECONNECT_BACKOFF_MAX_SHIFT),
+        RECONNECT_BACKOFF_MAX_MS);
+    {
+        // equal jitter: wait between half and the full backoff so that callers do not retry in lockstep
+        std::lock_guard<ffrt::mutex> lock(jitterLock_);
+        std::uniform_int_distribution<int64_t> jitter(0, delay / RECONNECT_JITTER_DIVISOR);
+        delay = delay - delay / RECONNECT_JITTER_DIVISOR + jitter(jitterEngine_);
+    }
+    int64_t now = CellularCallClock::GetInstance()->NowMs();
+    nextRetryTime_.store(now + delay, std::memory_order_release);
+    if (disconnectTime_.load(std::memory_order_relaxed) == 0) {
+        disconnectTime_.store(now, std::memory_order_relaxed);
+    }
+    ImsConnectState expected = ImsConnectState::CONNECTING;
+    connectState_.compare_exchange_strong(expected, ImsConnectState::DISCONNECTED, std::memory_order_acq_rel);
+    TELEPHONY_LOGE("Connect service failed, retry after %{public}" PRId64 "ms", delay);
+}
+
+void ImsCallClient::ResetBackoff()
+{
+    consecutiveFailures_.store(0, std::memory_order_relaxed);
+    nextRetryTime_.store(0, std::memory_order_release);
+}
+
+void ImsCallClient::MarkServiceDead()
+{
+    Clean();
+    int64_t now = CellularCallClock::GetInstance()->NowMs();
+    int64_t expected = 0;
+    disconnectTime_.compare_exchange_strong(expected, now, std::memory_order_acq_rel);
+    nextRetryTime_.store(now + RECONNECT_BACKOFF_BASE_MS, std::memory_order_release);
+    connectState_.store(ImsConnectState::DEAD, std::memory_order_release);
+}
+
+void ImsCallClient::OnRemoteDied(const wptr<IRemoteObject> &remote)
+{
+    TELEPHONY_LOGE("ims service died!");
+    remoteDiedCount_.fetch_add(1, std::memory_order_relaxed);
+    MarkServiceDead();
 }
 
 bool ImsCallClient::IsConnect()
 {
     std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return (imsCallProxy_ != nullptr);
+    return imsCallProxy_ != nullptr;
 }
 
-int32_t ImsCallClient::RegisterImsCallCallback()
+int32_t ImsCallClient::RegisterImsCallCallback(const sptr<ImsCallInterface> &proxy)
 {
-    if (imsCallProxy_ == nullptr) {
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("imsCallProxy_ is null!");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    imsCallCallback_ = (std::make_unique<ImsCallCallbackStub>()).release();
-    if (imsCallCallback_ == nullptr) {
+    sptr<ImsCallCallbackInterface> callback = (std::make_unique<ImsCallCallbackStub>()).release();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("RegisterImsCallCallback return, make unique error.");
         return TELEPHONY_ERR_LOCAL_PTR_NULL;
     }
-    int32_t ret = imsCallProxy_->RegisterImsCallCallback(imsCallCallback_);
+    {
+        std::lock_guard<ffrt::shared_mutex> lock(clientLock_);
+        imsCallCallback_ = callback;
+    }
+    int32_t ret = proxy->RegisterImsCallCallback(callback);
     if (ret) {
         TELEPHONY_LOGE("RegisterImsCallCallback return, register callback error.");
         return TELEPHONY_ERR_FAIL;
@@ -141,6 +299,130 @@ int32_t ImsCallClient::RegisterImsCallCallback()
     return TELEPHONY_SUCCESS;
 }
 
+void ImsCallClient::SetupEventChannel(const sptr<ImsCallInterface> &proxy)
+{
+    std::shared_ptr<ImsEventChannel> channel = ImsEventChannel::Create();
+    if (channel == nullptr) {
+        TELEPHONY_LOGE("create event channel fail, events stay on the callback");
+        return;
+    }
+    int32_t ret = proxy->RegisterImsEventChannel(channel->GetAshmem(), channel->GetEventFd());
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGI("ims service does not accept the event channel, ret:%{public}d", ret);
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(channelLock_);
+    if (eventChannelHandler_ == nullptr) {
+        auto runner = AppExecFwk::EventRunner::Create("ImsEventChannel");
+        eventChannelHandler_ = std::make_shared<AppExecFwk::EventHandler>(runner);
+    }
+    if (eventChannel_ != nullptr) {
+        eventChannelHandler_->RemoveFileDescriptorListener(eventChannel_->GetEventFd());
+    }
+    auto listener = std::make_shared<ImsEventChannelListener>(*this);
+    if (eventChannelHandler_->AddFileDescriptorListener(channel->GetEventFd(),
+        AppExecFwk::FILE_DESCRIPTOR_INPUT_EVENT, listener, "ImsEventChannel") != ERR_OK) {
+        TELEPHONY_LOGE("listen event channel fail");
+        eventChannel_ = nullptr;
+        return;
+    }
+    eventChannel_ = channel;
+    TELEPHONY_LOGI("event channel enabled, capacity:%{public}u", channel->GetCapacity());
+}
+
+void ImsCallClient::ReleaseEventChannel()
+{
+    std::lock_guard<ffrt::mutex> lock(channelLock_);
+    if (eventChannel_ == nullptr) {
+        return;
+    }
+    if (eventChannelHandler_ != nullptr) {
+        eventChannelHandler_->RemoveFileDescriptorListener(eventChannel_->GetEventFd());
+    }
+    eventChannel_ = nullptr;
+}
+
+void ImsCallClient::OnEventChannelReadable()
+{
+    std::shared_ptr<ImsEventChannel> channel = nullptr;
+    {
+        std::lock_guard<ffrt::mutex> lock(channelLock_);
+        channel = eventChannel_;
+    }
+    sptr<ImsCallCallbackInterface> callback = nullptr;
+    {
+        std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
+        callback = imsCallCallback_;
+    }
+    if (channel == nullptr || callback == nullptr) {
+        return;
+    }
+    channel->ClearDoorbell();
+    // bounded by the capacity so a misbehaving producer can not keep the runner busy forever
+    ImsEventRecord record;
+    for (uint32_t i = 0; i < channel->GetCapacity() && channel->Consume(record); ++i) {
+        DispatchChannelEvent(callback, record);
+        channelEventCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+static bool ReadChannelPayload(const ImsEventRecord &record, T &info)
+{
+    if (record.length != sizeof(T)) {
+        TELEPHONY_LOGE("event %{public}d length %{public}u mismatch", record.type, record.length);
+        return false;
+    }
+    return memcpy_s(&info, sizeof(T), record.payload, record.length) == EOK;
+}
+
+int32_t ImsCallClient::DispatchChannelEvent(
+    const sptr<ImsCallCallbackInterface> &callback, const ImsEventRecord &record)
+{
+    switch (static_cast<ImsEventChannelType>(record.type)) {
+        case ImsEventChannelType::PEER_DIMENSIONS_CHANGED: {
+            ImsCallPeerDimensionsInfo info;
+            if (!ReadChannelPayload(record, info)) {
+                return TELEPHONY_ERR_READ_DATA_FAIL;
+            }
+            return callback->PeerDimensionsChanged(record.slotId, info);
+        }
+        case ImsEventChannelType::CALL_DATA_USAGE_CHANGED: {
+            ImsCallDataUsageInfo info;
+            if (!ReadChannelPayload(record, info)) {
+                return TELEPHONY_ERR_READ_DATA_FAIL;
+            }
+            return callback->CallDataUsageChanged(record.slotId, info);
+        }
+        case ImsEventChannelType::CAMERA_CAPABILITIES_CHANGED: {
+            CameraCapabilitiesInfo info;
+            if (!ReadChannelPayload(record, info)) {
+                return TELEPHONY_ERR_READ_DATA_FAIL;
+            }
+            return callback->CameraCapabilitiesChanged(record.slotId, info);
+        }
+        case ImsEventChannelType::CALL_SESSION_EVENT_CHANGED: {
+            ImsCallSessionEventInfo info;
+            if (!ReadChannelPayload(record, info)) {
+                return TELEPHONY_ERR_READ_DATA_FAIL;
+            }
+            return callback->CallSessionEventChanged(record.slotId, info);
+        }
+#ifdef SUPPORT_RTT_CALL
+        case ImsEventChannelType::RTT_EVENT_CHANGED: {
+            ImsCallRttEventInfo info;
+            if (!ReadChannelPayload(record, info)) {
+                return TELEPHONY_ERR_READ_DATA_FAIL;
+            }
+            return callback->ReceiveUpdateImsCallRttEvtResponse(record.slotId, info);
+        }
+#endif
+        default:
+            TELEPHONY_LOGE("[slot%{public}d] unsupported channel event %{public}d", record.slotId, record.type);
+            return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+}
+
 int32_t ImsCallClient::RegisterImsCallCallbackHandler(
     int32_t slotId, const std::shared_ptr<AppExecFwk::EventHandler> &handler)
 {
@@ -163,586 +445,600 @@ std::shared_ptr<AppExecFwk::EventHandler> ImsCallClient::GetHandler(int32_t slot
 
 int32_t ImsCallClient::Dial(const ImsCallInfo &callInfo, CLIRMode mode)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         CellularCallHiSysEvent::WriteDialCallFaultEvent(callInfo.slotId, INVALID_PARAMETER, callInfo.videoState,
             TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL, "ipc reconnect failed");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->Dial(callInfo, mode);
+    return proxy->Dial(callInfo, mode);
 }
 
 int32_t ImsCallClient::HangUp(const ImsCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         CellularCallHiSysEvent::WriteHangUpFaultEvent(
             callInfo.slotId, INVALID_PARAMETER, TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL, "HangUp ims ipc reconnect failed");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->HangUp(callInfo);
+    return proxy->HangUp(callInfo);
 }
 
 int32_t ImsCallClient::Reject(const ImsCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         CellularCallHiSysEvent::WriteHangUpFaultEvent(
             callInfo.slotId, INVALID_PARAMETER, TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL, "Reject ims ipc reconnect failed");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->RejectWithReason(callInfo, ImsRejectReason::USER_DECLINE);
+    return proxy->RejectWithReason(callInfo, ImsRejectReason::USER_DECLINE);
 }
 
 int32_t ImsCallClient::RejectWithReason(const ImsCallInfo &callInfo, const ImsRejectReason &reason)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->RejectWithReason(callInfo, reason);
+    return proxy->RejectWithReason(callInfo, reason);
 }
 
 int32_t ImsCallClient::Answer(const ImsCallInfo &callInfo)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         CellularCallHiSysEvent::WriteAnswerCallFaultEvent(callInfo.slotId, INVALID_PARAMETER, callInfo.videoState,
             TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL, "answer ims ipc reconnect failed");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->Answer(callInfo);
+    return proxy->Answer(callInfo);
 }
 
 int32_t ImsCallClient::HoldCall(int32_t slotId, int32_t callType, bool isRTT)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->HoldCall(slotId, callType, isRTT);
+    return proxy->HoldCall(slotId, callType, isRTT);
 }
 
 int32_t ImsCallClient::UnHoldCall(int32_t slotId, int32_t callType, bool isRTT)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->UnHoldCall(slotId, callType, isRTT);
+    return proxy->UnHoldCall(slotId, callType, isRTT);
 }
 
 int32_t ImsCallClient::SwitchCall(int32_t slotId, int32_t callType, bool isRTT)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SwitchCall(slotId, callType, isRTT);
+    return proxy->SwitchCall(slotId, callType, isRTT);
 }
 
 int32_t ImsCallClient::CombineConference(int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->CombineConference(slotId);
+    return proxy->CombineConference(slotId);
 }
 
 int32_t ImsCallClient::InviteToConference(int32_t slotId, const std::vector<std::string> &numberList)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->InviteToConference(slotId, numberList);
+    return proxy->InviteToConference(slotId, numberList);
 }
 
 int32_t ImsCallClient::KickOutFromConference(int32_t slotId, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->KickOutFromConference(slotId, index);
+    return proxy->KickOutFromConference(slotId, index);
+}
+
+int32_t ImsCallClient::ExecuteBatchRequest(
+    int32_t slotId, const std::vector<ImsBatchOperation> &operations, std::vector<int32_t> &results)
+{
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
+        TELEPHONY_LOGE("ipc reconnect failed!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    return proxy->ExecuteBatchRequest(slotId, operations, results);
 }
 
 int32_t ImsCallClient::SendUpdateCallMediaModeRequest(const ImsCallInfo &callInfo, ImsCallType callType)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SendUpdateCallMediaModeRequest(callInfo, callType);
+    return proxy->SendUpdateCallMediaModeRequest(callInfo, callType);
 }
 
 int32_t ImsCallClient::SendUpdateCallMediaModeResponse(const ImsCallInfo &callInfo, ImsCallType callType)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SendUpdateCallMediaModeResponse(callInfo, callType);
+    return proxy->SendUpdateCallMediaModeResponse(callInfo, callType);
 }
 
 int32_t ImsCallClient::CancelCallUpgrade(int32_t slotId, int32_t callIndex)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->CancelCallUpgrade(slotId, callIndex);
+    return proxy->CancelCallUpgrade(slotId, callIndex);
 }
 
 int32_t ImsCallClient::RequestCameraCapabilities(int32_t slotId, int32_t callIndex)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->RequestCameraCapabilities(slotId, callIndex);
+    return proxy->RequestCameraCapabilities(slotId, callIndex);
 }
 
 int32_t ImsCallClient::GetImsCallsDataRequest(int32_t slotId, int64_t lastCallsDataFlag)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetImsCallsDataRequest(slotId, lastCallsDataFlag);
+    return proxy->GetImsCallsDataRequest(slotId, lastCallsDataFlag);
 }
 
 int32_t ImsCallClient::GetLastCallFailReason(int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetLastCallFailReason(slotId);
+    return proxy->GetLastCallFailReason(slotId);
 }
 
 int32_t ImsCallClient::StartDtmf(int32_t slotId, char cDtmfCode, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->StartDtmf(slotId, cDtmfCode, index);
+    return proxy->StartDtmf(slotId, cDtmfCode, index);
 }
 
 int32_t ImsCallClient::SendDtmf(int32_t slotId, char cDtmfCode, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SendDtmf(slotId, cDtmfCode, index);
+    return proxy->SendDtmf(slotId, cDtmfCode, index);
 }
 
 int32_t ImsCallClient::StopDtmf(int32_t slotId, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->StopDtmf(slotId, index);
+    return proxy->StopDtmf(slotId, index);
 }
 
 #ifdef SUPPORT_RTT_CALL
 int32_t ImsCallClient::UpdateImsRttCallMode(int32_t slotId, int32_t callId, ImsRTTCallMode mode)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->UpdateImsRttCallMode(slotId, callId, mode);
+    return proxy->UpdateImsRttCallMode(slotId, callId, mode);
 }
 #endif
 
 int32_t ImsCallClient::SetDomainPreferenceMode(int32_t slotId, int32_t mode)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetDomainPreferenceMode(slotId, mode);
+    return proxy->SetDomainPreferenceMode(slotId, mode);
 }
 
 int32_t ImsCallClient::GetDomainPreferenceMode(int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetDomainPreferenceMode(slotId);
+    return proxy->GetDomainPreferenceMode(slotId);
 }
 
 int32_t ImsCallClient::SetCarrierVtConfig(int32_t slotId, int32_t active)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetCarrierVtConfig(slotId, active);
+    return proxy->SetCarrierVtConfig(slotId, active);
 }
 
 int32_t ImsCallClient::SetImsSwitchStatus(int32_t slotId, int32_t active)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetImsSwitchStatus(slotId, active);
+    return proxy->SetImsSwitchStatus(slotId, active);
 }
 
 int32_t ImsCallClient::GetImsSwitchStatus(int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetImsSwitchStatus(slotId);
+    return proxy->GetImsSwitchStatus(slotId);
 }
 
 int32_t ImsCallClient::SetImsConfig(ImsConfigItem item, const std::string &value)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetImsConfig(item, value);
+    return proxy->SetImsConfig(item, value);
 }
 
 int32_t ImsCallClient::SetImsConfig(ImsConfigItem item, int32_t value)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetImsConfig(item, value);
+    return proxy->SetImsConfig(item, value);
 }
 
 int32_t ImsCallClient::GetImsConfig(ImsConfigItem item)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetImsConfig(item);
+    return proxy->GetImsConfig(item);
 }
 
 int32_t ImsCallClient::SetImsFeatureValue(FeatureType type, int32_t value)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetImsFeatureValue(type, value);
+    return proxy->SetImsFeatureValue(type, value);
 }
 
 int32_t ImsCallClient::GetImsFeatureValue(FeatureType type, int32_t &value)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetImsFeatureValue(type, value);
+    return proxy->GetImsFeatureValue(type, value);
 }
 
 int32_t ImsCallClient::SetMute(int32_t slotId, int32_t mute)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetMute(slotId, mute);
+    return proxy->SetMute(slotId, mute);
 }
 
 int32_t ImsCallClient::GetMute(int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetMute(slotId);
+    return proxy->GetMute(slotId);
 }
 
 int32_t ImsCallClient::ControlCamera(int32_t slotId, int32_t callIndex, const std::string &cameraId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->ControlCamera(slotId, callIndex, cameraId);
+    return proxy->ControlCamera(slotId, callIndex, cameraId);
 }
 
 int32_t ImsCallClient::SetPreviewWindow(
     int32_t slotId, int32_t callIndex, const std::string &surfaceID, sptr<Surface> surface)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetPreviewWindow(slotId, callIndex, surfaceID, surface);
+    return proxy->SetPreviewWindow(slotId, callIndex, surfaceID, surface);
 }
 
 int32_t ImsCallClient::SetDisplayWindow(
     int32_t slotId, int32_t callIndex, const std::string &surfaceID, sptr<Surface> surface)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetDisplayWindow(slotId, callIndex, surfaceID, surface);
+    return proxy->SetDisplayWindow(slotId, callIndex, surfaceID, surface);
 }
 
 int32_t ImsCallClient::SetCameraZoom(float zoomRatio)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetCameraZoom(zoomRatio);
+    return proxy->SetCameraZoom(zoomRatio);
 }
 
 int32_t ImsCallClient::SetPausePicture(int32_t slotId, int32_t callIndex, const std::string &path)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetPausePicture(slotId, callIndex, path);
+    return proxy->SetPausePicture(slotId, callIndex, path);
 }
 
 int32_t ImsCallClient::SetDeviceDirection(int32_t slotId, int32_t callIndex, int32_t rotation)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetDeviceDirection(slotId, callIndex, rotation);
+    return proxy->SetDeviceDirection(slotId, callIndex, rotation);
 }
 
 int32_t ImsCallClient::SetClip(int32_t slotId, int32_t action, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetClip(slotId, action, index);
+    return proxy->SetClip(slotId, action, index);
 }
 
 int32_t ImsCallClient::GetClip(int32_t slotId, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetClip(slotId, index);
+    return proxy->GetClip(slotId, index);
 }
 
 int32_t ImsCallClient::SetClir(int32_t slotId, int32_t action, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetClir(slotId, action, index);
+    return proxy->SetClir(slotId, action, index);
 }
 
 int32_t ImsCallClient::GetClir(int32_t slotId, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetClir(slotId, index);
+    return proxy->GetClir(slotId, index);
 }
 
 int32_t ImsCallClient::SetCallTransfer(int32_t slotId, const CallTransferInfo &cfInfo, int32_t classType, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetCallTransfer(slotId, cfInfo, classType, index);
+    return proxy->SetCallTransfer(slotId, cfInfo, classType, index);
 }
 
 int32_t ImsCallClient::CanSetCallTransferTime(int32_t slotId, bool &result)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("[slot%{public}d] ipc reconnect failed!", slotId);
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->CanSetCallTransferTime(slotId, result);
+    return proxy->CanSetCallTransferTime(slotId, result);
 }
 
 int32_t ImsCallClient::GetCallTransfer(int32_t slotId, int32_t reason, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetCallTransfer(slotId, reason, index);
+    return proxy->GetCallTransfer(slotId, reason, index);
 }
 
 int32_t ImsCallClient::SetCallRestriction(
     int32_t slotId, const std::string &fac, int32_t mode, const std::string &pw, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetCallRestriction(slotId, fac, mode, pw, index);
+    return proxy->SetCallRestriction(slotId, fac, mode, pw, index);
 }
 
 int32_t ImsCallClient::GetCallRestriction(int32_t slotId, const std::string &fac, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetCallRestriction(slotId, fac, index);
+    return proxy->GetCallRestriction(slotId, fac, index);
 }
 
 int32_t ImsCallClient::SetCallWaiting(int32_t slotId, bool activate, int32_t classType, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetCallWaiting(slotId, activate, classType, index);
+    return proxy->SetCallWaiting(slotId, activate, classType, index);
 }
 
 int32_t ImsCallClient::SetVideoCallWaiting(int32_t slotId, bool activate)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    return imsCallProxy_->SetVideoCallWaiting(slotId, activate);
+    return proxy->SetVideoCallWaiting(slotId, activate);
 }
 
 int32_t ImsCallClient::GetCallWaiting(int32_t slotId, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetCallWaiting(slotId, index);
+    return proxy->GetCallWaiting(slotId, index);
 }
 
 int32_t ImsCallClient::SetColr(int32_t slotId, int32_t presentation, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetColr(slotId, presentation, index);
+    return proxy->SetColr(slotId, presentation, index);
 }
 
 int32_t ImsCallClient::GetColr(int32_t slotId, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetColr(slotId, index);
+    return proxy->GetColr(slotId, index);
 }
 
 int32_t ImsCallClient::SetColp(int32_t slotId, int32_t action, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->SetColp(slotId, action, index);
+    return proxy->SetColp(slotId, action, index);
 }
 
 int32_t ImsCallClient::GetColp(int32_t slotId, int32_t index)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetColp(slotId, index);
+    return proxy->GetColp(slotId, index);
 }
 
 int32_t ImsCallClient::ReConnectService()
 {
-    if (imsCallProxy_ == nullptr) {
-        TELEPHONY_LOGI("try to reconnect ims call service now...");
-        GetImsCallProxy();
-        if (imsCallProxy_ == nullptr) {
-            TELEPHONY_LOGE("Connect service failed");
-            return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
-        }
+    if (GetImsCallProxy() == nullptr) {
+        TELEPHONY_LOGE("Connect service failed, state:%{public}d", static_cast<int32_t>(GetConnectState()));
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
     return TELEPHONY_SUCCESS;
 }
 
 void ImsCallClient::Clean()
 {
+    ReleaseEventChannel();
     std::lock_guard<ffrt::shared_mutex> lock(clientLock_);
     if (imsCoreServiceProxy_ != nullptr) {
+        sptr<IRemoteObject> remote = imsCoreServiceProxy_->AsObject();
+        if (remote != nullptr && deathRecipient_ != nullptr) {
+            remote->RemoveDeathRecipient(deathRecipient_);
+        }
         imsCoreServiceProxy_.clear();
         imsCoreServiceProxy_ = nullptr;
     }
+    deathRecipient_ = nullptr;
     if (imsCallProxy_ != nullptr) {
         imsCallProxy_.clear();
         imsCallProxy_ = nullptr;
@@ -768,7 +1064,8 @@ void ImsCallClient::SystemAbilityListener::OnAddSystemAbility(int32_t systemAbil
         return;
     }
 
-    imsCallClient->Clean();
+    // the service is back, connect at once instead of waiting for the backoff deadline
+    imsCallClient->ResetBackoff();
     int32_t res = imsCallClient->ReConnectService();
     if (res != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("SA:%{public}d reconnect service failed!", systemAbilityId);
@@ -786,47 +1083,136 @@ void ImsCallClient::SystemAbilityListener::OnRemoveSystemAbility(int32_t systemA
         return;
     }
 
-    imsCallClient->Clean();
+    imsCallClient->MarkServiceDead();
 }
 
 int32_t ImsCallClient::UpdateImsCapabilities(int32_t slotId, const ImsCapabilityList &imsCapabilityList)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->UpdateImsCapabilities(slotId, imsCapabilityList);
+    capabilityRequests_.fetch_add(1, std::memory_order_relaxed);
+    ImsCapabilityList changedList;
+    CapabilityPushTicket ticket;
+    {
+        std::lock_guard<ffrt::mutex> lock(capabilityLock_);
+        GetChangedImsCapabilities(slotId, imsCapabilityList, changedList);
+        suppressedCapabilityCount_.fetch_add(
+            imsCapabilityList.imsCapabilities.size() - changedList.imsCapabilities.size(), std::memory_order_relaxed);
+        if (changedList.imsCapabilities.empty()) {
+            capabilitySuppressed_.fetch_add(1, std::memory_order_relaxed);
+            TELEPHONY_LOGI("[slot%{public}d] ims capabilities are not changed", slotId);
+            return TELEPHONY_SUCCESS;
+        }
+        ticket = StartImsCapabilityPush(slotId, changedList);
+    }
+    int32_t ret = proxy->UpdateImsCapabilities(slotId, changedList);
+    if (ret == TELEPHONY_SUCCESS) {
+        capabilityPushes_.fetch_add(1, std::memory_order_relaxed);
+        pushedCapabilityCount_.fetch_add(changedList.imsCapabilities.size(), std::memory_order_relaxed);
+    }
+    std::lock_guard<ffrt::mutex> lock(capabilityLock_);
+    FinishImsCapabilityPush(slotId, ticket, changedList, ret == TELEPHONY_SUCCESS);
+    return ret;
+}
+
+static std::pair<int32_t, int32_t> GetImsCapabilityKey(const ImsCapability &capability)
+{
+    return std::make_pair(
+        static_cast<int32_t>(capability.imsCapabilityType), static_cast<int32_t>(capability.imsRadioTech));
+}
+
+void ImsCallClient::GetChangedImsCapabilities(int32_t slotId, const ImsCapabilityList &imsCapabilityList,
+    ImsCapabilityList &changedList)
+{
+    changedList.imsCapabilities.clear();
+    const auto &pushed = pushedCapabilities_[slotId];
+    for (const auto &capability : imsCapabilityList.imsCapabilities) {
+        auto it = pushed.find(GetImsCapabilityKey(capability));
+        if (it == pushed.end() || it->second != capability.enable) {
+            changedList.imsCapabilities.push_back(capability);
+        }
+    }
+}
+
+void ImsCallClient::RecordPushedImsCapabilities(int32_t slotId, const ImsCapabilityList &pushedList)
+{
+    auto &pushed = pushedCapabilities_[slotId];
+    for (const auto &capability : pushedList.imsCapabilities) {
+        pushed[GetImsCapabilityKey(capability)] = capability.enable;
+    }
+}
+
+ImsCallClient::CapabilityPushTicket ImsCallClient::StartImsCapabilityPush(int32_t slotId,
+    const ImsCapabilityList &changedList)
+{
+    // the state of a capability is unknown until the service answered, so a request meanwhile sends it again
+    auto &pushed = pushedCapabilities_[slotId];
+    for (const auto &capability : changedList.imsCapabilities) {
+        pushed.erase(GetImsCapabilityKey(capability));
+    }
+    CapabilityPushState &state = capabilityPushStates_[slotId];
+    CapabilityPushTicket ticket;
+    ticket.epoch = capabilityEpoch_;
+    ticket.sequence = ++state.startedCount;
+    ticket.isOverlapped = state.inFlightCount > 0;
+    state.inFlightCount++;
+    return ticket;
+}
+
+void ImsCallClient::FinishImsCapabilityPush(int32_t slotId, const CapabilityPushTicket &ticket,
+    const ImsCapabilityList &changedList, bool isAccepted)
+{
+    if (ticket.epoch != capabilityEpoch_) {
+        // the service reconnected during the push, the new one knows none of the capabilities
+        return;
+    }
+    CapabilityPushState &state = capabilityPushStates_[slotId];
+    state.inFlightCount--;
+    // the service may have seen overlapping pushes of the slot in any order, so none of them is recorded
+    if (isAccepted && !ticket.isOverlapped && ticket.sequence == state.startedCount) {
+        RecordPushedImsCapabilities(slotId, changedList);
+    }
+}
+
+void ImsCallClient::ClearPushedImsCapabilities()
+{
+    std::lock_guard<ffrt::mutex> lock(capabilityLock_);
+    pushedCapabilities_.clear();
+    capabilityPushStates_.clear();
+    capabilityEpoch_++;
 }
 
 int32_t ImsCallClient::GetUtImpuFromNetwork(int32_t slotId, std::string &impu)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("[slot%{public}d]ipc reconnect failed!", slotId);
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetUtImpuFromNetwork(slotId, impu);
+    return proxy->GetUtImpuFromNetwork(slotId, impu);
 }
 
 int32_t ImsCallClient::NotifyOperatorConfigChanged(int32_t slotId, int32_t state)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("[slot%{public}d]ipc reconnect failed!", slotId);
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->NotifyOperatorConfigChanged(slotId, state);
+    return proxy->NotifyOperatorConfigChanged(slotId, state);
 }
 
 int32_t ImsCallClient::GetImsCapabilities(int32_t slotId)
 {
-    if (ReConnectService() != TELEPHONY_SUCCESS) {
+    sptr<ImsCallInterface> proxy = GetImsCallProxy();
+    if (proxy == nullptr) {
         TELEPHONY_LOGE("ipc reconnect failed!");
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
-    std::shared_lock<ffrt::shared_mutex> lock(clientLock_);
-    return imsCallProxy_->GetImsCapabilities(slotId);
+    return proxy->GetImsCapabilities(slotId);
 }
 } // namespace Telephony
 } // namespace OHOS
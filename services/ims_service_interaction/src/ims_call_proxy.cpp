@@ -14,7 +14,10 @@
 
 #include "ims_call_proxy.h"
 
+#include "cellular_call_clock.h"
 #include "cellular_call_hisysevent.h"
+#include "cellular_call_ipc_metrics.h"
+#include "ipc_types.h"
 #include "message_option.h"
 #include "message_parcel.h"
 #include "telephony_errors.h"
@@ -51,7 +54,7 @@ int32_t ImsCallProxy::Dial(const ImsCallInfo &callInfo, CLIRMode mode)
     }
     MessageParcel out;
     MessageOption option;
-    int32_t error = remote->SendRequest(static_cast<int32_t>(ImsCallInterfaceCode::IMS_DIAL), in, out, option);
+    int32_t error = InnerSendRequest(remote, static_cast<int32_t>(ImsCallInterfaceCode::IMS_DIAL), in, out, option);
     if (error == ERR_NONE) {
         return out.ReadInt32();
     }
@@ -83,7 +86,7 @@ int32_t ImsCallProxy::HangUp(const ImsCallInfo &callInfo)
     }
     MessageParcel out;
     MessageOption option;
-    int32_t error = remote->SendRequest(static_cast<int32_t>(ImsCallInterfaceCode::IMS_HANG_UP), in, out, option);
+    int32_t error = InnerSendRequest(remote, static_cast<int32_t>(ImsCallInterfaceCode::IMS_HANG_UP), in, out, option);
     if (error == ERR_NONE) {
         return out.ReadInt32();
     }
@@ -119,7 +122,7 @@ int32_t ImsCallProxy::RejectWithReason(const ImsCallInfo &callInfo, const ImsRej
     }
     MessageParcel out;
     MessageOption option;
-    int32_t error = remote->SendRequest(static_cast<int32_t>(ImsCallInterfaceCode::IMS_REJECT_WITH_REASON), in,
+    int32_t error = InnerSendRequest(remote, static_cast<int32_t>(ImsCallInterfaceCode::IMS_REJECT_WITH_REASON), in,
         out, option);
     if (error == ERR_NONE) {
         return out.ReadInt32();
@@ -152,7 +155,7 @@ int32_t ImsCallProxy::Answer(const ImsCallInfo &callInfo)
     }
     MessageParcel out;
     MessageOption option;
-    int32_t error = remote->SendRequest(static_cast<int32_t>(ImsCallInterfaceCode::IMS_ANSWER), in, out, option);
+    int32_t error = InnerSendRequest(remote, static_cast<int32_t>(ImsCallInterfaceCode::IMS_ANSWER), in, out, option);
     if (error == ERR_NONE) {
         return out.ReadInt32();
     }
@@ -245,6 +248,63 @@ int32_t ImsCallProxy::KickOutFromConference(int32_t slotId, int32_t index)
     return SendRequest(slotId, in, static_cast<int32_t>(ImsCallInterfaceCode::IMS_KICK_OUT_CONFERENCE));
 }
 
+int32_t ImsCallProxy::ExecuteBatchRequest(
+    int32_t slotId, const std::vector<ImsBatchOperation> &operations, std::vector<int32_t> &results)
+{
+    int32_t size = static_cast<int32_t>(operations.size());
+    if (size == 0 || size > IMS_BATCH_OPERATION_MAX_SIZE) {
+        TELEPHONY_LOGE("[slot%{public}d]Invalid batch size:%{public}d", slotId, size);
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    MessageParcel in;
+    int32_t ret = WriteCommonInfo(slotId, __FUNCTION__, in);
+    if (ret != TELEPHONY_SUCCESS) {
+        return ret;
+    }
+    if (!in.WriteInt32(size)) {
+        TELEPHONY_LOGE("[slot%{public}d]Write size fail!", slotId);
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    if (!in.WriteRawData((const void *)operations.data(), sizeof(ImsBatchOperation) * operations.size())) {
+        TELEPHONY_LOGE("[slot%{public}d]Write operations fail!", slotId);
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    sptr<IRemoteObject> remote = Remote();
+    if (remote == nullptr) {
+        TELEPHONY_LOGE("[slot%{public}d]Remote is null", slotId);
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    MessageParcel out;
+    MessageOption option;
+    int32_t error =
+        InnerSendRequest(remote, static_cast<int32_t>(ImsCallInterfaceCode::IMS_BATCH_REQUEST), in, out, option);
+    if (error == IPC_STUB_UNKNOW_TRANS_ERR) {
+        // an ims service without batch support refuses the code before running any operation
+        TELEPHONY_LOGW("[slot%{public}d]batch request not supported", slotId);
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    if (error != ERR_NONE) {
+        // the service may have run the operations before the transaction failed
+        TELEPHONY_LOGE("[slot%{public}d]SendRequest fail, error:%{public}d", slotId, error);
+        return TELEPHONY_ERR_FAIL;
+    }
+    int32_t result = out.ReadInt32();
+    if (result == TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL || result == TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL ||
+        result == TELEPHONY_ERR_WRITE_DATA_FAIL) {
+        // these mean not delivered to the caller, the service did receive the batch
+        TELEPHONY_LOGE("[slot%{public}d]batch request fail in service:%{public}d", slotId, result);
+        return TELEPHONY_ERR_FAIL;
+    }
+    if (result != TELEPHONY_SUCCESS) {
+        return result;
+    }
+    if (!out.ReadInt32Vector(&results) || results.size() != operations.size()) {
+        TELEPHONY_LOGE("[slot%{public}d]Read results fail!", slotId);
+        return TELEPHONY_ERR_READ_DATA_FAIL;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
 int32_t ImsCallProxy::SendUpdateCallMediaModeRequest(const ImsCallInfo &callInfo, ImsCallType callType)
 {
     MessageParcel in;
@@ -806,8 +866,8 @@ int32_t ImsCallProxy::CanSetCallTransferTime(int32_t slotId, bool &result)
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
 
-    int32_t error = remote->SendRequest(static_cast<int32_t>(ImsCallInterfaceCode::IMS_CAN_SET_CALL_TRANSFER_TIME), in,
-        out, option);
+    int32_t error = InnerSendRequest(
+        remote, static_cast<int32_t>(ImsCallInterfaceCode::IMS_CAN_SET_CALL_TRANSFER_TIME), in, out, option);
     if (error == ERR_NONE) {
         result = out.ReadBool();
         return out.ReadInt32();
@@ -1010,6 +1070,28 @@ int32_t ImsCallProxy::RegisterImsCallCallback(const sptr<ImsCallCallbackInterfac
     return SendRequest(in, static_cast<int32_t>(ImsCallInterfaceCode::IMS_CALL_REGISTER_CALLBACK));
 }
 
+int32_t ImsCallProxy::RegisterImsEventChannel(const sptr<Ashmem> &ashmem, int32_t eventFd)
+{
+    if (ashmem == nullptr || eventFd < 0) {
+        TELEPHONY_LOGE("ashmem or eventfd is invalid!");
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    MessageParcel in;
+    if (!in.WriteInterfaceToken(ImsCallProxy::GetDescriptor())) {
+        TELEPHONY_LOGE("Write descriptor token fail!");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!in.WriteAshmem(ashmem)) {
+        TELEPHONY_LOGE("Write ashmem fail!");
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    if (!in.WriteFileDescriptor(eventFd)) {
+        TELEPHONY_LOGE("Write eventfd fail!");
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    return SendRequest(in, static_cast<int32_t>(ImsCallInterfaceCode::IMS_CALL_REGISTER_EVENT_CHANNEL));
+}
+
 int32_t ImsCallProxy::UpdateImsCapabilities(int32_t slotId, const ImsCapabilityList &imsCapabilityList)
 {
     MessageParcel in;
@@ -1092,6 +1174,18 @@ int32_t ImsCallProxy::WriteCommonInfo(int32_t slotId, std::string funcName, Mess
     return TELEPHONY_SUCCESS;
 }
 
+int32_t ImsCallProxy::InnerSendRequest(
+    const sptr<IRemoteObject> &remote, int32_t code, MessageParcel &in, MessageParcel &out, MessageOption &option)
+{
+    std::shared_ptr<CellularCallClock> clock = CellularCallClock::GetInstance();
+    int64_t startTime = clock->NowUs();
+    int32_t error = remote->SendRequest(code, in, out, option);
+    DelayedRefSingleton<CellularCallIpcMetrics>::GetInstance().Record(IpcDirection::IMS_OUTBOUND,
+        static_cast<uint32_t>(code), error, in.GetDataSize() + out.GetDataSize(),
+        clock->NowUs() - startTime);
+    return error;
+}
+
 int32_t ImsCallProxy::SendRequest(MessageParcel &in, int32_t eventId)
 {
     sptr<IRemoteObject> remote = Remote();
@@ -1102,7 +1196,7 @@ int32_t ImsCallProxy::SendRequest(MessageParcel &in, int32_t eventId)
 
     MessageParcel out;
     MessageOption option;
-    int32_t error = remote->SendRequest(eventId, in, out, option);
+    int32_t error = InnerSendRequest(remote, eventId, in, out, option);
     if (error == ERR_NONE) {
         return out.ReadInt32();
     }
@@ -1120,7 +1214,7 @@ int32_t ImsCallProxy::SendRequest(int32_t slotId, MessageParcel &in, int32_t eve
 
     MessageParcel out;
     MessageOption option;
-    int32_t error = remote->SendRequest(eventId, in, out, option);
+    int32_t error = InnerSendRequest(remote, eventId, in, out, option);
     if (error == ERR_NONE) {
         return out.ReadInt32();
     }
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ims_event_channel.h"
+
+#include <cerrno>
+#include <new>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "ims_call_types.h"
+#include "securec.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr uint32_t IMS_EVENT_CHANNEL_MAX_CAPACITY = 4096;
+static constexpr const char *IMS_EVENT_CHANNEL_NAME = "ImsEventChannel";
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "ring indexes must be lock free to be shared");
+static_assert(sizeof(ImsCallPeerDimensionsInfo) <= IMS_EVENT_PAYLOAD_MAX_SIZE, "payload too large");
+static_assert(sizeof(ImsCallDataUsageInfo) <= IMS_EVENT_PAYLOAD_MAX_SIZE, "payload too large");
+static_assert(sizeof(CameraCapabilitiesInfo) <= IMS_EVENT_PAYLOAD_MAX_SIZE, "payload too large");
+static_assert(sizeof(ImsCallSessionEventInfo) <= IMS_EVENT_PAYLOAD_MAX_SIZE, "payload too large");
+static_assert(sizeof(ImsCallRttEventInfo) <= IMS_EVENT_PAYLOAD_MAX_SIZE, "payload too large");
+
+static bool IsValidCapacity(uint32_t capacity)
+{
+    return capacity > 0 && capacity <= IMS_EVENT_CHANNEL_MAX_CAPACITY && (capacity & (capacity - 1)) == 0;
+}
+
+ImsEventChannel::ImsEventChannel(const sptr<Ashmem> &ashmem, int32_t eventFd, void *base, size_t mapSize)
+    : ashmem_(ashmem), eventFd_(eventFd), base_(base), mapSize_(mapSize)
+{
+    header_ = static_cast<ImsEventRingHeader *>(base_);
+    records_ = reinterpret_cast<ImsEventRecord *>(static_cast<uint8_t *>(base_) + sizeof(ImsEventRingHeader));
+    capacity_ = header_->capacity;
+}
+
+ImsEventChannel::~ImsEventChannel()
+{
+    if (base_ != nullptr) {
+        munmap(base_, mapSize_);
+        base_ = nullptr;
+    }
+    if (eventFd_ >= 0) {
+        close(eventFd_);
+        eventFd_ = -1;
+    }
+    if (ashmem_ != nullptr) {
+        ashmem_->CloseAshmem();
+        ashmem_ = nullptr;
+    }
+}
+
+size_t ImsEventChannel::GetMapSize(uint32_t capacity)
+{
+    return sizeof(ImsEventRingHeader) + sizeof(ImsEventRecord) * capacity;
+}
+
+std::shared_ptr<ImsEventChannel> ImsEventChannel::Create(uint32_t capacity)
+{
+    if (!IsValidCapacity(capacity)) {
+        TELEPHONY_LOGE("invalid capacity:%{public}u", capacity);
+        return nullptr;
+    }
+    size_t mapSize = GetMapSize(capacity);
+    sptr<Ashmem> ashmem = Ashmem::CreateAshmem(IMS_EVENT_CHANNEL_NAME, static_cast<int32_t>(mapSize));
+    if (ashmem == nullptr) {
+        TELEPHONY_LOGE("create ashmem fail");
+        return nullptr;
+    }
+    void *base = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, ashmem->GetAshmemFd(), 0);
+    if (base == MAP_FAILED) {
+        TELEPHONY_LOGE("mmap ashmem fail");
+        ashmem->CloseAshmem();
+        return nullptr;
+    }
+    int32_t eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (eventFd < 0) {
+        TELEPHONY_LOGE("create eventfd fail");
+        munmap(base, mapSize);
+        ashmem->CloseAshmem();
+        return nullptr;
+    }
+    ImsEventRingHeader *header = new (base) ImsEventRingHeader();
+    header->magic = IMS_EVENT_CHANNEL_MAGIC;
+    header->version = IMS_EVENT_CHANNEL_VERSION;
+    header->capacity = capacity;
+    header->recordSize = sizeof(ImsEventRecord);
+    ImsEventChannel *channel = new (std::nothrow) ImsEventChannel(ashmem, eventFd, base, mapSize);
+    if (channel == nullptr) {
+        TELEPHONY_LOGE("create event channel fail");
+        munmap(base, mapSize);
+        close(eventFd);
+        ashmem->CloseAshmem();
+        return nullptr;
+    }
+    return std::shared_ptr<ImsEventChannel>(channel);
+}
+
+std::shared_ptr<ImsEventChannel> ImsEventChannel::Attach(const sptr<Ashmem> &ashmem, int32_t eventFd)
+{
+    if (ashmem == nullptr || eventFd < 0) {
+        TELEPHONY_LOGE("invalid ashmem or eventfd");
+        if (eventFd >= 0) {
+            close(eventFd);
+        }
+        return nullptr;
+    }
+    int32_t ashmemSize = ashmem->GetAshmemSize();
+    if (ashmemSize < static_cast<int32_t>(sizeof(ImsEventRingHeader))) {
+        TELEPHONY_LOGE("ashmem size %{public}d is too small", ashmemSize);
+        close(eventFd);
+        return nullptr;
+    }
+    size_t mapSize = static_cast<size_t>(ashmemSize);
+    void *base = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, ashmem->GetAshmemFd(), 0);
+    if (base == MAP_FAILED) {
+        TELEPHONY_LOGE("mmap ashmem fail");
+        close(eventFd);
+        return nullptr;
+    }
+    const ImsEventRingHeader *header = static_cast<const ImsEventRingHeader *>(base);
+    if (header->magic != IMS_EVENT_CHANNEL_MAGIC || header->version != IMS_EVENT_CHANNEL_VERSION ||
+        header->recordSize != sizeof(ImsEventRecord) || !IsValidCapacity(header->capacity) ||
+        GetMapSize(header->capacity) > mapSize) {
+        TELEPHONY_LOGE("unsupported channel layout, version:%{public}u", header->version);
+        munmap(base, mapSize);
+        close(eventFd);
+        return nullptr;
+    }
+    ImsEventChannel *channel = new (std::nothrow) ImsEventChannel(ashmem, eventFd, base, mapSize);
+    if (channel == nullptr) {
+        TELEPHONY_LOGE("attach event channel fail");
+        munmap(base, mapSize);
+        close(eventFd);
+        return nullptr;
+    }
+    return std::shared_ptr<ImsEventChannel>(channel);
+}
+
+sptr<Ashmem> ImsEventChannel::GetAshmem() const
+{
+    return ashmem_;
+}
+
+int32_t ImsEventChannel::GetEventFd() const
+{
+    return eventFd_;
+}
+
+uint32_t ImsEventChannel::GetCapacity() const
+{
+    return capacity_;
+}
+
+uint64_t ImsEventChannel::GetDroppedCount() const
+{
+    return header_->droppedCount.load(std::memory_order_relaxed);
+}
+
+ImsEventRecord *ImsEventChannel::GetRecord(uint64_t index) const
+{
+    return &records_[index & (capacity_ - 1)];
+}
+
+bool ImsEventChannel::Publish(int32_t slotId, ImsEventChannelType type, const void *data, uint32_t length)
+{
+    if (data == nullptr || length > IMS_EVENT_PAYLOAD_MAX_SIZE) {
+        TELEPHONY_LOGE("[slot%{public}d] invalid payload, length:%{public}u", slotId, length);
+        return false;
+    }
+    uint64_t writeIndex = header_->writeIndex.load(std::memory_order_relaxed);
+    uint64_t readIndex = header_->readIndex.load(std::memory_order_acquire);
+    if (writeIndex - readIndex >= capacity_) {
+        header_->droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    ImsEventRecord *record = GetRecord(writeIndex);
+    record->type = static_cast<int32_t>(type);
+    record->slotId = slotId;
+    record->length = length;
+    if (memcpy_s(record->payload, sizeof(record->payload), data, length) != EOK) {
+        return false;
+    }
+    header_->writeIndex.store(writeIndex + 1, std::memory_order_release);
+    uint64_t doorbell = 1;
+    if (write(eventFd_, &doorbell, sizeof(doorbell)) != static_cast<ssize_t>(sizeof(doorbell))) {
+        // the counter is saturated, the consumer is already woken up and drains the ring
+        TELEPHONY_LOGW("[slot%{public}d] ring doorbell fail", slotId);
+    }
+    return true;
+}
+
+bool ImsEventChannel::Consume(ImsEventRecord &record)
+{
+    uint64_t readIndex = header_->readIndex.load(std::memory_order_relaxed);
+    uint64_t writeIndex = header_->writeIndex.load(std::memory_order_acquire);
+    if (readIndex == writeIndex) {
+        return false;
+    }
+    if (writeIndex - readIndex > capacity_) {
+        // the producer broke the protocol, skip everything instead of reading records twice
+        TELEPHONY_LOGE("ring index out of range, read:%{public}llu write:%{public}llu",
+            static_cast<unsigned long long>(readIndex), static_cast<unsigned long long>(writeIndex));
+        header_->readIndex.store(writeIndex, std::memory_order_release);
+        return false;
+    }
+    record = *GetRecord(readIndex);
+    header_->readIndex.store(readIndex + 1, std::memory_order_release);
+    return true;
+}
+
+void ImsEventChannel::ClearDoorbell()
+{
+    uint64_t count = 0;
+    ssize_t ret = 0;
+    do {
+        ret = read(eventFd_, &count, sizeof(count));
+    } while (ret < 0 && errno == EINTR);
+    // EAGAIN: the doorbell was not rung, there is nothing to clear
+    if (ret < 0 && errno != EAGAIN) {
+        TELEPHONY_LOGE("clear doorbell fail, errno:%{public}d", errno);
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
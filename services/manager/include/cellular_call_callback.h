@@ -16,6 +16,8 @@
 #ifndef TELEPHONY_CELLULAR_CALL_CALLBACK_H
 #define TELEPHONY_CELLULAR_CALL_CALLBACK_H
 
+#include <functional>
+
 #include "network_search_callback_base.h"
 #include "cellular_call_interface.h"
 
@@ -34,6 +36,19 @@ public:
     void ClearCellularCallList(int32_t slotId) override;
 
     void SetReadyToCall(int32_t slotId, int32_t callType, bool isReadyToCall) override;
+
+private:
+    /**
+     * Run the task on the slot handler of the CellularCallService living in this process,
+     * so the call does not loop back through binder into our own SA.
+     *
+     * @param slotId
+     * @param name task name
+     * @param task
+     * @return true if the task was dispatched locally, false if the caller should use ipc.
+     */
+    bool DispatchToLocalService(int32_t slotId, const std::string &name, const std::function<void()> &task);
+    sptr<CellularCallInterface> GetRemoteService(const std::string &funcName);
 };
 } // namespace Telephony
 } // namespace OHOS
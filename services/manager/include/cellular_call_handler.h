@@ -16,13 +16,19 @@
 #ifndef CELLULAR_CALL_HANDLER_H
 #define CELLULAR_CALL_HANDLER_H
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <regex>
+#include <unordered_map>
 
 #include "cellular_call_config.h"
+#include "cellular_call_ecc_assembler.h"
 #include "cellular_call_data_struct.h"
+#include "cellular_call_queue_watchdog.h"
 #include "cellular_call_register.h"
+#include "cellular_call_timer_wheel.h"
 #include "common_event.h"
 #include "common_event_manager.h"
 #include "common_event_support.h"
@@ -40,15 +46,78 @@ namespace Telephony {
 
 constexpr const char *KEY_CONST_TELEPHONY_IS_USE_CLOUD_IMS_NV = "const.telephony.is_use_cloud_ims_nv";
 constexpr const char *KEY_PERSIST_TELEPHONY_VOLTE_CAP_IN_CHIP = "persist.telephony.volte_cap_in_chip";
+
+/**
+ * @brief Priority class of the events processed by CellularCallHandler.
+ *
+ * Call control and emergency events are served before anything else, network state changes come next,
+ * supplementary service and config results keep the default order, telemetry is only processed when the
+ * queue is idle.
+ */
+enum class CellularCallEventLane : int32_t {
+    IMMEDIATE = 0,
+    HIGH,
+    NORMAL,
+    IDLE,
+    LANE_BUTT,
+};
+
+static constexpr int32_t EVENT_LANE_NUM = static_cast<int32_t>(CellularCallEventLane::LANE_BUTT);
+static constexpr int32_t EVENT_WAIT_BUCKET_NUM = 8;
+/**
+ * Upper bound in milliseconds of every queue wait bucket but the last one, which takes the rest.
+ */
+static constexpr int64_t EVENT_WAIT_BUCKET_BOUNDS_MS[EVENT_WAIT_BUCKET_NUM - 1] = { 1, 5, 10, 50, 100, 500, 1000 };
+
+struct EventLaneWaitStats {
+    uint64_t count = 0;
+    uint64_t maxWaitMs = 0;
+    uint64_t histogram[EVENT_WAIT_BUCKET_NUM] = { 0 };
+};
+
+/**
+ * Default bound of the telemetry queues, state like reports keep one entry per call, the others are a FIFO.
+ * Both can be overridden by {TELEMETRY_QUEUE_LIMIT_KEY} or {CellularCallHandler::SetTelemetryQueueLimit}.
+ */
+static constexpr uint32_t TELEMETRY_STATE_QUEUE_LIMIT = 8;
+static constexpr uint32_t TELEMETRY_EVENT_QUEUE_LIMIT = 32;
+static constexpr uint32_t TELEMETRY_QUEUE_MAX_LIMIT = 1024;
+constexpr const char *TELEMETRY_QUEUE_LIMIT_KEY = "persist.telephony.cellular_call.telemetry_queue_limit";
+
+struct TelemetryQueueStats {
+    uint32_t eventId = 0;
+    uint32_t limit = 0;
+    uint32_t pending = 0;
+    uint64_t enqueued = 0;
+    uint64_t collapsed = 0;
+    uint64_t dropped = 0;
+};
+
+/**
+ * A broadcast arriving after this much quiet is handled at once, the ones within a burst are coalesced into one
+ * handled when the burst has been quiet for the same time, or at the latest after the max defer.
+ */
+static constexpr int64_t BROADCAST_SETTLE_MS = 500;
+static constexpr int64_t BROADCAST_MAX_DEFER_MS = 2000;
+
+struct BroadcastDebounceStats {
+    uint32_t eventId = 0;
+    uint64_t received = 0;
+    uint64_t leading = 0;
+    uint64_t trailing = 0;
+    uint64_t coalesced = 0;
+};
+
 class CellularCallHandler : public TelEventHandler, public EventFwk::CommonEventSubscriber {
 public:
     /**
      * CellularCallHandler constructor
      *
-     * @param runner
      * @param subscriberInfo
+     * @param name Indicates the name of the event queue, every slot passes its own so that slots never share one
      */
-    explicit CellularCallHandler(const EventFwk::CommonEventSubscribeInfo &subscriberInfo);
+    explicit CellularCallHandler(
+        const EventFwk::CommonEventSubscribeInfo &subscriberInfo, const std::string &name = "CellularCallHandler");
 
     /**
      * ~CellularCallHandler destructor
@@ -69,6 +138,110 @@ public:
      */
     void OnReceiveEvent(const EventFwk::CommonEventData &data) override;
 
+    /**
+     * Get the lane of an event id, events missing in the lane table are NORMAL.
+     *
+     * @param eventId
+     * @return CellularCallEventLane
+     */
+    static CellularCallEventLane GetEventLane(uint32_t eventId);
+
+    /**
+     * Get the event queue priority of an event id according to its lane.
+     *
+     * @param eventId
+     * @return Priority
+     */
+    static Priority GetEventPriority(uint32_t eventId);
+
+    /**
+     * Send the event to the handler with the priority of its lane. Used for the events cellular call posts to
+     * its own handler, the ims and satellite callbacks keep {TelEventHandler::SendTelEvent}.
+     *
+     * @param handler
+     * @param event
+     * @return Returns true on success.
+     */
+    static bool SendLaneEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler,
+        AppExecFwk::InnerEvent::Pointer &event);
+
+    static bool SendLaneEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler, uint32_t eventId);
+
+    template<typename T>
+    static bool SendLaneEvent(
+        const std::shared_ptr<AppExecFwk::EventHandler> &handler, uint32_t eventId, const std::shared_ptr<T> &object)
+    {
+        AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(eventId, object);
+        return SendLaneEvent(handler, event);
+    }
+
+    /**
+     * Queue a telemetry class event. Every event type has a bounded queue drained by one handler event,
+     * a state like report replaces the pending one of the same call and a full queue drops its oldest entry.
+     * Events without a telemetry queue are sent with {SendLaneEvent}.
+     *
+     * @param handler
+     * @param callIndex Indicates the call the report belongs to
+     * @param event
+     * @return Returns true when the event is queued, collapsed or shed.
+     */
+    static bool SendTelemetryEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler, int32_t callIndex,
+        AppExecFwk::InnerEvent::Pointer &event);
+
+    template<typename T>
+    static bool SendTelemetryEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler, uint32_t eventId,
+        int32_t callIndex, const std::shared_ptr<T> &object)
+    {
+        AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(eventId, object);
+        return SendTelemetryEvent(handler, callIndex, event);
+    }
+
+    /**
+     * Change the bound of one telemetry queue.
+     *
+     * @param eventId
+     * @param limit
+     * @return Returns TELEPHONY_SUCCESS on success, others on failure.
+     */
+    int32_t SetTelemetryQueueLimit(uint32_t eventId, uint32_t limit);
+
+    void GetTelemetryQueueStats(std::vector<TelemetryQueueStats> &stats);
+
+    void GetBroadcastDebounceStats(std::vector<BroadcastDebounceStats> &stats);
+
+    void GetEccAssemblyStats(EccAssemblyStats &stats);
+
+    /**
+     * Get the queue wait statistics of one lane.
+     *
+     * @param lane
+     * @param stats
+     */
+    void GetLaneWaitStats(CellularCallEventLane lane, EventLaneWaitStats &stats);
+
+    /**
+     * Get the watchdog of the event queue, used by dump.
+     *
+     * @return CellularCallQueueWatchdog
+     */
+    CellularCallQueueWatchdog &GetQueueWatchdog();
+
+    /**
+     * Get the timer wheel of the slot, per call and per request timeouts are armed on it.
+     *
+     * @return CellularCallTimerWheel
+     */
+    std::shared_ptr<CellularCallTimerWheel> GetTimerWheel();
+
+    /**
+     * Send EVENT_EXECUTE_POST_DIAL after a delay through the timer wheel
+     *
+     * @param postDial Indicates the call to continue
+     * @param delayMs Indicates the delay
+     * @return the timer id on the wheel, 0 on failure
+     */
+    CellularCallClock::TimerId SendPostDialEvent(const std::shared_ptr<PostDialData> &postDial, int64_t delayMs);
+
     /**
      * Set Slot Id
      *
@@ -218,6 +391,9 @@ public:
 
 public:
     const uint32_t REGISTER_HANDLER_ID = 10003;
+    const uint32_t OPERATOR_CONFIG_PARSED_ID = 10007;
+    const uint32_t TELEMETRY_DRAIN_ID = 10008;
+    const uint32_t ECC_ASSEMBLY_TIMEOUT_ID = 10009;
     const int32_t INTERNATION_CODE = 145;
     int32_t srvccState_ = SrvccState::SRVCC_NONE;
 
@@ -252,6 +428,10 @@ private:
     void SetBarringPasswordResponse(const AppExecFwk::InnerEvent::Pointer &event);
     int32_t ConfirmAndRemoveSsRequestCommand(int32_t index, int32_t &flag);
     int32_t ConfirmAndRemoveSsRequestCommand(int32_t index, int32_t &flag, int32_t &action);
+    void RemoveTimedOutSsRequestCommand(int32_t index, const std::weak_ptr<SsRequestCommand> &utCommand);
+    void DebounceBroadcast(uint32_t eventId, int32_t param);
+    void FlushBroadcast(uint32_t eventId);
+    void DispatchBroadcast(uint32_t eventId, int32_t param);
     void SendUssdResponse(const AppExecFwk::InnerEvent::Pointer &event);
     void SendUnlockPinPukResponse(const AppExecFwk::InnerEvent::Pointer &event);
     void CloseUnFinishedUssdResponse(const AppExecFwk::InnerEvent::Pointer &event);
@@ -279,6 +459,10 @@ private:
     void ReportSatelliteCallsData(const SatelliteCurrentCallList &callInfoList);
 #endif // CELLULAR_CALL_SATELLITE
     void HandleOperatorConfigChanged(const AppExecFwk::InnerEvent::Pointer &event);
+    void HandleOperatorConfigParsed(const AppExecFwk::InnerEvent::Pointer &event);
+    void HandleTelemetryDrain(const AppExecFwk::InnerEvent::Pointer &event);
+    void HandleEccAssemblyTimeout(const AppExecFwk::InnerEvent::Pointer &event);
+    void RequeryEccList(const std::vector<EccIndexRange> &missing);
     void UpdateRsrvccStateReport(const AppExecFwk::InnerEvent::Pointer &event);
     void ProcessRedundantCode(CallInfoList &callInfoList);
     void ProcessCsPhoneNumber(CallInfoList &list);
@@ -306,6 +490,10 @@ private:
 #endif
 
 private:
+    int64_t RecordQueueWait(uint32_t eventId, const AppExecFwk::InnerEvent::Pointer &event);
+    bool ShouldShedEvent(uint32_t eventId);
+    void InitTelemetryQueues();
+    bool EnqueueTelemetryEvent(int32_t callIndex, AppExecFwk::InnerEvent::Pointer &event);
     void CellularCallIncomingStartTrace(const int32_t state);
     void CellularCallIncomingFinishTrace(const int32_t state);
 #ifdef BASE_POWER_IMPROVEMENT_FEATURE
@@ -318,10 +506,39 @@ private:
     int64_t lastCallsDataFlag_ = 0L;
     using RequestFuncType = std::function<void(const AppExecFwk::InnerEvent::Pointer &event)>;
     std::map<uint32_t, RequestFuncType> requestFuncMap_;
+    std::atomic<uint64_t> laneWaitHistogram_[EVENT_LANE_NUM][EVENT_WAIT_BUCKET_NUM] = {};
+    std::atomic<uint64_t> laneMaxWaitMs_[EVENT_LANE_NUM] = {};
+    CellularCallQueueWatchdog queueWatchdog_;
+    std::shared_ptr<CellularCallTimerWheel> timerWheel_ = std::make_shared<CellularCallTimerWheel>();
+    struct TelemetryQueue {
+        uint32_t limit = 0;
+        // state like reports keep only the latest one per call index
+        bool collapse = false;
+        bool drainPosted = false;
+        std::deque<std::pair<int32_t, AppExecFwk::InnerEvent::Pointer>> items;
+        uint64_t enqueued = 0;
+        uint64_t collapsed = 0;
+        uint64_t dropped = 0;
+    };
+    ffrt::mutex telemetryMutex_;
+    std::map<uint32_t, TelemetryQueue> telemetryQueues_;
+    struct BroadcastDebounce {
+        bool isPending = false;
+        int32_t param = 0;
+        int64_t lastMs = -1;
+        int64_t firstPendingMs = 0;
+        CellularCallTimer timer;
+        BroadcastDebounceStats stats;
+    };
+    ffrt::mutex debounceMutex_;
+    std::map<uint32_t, BroadcastDebounce> debounces_;
+    CellularCallEccAssembler eccAssembler_;
     std::shared_ptr<CellularCallRegister> registerInstance_ = DelayedSingleton<CellularCallRegister>::GetInstance();
     bool isDuringRSRVCC_ = false;
     int32_t indexCommand_ = 0;
     std::map<int32_t, std::shared_ptr<SsRequestCommand>> utCommandMap_;
+    // drops the command when the modem never answers, so that a reused index does not find a stale one
+    std::map<int32_t, CellularCallTimer> utCommandTimers_;
     std::mutex mutex_;
     ImsCurrentCallList currentCallList_{};
     CallInfoList currentCsCallInfoList_{};
@@ -124,6 +124,12 @@ public:
     void ReceiveUpdateCallRttErrResponse(int32_t slotId, ImsCallRttErrorInfo &rttErrInfo);
 #endif
 
+private:
+    /**
+     * Copy the callback out of the lock, so reports of different slots never wait for each other's binder call
+     */
+    sptr<ICallStatusCallback> GetCallManagerCallBack();
+
 private:
     sptr<ICallStatusCallback> callManagerCallBack_;
     std::mutex mutex_;
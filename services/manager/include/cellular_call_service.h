@@ -16,12 +16,15 @@
 #ifndef CELLULAR_CALL_SERVICE_H
 #define CELLULAR_CALL_SERVICE_H
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "ffrt.h"
 #include "cellular_call_config.h"
 #include "cellular_call_handler.h"
+#include "cellular_call_startup_orchestrator.h"
 #include "cellular_call_stub.h"
 #include "cellular_call_supplement.h"
 #include "event_runner.h"
@@ -69,10 +72,16 @@ public:
     int32_t GetServiceRunningState();
 
     /**
-     * RegisterHandler
+     * Register the handlers to core service, runs on the handler of the default slot once core service is
+     * ready. Never blocks, while core service is still initializing it checks again later.
      */
     void RegisterHandler();
 
+    /**
+     * Called when core service is published, starts the registration of the handlers at once
+     */
+    void OnCoreServiceReady();
+
     /**
      * Get bindTime_
      *
@@ -94,6 +103,27 @@ public:
      */
     std::string GetSpendTime();
 
+    /**
+     * Get the time the service was published
+     *
+     * @return int64_t
+     */
+    std::string GetPublishTime();
+
+    /**
+     * Get the time core service was reported ready
+     *
+     * @return int64_t
+     */
+    std::string GetCoreServiceReadyTime();
+
+    /**
+     * Get the phases of every startup stage run so far
+     *
+     * @param phases[out] the phases in the order of the stages
+     */
+    void GetStartupPhases(std::vector<StartupPhaseInfo> &phases);
+
     /**
      * Dial
      *
@@ -711,9 +741,30 @@ private:
     bool Init();
 
     /**
-     * Register Handler
+     * Register the handlers to core service on ffrt without waiting, {OnCoreServiceHandlerRegistered}
+     * runs once every slot is done
+     *
+     * @return false when the startup phases are invalid and nothing is run
+     */
+    bool RegisterCoreServiceHandler();
+
+    /**
+     * Finish the registration to core service, it ends the startup
      */
-    void RegisterCoreServiceHandler();
+    void OnCoreServiceHandlerRegistered();
+
+    /**
+     * Register the handler of one slot to core service and request the initial radio and config state
+     */
+    void RegisterSlotCoreServiceHandler(int32_t slot);
+
+    void SubscribeCoreService();
+    void SubscribeCallManager();
+
+    /**
+     * Keep the phases of a finished startup stage for dump and report them in a hisysevent
+     */
+    void RecordStartupStage(const CellularCallStartupOrchestrator &orchestrator);
 
     /**
      * Create Handler
@@ -727,8 +778,10 @@ private:
 
     /**
      * SendEventRegisterHandler
+     *
+     * @param delayTime the delay in ms before the registration runs
      */
-    void SendEventRegisterHandler();
+    void SendEventRegisterHandler(int64_t delayTime = 0);
 
     /**
      * Is Valid Slot Id
@@ -776,24 +829,50 @@ private:
         SATELLITE_ON,
     };
 
+    /**
+     * Everything one slot owns on the call path. Each slot has its own lock and its own event queue,
+     * so a busy slot never blocks the other one.
+     */
+    struct SlotContext {
+        std::mutex mutex;
+        std::shared_ptr<CellularCallHandler> handler = nullptr;
+        std::shared_ptr<CSControl> csControl = nullptr;
+        std::shared_ptr<IMSControl> imsControl = nullptr;
+#ifdef CELLULAR_CALL_SATELLITE
+        std::shared_ptr<SatelliteControl> satelliteControl = nullptr;
+#endif // CELLULAR_CALL_SATELLITE
+    };
+
+    /**
+     * Get the context of one slot
+     *
+     * @param slotId
+     * @return SlotContext, nullptr when the slot id is invalid
+     */
+    SlotContext *GetSlotContext(int32_t slotId) const;
+
     int64_t bindTime_ = 0L;
-    int64_t endTime_ = 0L;
+    // written when the registration to core service is done, it ends the startup
+    std::atomic<int64_t> endTime_ { 0L };
     int64_t spendTime_ = 0L;
+    int64_t publishTime_ = 0L;
+    std::atomic<int64_t> coreServiceReadyTime_ { 0L };
+    std::atomic<bool> isCoreServiceRegistered_ { false };
+    ffrt::mutex startupMutex_;
+    std::vector<StartupPhaseInfo> startupPhases_;
+    // only touched on the handler of the default slot
+    uint32_t coreServiceRetryCount_ = 0;
+    bool isCoreServiceRegistering_ = false;
     ServiceRunningState state_;
-    std::mutex handlerMapMutex_;
     ffrt::shared_mutex radioMutex_{};
-    std::map<int32_t, std::shared_ptr<CellularCallHandler>> handlerMap_;
     int32_t srvccState_ = SrvccState::SRVCC_NONE;
-    std::map<int32_t, std::shared_ptr<CSControl>> csControlMap_;
-    std::map<int32_t, std::shared_ptr<IMSControl>> imsControlMap_;
-#ifdef CELLULAR_CALL_SATELLITE
-    std::map<int32_t, std::shared_ptr<SatelliteControl>> satelliteControlMap_;
-#endif // CELLULAR_CALL_SATELLITE
+    // created in the constructor and never resized, only the content of an entry changes
+    std::vector<std::unique_ptr<SlotContext>> slotContexts_;
     std::map<int32_t, bool> isRadioOn_;
     sptr<NetworkSearchCallBackBase> networkSearchCallBack_;
     sptr<ISystemAbilityStatusChange> statusChangeListener_ = nullptr;
     sptr<ISystemAbilityStatusChange> callManagerListener_ = nullptr;
-    std::mutex mutex_;
+    sptr<ISystemAbilityStatusChange> coreServiceListener_ = nullptr;
     sptr<AAFwk::IDataAbilityObserver> settingsCallback_ = nullptr;
 
 private:
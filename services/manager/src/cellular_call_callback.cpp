@@ -16,6 +16,7 @@
 #include "cellular_call_callback.h"
 
 #include "cellular_call_proxy.h"
+#include "cellular_call_service.h"
 #include "system_ability_definition.h"
 #include "iservice_registry.h"
 #include "telephony_log_wrapper.h"
@@ -28,33 +29,64 @@ CellularCallCallback::~CellularCallCallback() = default;
 
 void CellularCallCallback::ClearCellularCallList(int32_t slotId)
 {
-    auto systemAbilityMgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
-    if (systemAbilityMgr == nullptr) {
-        TELEPHONY_LOGE("ClearCellularCallList return, Get ISystemAbilityManager failed.");
+    TELEPHONY_LOGI("HangUpAllConnection for slotId[%{public}d]", slotId);
+    bool isLocal = DispatchToLocalService(slotId, "ClearCellularCallList", [slotId]() {
+        DelayedSingleton<CellularCallService>::GetInstance()->HangUpAllConnection(slotId);
+    });
+    if (isLocal) {
         return;
     }
-    auto remote = systemAbilityMgr->CheckSystemAbility(TELEPHONY_CELLULAR_CALL_SYS_ABILITY_ID);
+    auto remote = GetRemoteService("ClearCellularCallList");
     if (remote == nullptr) {
-        TELEPHONY_LOGE("ClearCellularCallList return, CellularCallService Remote service not exists.");
         return;
     }
-    TELEPHONY_LOGI("HangUpAllConnection for slotId[%{public}d]", slotId);
-    iface_cast<CellularCallInterface>(remote)->HangUpAllConnection(slotId);
+    remote->HangUpAllConnection(slotId);
 }
 
 void CellularCallCallback::SetReadyToCall(int32_t slotId, int32_t callType, bool isReadyToCall)
+{
+    bool isLocal = DispatchToLocalService(slotId, "SetReadyToCall", [slotId, callType, isReadyToCall]() {
+        DelayedSingleton<CellularCallService>::GetInstance()->SetReadyToCall(slotId, callType, isReadyToCall);
+    });
+    if (isLocal) {
+        return;
+    }
+    auto remote = GetRemoteService("SetReadyToCall");
+    if (remote == nullptr) {
+        return;
+    }
+    remote->SetReadyToCall(slotId, callType, isReadyToCall);
+}
+
+bool CellularCallCallback::DispatchToLocalService(
+    int32_t slotId, const std::string &name, const std::function<void()> &task)
+{
+    auto service = DelayedSingleton<CellularCallService>::GetInstance();
+    if (service == nullptr ||
+        service->GetServiceRunningState() != static_cast<int32_t>(ServiceRunningState::STATE_RUNNING)) {
+        return false;
+    }
+    auto handler = service->GetHandler(slotId);
+    if (handler == nullptr || !handler->PostImmediateTask(task, name)) {
+        TELEPHONY_LOGW("%{public}s post to slot%{public}d handler fail, run in place", name.c_str(), slotId);
+        task();
+    }
+    return true;
+}
+
+sptr<CellularCallInterface> CellularCallCallback::GetRemoteService(const std::string &funcName)
 {
     auto systemAbilityMgr = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
     if (systemAbilityMgr == nullptr) {
-        TELEPHONY_LOGE("SetReadyToCall return, Get ISystemAbilityManager failed.");
-        return;
+        TELEPHONY_LOGE("%{public}s return, Get ISystemAbilityManager failed.", funcName.c_str());
+        return nullptr;
     }
     auto remote = systemAbilityMgr->CheckSystemAbility(TELEPHONY_CELLULAR_CALL_SYS_ABILITY_ID);
     if (remote == nullptr) {
-        TELEPHONY_LOGE("SetReadyToCall return, CellularCallService Remote service not exists.");
-        return;
+        TELEPHONY_LOGE("%{public}s return, CellularCallService Remote service not exists.", funcName.c_str());
+        return nullptr;
     }
-    iface_cast<CellularCallInterface>(remote)->SetReadyToCall(slotId, callType, isReadyToCall);
+    return iface_cast<CellularCallInterface>(remote);
 }
 } // namespace Telephony
 } // namespace OHOS
@@ -15,8 +15,12 @@
 
 #include "cellular_call_handler.h"
 
+#include <algorithm>
+
+#include "cellular_call_clock.h"
 #include "cellular_call_config.h"
 #include "cellular_call_hisysevent.h"
+#include "cellular_call_parameter_cache.h"
 #include "cellular_call_service.h"
 #include "hitrace_meter.h"
 #include "tel_ril_call_parcel.h"
@@ -48,6 +52,7 @@ const uint32_t GET_SATELLITE_CALL_DATA_ID = 10005;
 const uint32_t NETWORK_STATE_CHANGED = 10006;
 const int64_t DELAY_TIME = 100;
 const int32_t MAX_REQUEST_COUNT = 50;
+const int64_t SS_REQUEST_TIMEOUT_MS = 60 * 1000;
 // message was null, mean report the default message to user which have been define at CellularCallSupplement
 const std::string DEFAULT_NULL_MESSAGE = "";
 // NV refresh state
@@ -59,9 +64,11 @@ bool CellularCallHandler::isNvCfgFinish_ = false;
 #endif
 constexpr int8_t IMS_CLOUD_FAIL = 23;
 constexpr int32_t MAX_ACTIVE_CALL_NUM = 2;
+constexpr int64_t EVENT_WAIT_LOG_THRESHOLD_MS = 500;
 
-CellularCallHandler::CellularCallHandler(const EventFwk::CommonEventSubscribeInfo &subscriberInfo)
-    : TelEventHandler("CellularCallHandler"), CommonEventSubscriber(subscriberInfo)
+CellularCallHandler::CellularCallHandler(
+    const EventFwk::CommonEventSubscribeInfo &subscriberInfo, const std::string &name)
+    : TelEventHandler(name), CommonEventSubscriber(subscriberInfo)
 {
     InitBasicFuncMap();
     InitConfigFuncMap();
@@ -74,6 +81,7 @@ CellularCallHandler::CellularCallHandler(const EventFwk::CommonEventSubscribeInf
 #ifdef SUPPORT_RTT_CALL
     InitImsRttFuncMap();
 #endif
+    InitTelemetryQueues();
 }
 
 void CellularCallHandler::InitBasicFuncMap()
@@ -148,6 +156,12 @@ void CellularCallHandler::InitConfigFuncMap()
         [this](const AppExecFwk::InnerEvent::Pointer &event) { GetEmergencyCallListResponse(event); };
     requestFuncMap_[OPERATOR_CONFIG_CHANGED_ID] =
         [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleOperatorConfigChanged(event); };
+    requestFuncMap_[OPERATOR_CONFIG_PARSED_ID] =
+        [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleOperatorConfigParsed(event); };
+    requestFuncMap_[TELEMETRY_DRAIN_ID] =
+        [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleTelemetryDrain(event); };
+    requestFuncMap_[ECC_ASSEMBLY_TIMEOUT_ID] =
+        [this](const AppExecFwk::InnerEvent::Pointer &event) { HandleEccAssemblyTimeout(event); };
     requestFuncMap_[RadioEvent::RADIO_GET_IMS_CAPABILITY_FINISHED] =
         [this](const AppExecFwk::InnerEvent::Pointer &event) { GetImsCapResponse(event); };
 }
@@ -286,6 +300,314 @@ void CellularCallHandler::InitImsRttFuncMap()
 }
 #endif
 
+static const std::unordered_map<uint32_t, CellularCallEventLane> &GetEventLaneTable()
+{
+    // events missing here stay in the NORMAL lane, which covers supplementary service and config results
+    static const std::unordered_map<uint32_t, CellularCallEventLane> laneTable = {
+        { RadioEvent::RADIO_DIAL, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_HANGUP_CONNECT, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_REJECT_CALL, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_ACCEPT_CALL, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_HOLD_CALL, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_ACTIVE_CALL, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_SWAP_CALL, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_COMBINE_CALL, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_JOIN_CALL, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_SPLIT_CALL, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_CALL_SUPPLEMENT, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_SEND_DTMF, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_START_DTMF, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_STOP_DTMF, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_CURRENT_CALLS, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_IMS_GET_CALL_DATA, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_GET_CALL_FAIL_REASON, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_CALL_STATUS_INFO, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_IMS_CALL_STATUS_INFO, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_CALL_RINGBACK_VOICE, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_CALL_SRVCC_STATUS, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_CALL_RSRVCC_STATUS, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_CALL_EMERGENCY_NUMBER_REPORT, CellularCallEventLane::IMMEDIATE },
+        { RadioEvent::RADIO_RIL_ADAPTER_HOST_DIED, CellularCallEventLane::IMMEDIATE },
+        { GET_CS_CALL_DATA_ID, CellularCallEventLane::IMMEDIATE },
+        { GET_IMS_CALL_DATA_ID, CellularCallEventLane::IMMEDIATE },
+        { DtmfHandlerId::EVENT_EXECUTE_POST_DIAL, CellularCallEventLane::IMMEDIATE },
+#ifdef CELLULAR_CALL_SATELLITE
+        { SatelliteRadioEvent::SATELLITE_RADIO_CALL_STATE_CHANGED, CellularCallEventLane::IMMEDIATE },
+        { SatelliteRadioEvent::SATELLITE_RADIO_DIAL, CellularCallEventLane::IMMEDIATE },
+        { SatelliteRadioEvent::SATELLITE_RADIO_HANGUP, CellularCallEventLane::IMMEDIATE },
+        { SatelliteRadioEvent::SATELLITE_RADIO_ANSWER, CellularCallEventLane::IMMEDIATE },
+        { SatelliteRadioEvent::SATELLITE_RADIO_REJECT, CellularCallEventLane::IMMEDIATE },
+        { SatelliteRadioEvent::SATELLITE_RADIO_GET_CALL_DATA, CellularCallEventLane::IMMEDIATE },
+        { GET_SATELLITE_CALL_DATA_ID, CellularCallEventLane::IMMEDIATE },
+#endif // CELLULAR_CALL_SATELLITE
+        { NETWORK_STATE_CHANGED, CellularCallEventLane::HIGH },
+        { RadioEvent::RADIO_CALL_PEER_DIMENSIONS_CHANGED, CellularCallEventLane::IDLE },
+        { RadioEvent::RADIO_CALL_DATA_USAGE_CHANGED, CellularCallEventLane::IDLE },
+        { RadioEvent::RADIO_CAMERA_CAPABILITIES_CHANGED, CellularCallEventLane::IDLE },
+    };
+    return laneTable;
+}
+
+CellularCallEventLane CellularCallHandler::GetEventLane(uint32_t eventId)
+{
+    const auto &laneTable = GetEventLaneTable();
+    auto it = laneTable.find(eventId);
+    if (it == laneTable.end()) {
+        return CellularCallEventLane::NORMAL;
+    }
+    return it->second;
+}
+
+CellularCallHandler::Priority CellularCallHandler::GetEventPriority(uint32_t eventId)
+{
+    switch (GetEventLane(eventId)) {
+        case CellularCallEventLane::IMMEDIATE:
+            return Priority::IMMEDIATE;
+        case CellularCallEventLane::HIGH:
+            return Priority::HIGH;
+        case CellularCallEventLane::IDLE:
+            return Priority::IDLE;
+        default:
+            return Priority::LOW;
+    }
+}
+
+bool CellularCallHandler::SendLaneEvent(
+    const std::shared_ptr<AppExecFwk::EventHandler> &handler, AppExecFwk::InnerEvent::Pointer &event)
+{
+    if (handler == nullptr || event == nullptr) {
+        return false;
+    }
+    auto cellularCallHandler = std::dynamic_pointer_cast<CellularCallHandler>(handler);
+    if (cellularCallHandler == nullptr) {
+        return TelEventHandler::SendTelEvent(handler, event);
+    }
+    uint32_t eventId = event->GetInnerEventId();
+    if (cellularCallHandler->ShouldShedEvent(eventId)) {
+        return true;
+    }
+    return cellularCallHandler->SendEvent(event, 0, GetEventPriority(eventId));
+}
+
+bool CellularCallHandler::SendLaneEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler, uint32_t eventId)
+{
+    AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(eventId);
+    return SendLaneEvent(handler, event);
+}
+
+bool CellularCallHandler::ShouldShedEvent(uint32_t eventId)
+{
+    if (!queueWatchdog_.IsBackpressure()) {
+        return false;
+    }
+    // a pending network state change covers the new one. Idle lane reports are per call and never shed, their
+    // telemetry queue keeps the latest one of every call instead
+    bool isSheddable = eventId == NETWORK_STATE_CHANGED && HasInnerEvent(NETWORK_STATE_CHANGED);
+    if (isSheddable) {
+        queueWatchdog_.RecordShed(eventId);
+    }
+    return isSheddable;
+}
+
+int64_t CellularCallHandler::RecordQueueWait(uint32_t eventId, const AppExecFwk::InnerEvent::Pointer &event)
+{
+    AppExecFwk::InnerEvent::TimePoint handleTime = event->GetHandleTime();
+    if (handleTime.time_since_epoch().count() == 0) {
+        return -1;
+    }
+    int64_t waitMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        AppExecFwk::InnerEvent::Clock::now() - handleTime).count();
+    waitMs = std::max<int64_t>(waitMs, 0);
+    int32_t lane = static_cast<int32_t>(GetEventLane(eventId));
+    int32_t bucket = 0;
+    while (bucket < EVENT_WAIT_BUCKET_NUM - 1 && waitMs > EVENT_WAIT_BUCKET_BOUNDS_MS[bucket]) {
+        bucket++;
+    }
+    laneWaitHistogram_[lane][bucket].fetch_add(1, std::memory_order_relaxed);
+    uint64_t wait = static_cast<uint64_t>(waitMs);
+    uint64_t maxWait = laneMaxWaitMs_[lane].load(std::memory_order_relaxed);
+    while (wait > maxWait && !laneMaxWaitMs_[lane].compare_exchange_weak(maxWait, wait, std::memory_order_relaxed)) {
+    }
+    if (waitMs >= EVENT_WAIT_LOG_THRESHOLD_MS) {
+        TELEPHONY_LOGW("[slot%{public}d] eventId:%{public}d lane:%{public}d waited %{public}lld ms", slotId_,
+            eventId, lane, static_cast<long long>(waitMs));
+    }
+    return waitMs;
+}
+
+void CellularCallHandler::GetLaneWaitStats(CellularCallEventLane lane, EventLaneWaitStats &stats)
+{
+    stats = EventLaneWaitStats();
+    if (lane < CellularCallEventLane::IMMEDIATE || lane >= CellularCallEventLane::LANE_BUTT) {
+        return;
+    }
+    int32_t index = static_cast<int32_t>(lane);
+    for (int32_t i = 0; i < EVENT_WAIT_BUCKET_NUM; i++) {
+        stats.histogram[i] = laneWaitHistogram_[index][i].load(std::memory_order_relaxed);
+        stats.count += stats.histogram[i];
+    }
+    stats.maxWaitMs = laneMaxWaitMs_[index].load(std::memory_order_relaxed);
+}
+
+void CellularCallHandler::InitTelemetryQueues()
+{
+    int32_t configLimit = GetIntParameter(TELEMETRY_QUEUE_LIMIT_KEY, 0);
+    bool isConfigValid = configLimit > 0 && configLimit <= static_cast<int32_t>(TELEMETRY_QUEUE_MAX_LIMIT);
+    const std::pair<uint32_t, bool> telemetryEvents[] = {
+        { RadioEvent::RADIO_CALL_PEER_DIMENSIONS_CHANGED, true },
+        { RadioEvent::RADIO_CALL_DATA_USAGE_CHANGED, true },
+        { RadioEvent::RADIO_CAMERA_CAPABILITIES_CHANGED, true },
+        { RadioEvent::RADIO_CALL_SESSION_EVENT_CHANGED, false },
+    };
+    std::lock_guard<ffrt::mutex> lock(telemetryMutex_);
+    for (const auto &it : telemetryEvents) {
+        TelemetryQueue &queue = telemetryQueues_[it.first];
+        queue.collapse = it.second;
+        queue.limit = it.second ? TELEMETRY_STATE_QUEUE_LIMIT : TELEMETRY_EVENT_QUEUE_LIMIT;
+        if (isConfigValid) {
+            queue.limit = static_cast<uint32_t>(configLimit);
+        }
+    }
+}
+
+bool CellularCallHandler::SendTelemetryEvent(
+    const std::shared_ptr<AppExecFwk::EventHandler> &handler, int32_t callIndex, AppExecFwk::InnerEvent::Pointer &event)
+{
+    if (handler == nullptr || event == nullptr) {
+        return false;
+    }
+    auto cellularCallHandler = std::dynamic_pointer_cast<CellularCallHandler>(handler);
+    if (cellularCallHandler == nullptr) {
+        return SendLaneEvent(handler, event);
+    }
+    return cellularCallHandler->EnqueueTelemetryEvent(callIndex, event);
+}
+
+bool CellularCallHandler::EnqueueTelemetryEvent(int32_t callIndex, AppExecFwk::InnerEvent::Pointer &event)
+{
+    uint32_t eventId = event->GetInnerEventId();
+    if (ShouldShedEvent(eventId)) {
+        return true;
+    }
+    {
+        std::lock_guard<ffrt::mutex> lock(telemetryMutex_);
+        auto it = telemetryQueues_.find(eventId);
+        if (it == telemetryQueues_.end()) {
+            return SendEvent(event, 0, GetEventPriority(eventId));
+        }
+        TelemetryQueue &queue = it->second;
+        queue.enqueued++;
+        if (queue.collapse) {
+            auto item = std::find_if(queue.items.begin(), queue.items.end(),
+                [callIndex](const auto &pending) { return pending.first == callIndex; });
+            if (item != queue.items.end()) {
+                item->second = std::move(event);
+                queue.collapsed++;
+                return true;
+            }
+        }
+        if (queue.items.size() >= queue.limit) {
+            queue.items.pop_front();
+            queue.dropped++;
+            TELEPHONY_LOGD("[slot%{public}d] telemetry eventId:%{public}u full, dropped:%{public}llu", slotId_,
+                eventId, static_cast<unsigned long long>(queue.dropped));
+        }
+        queue.items.emplace_back(callIndex, std::move(event));
+        if (queue.drainPosted) {
+            return true;
+        }
+        queue.drainPosted = true;
+    }
+    // one drain event per queue, so the event queue never holds more than {limit} reports of one type
+    AppExecFwk::InnerEvent::Pointer drainEvent =
+        AppExecFwk::InnerEvent::Get(TELEMETRY_DRAIN_ID, static_cast<int64_t>(eventId));
+    if (SendEvent(drainEvent, 0, GetEventPriority(eventId))) {
+        return true;
+    }
+    std::lock_guard<ffrt::mutex> lock(telemetryMutex_);
+    telemetryQueues_[eventId].drainPosted = false;
+    return false;
+}
+
+void CellularCallHandler::HandleTelemetryDrain(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    uint32_t eventId = static_cast<uint32_t>(event->GetParam());
+    std::deque<std::pair<int32_t, AppExecFwk::InnerEvent::Pointer>> items;
+    {
+        std::lock_guard<ffrt::mutex> lock(telemetryMutex_);
+        auto it = telemetryQueues_.find(eventId);
+        if (it == telemetryQueues_.end()) {
+            return;
+        }
+        items.swap(it->second.items);
+        it->second.drainPosted = false;
+    }
+    auto itFunc = requestFuncMap_.find(eventId);
+    if (itFunc == requestFuncMap_.end() || itFunc->second == nullptr) {
+        return;
+    }
+    for (const auto &item : items) {
+        itFunc->second(item.second);
+    }
+}
+
+int32_t CellularCallHandler::SetTelemetryQueueLimit(uint32_t eventId, uint32_t limit)
+{
+    if (limit == 0 || limit > TELEMETRY_QUEUE_MAX_LIMIT) {
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    std::lock_guard<ffrt::mutex> lock(telemetryMutex_);
+    auto it = telemetryQueues_.find(eventId);
+    if (it == telemetryQueues_.end()) {
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    TelemetryQueue &queue = it->second;
+    queue.limit = limit;
+    while (queue.items.size() > queue.limit) {
+        queue.items.pop_front();
+        queue.dropped++;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+void CellularCallHandler::GetTelemetryQueueStats(std::vector<TelemetryQueueStats> &stats)
+{
+    stats.clear();
+    std::lock_guard<ffrt::mutex> lock(telemetryMutex_);
+    for (const auto &it : telemetryQueues_) {
+        TelemetryQueueStats item;
+        item.eventId = it.first;
+        item.limit = it.second.limit;
+        item.pending = static_cast<uint32_t>(it.second.items.size());
+        item.enqueued = it.second.enqueued;
+        item.collapsed = it.second.collapsed;
+        item.dropped = it.second.dropped;
+        stats.push_back(item);
+    }
+}
+
+CellularCallQueueWatchdog &CellularCallHandler::GetQueueWatchdog()
+{
+    return queueWatchdog_;
+}
+
+std::shared_ptr<CellularCallTimerWheel> CellularCallHandler::GetTimerWheel()
+{
+    return timerWheel_;
+}
+
+CellularCallClock::TimerId CellularCallHandler::SendPostDialEvent(
+    const std::shared_ptr<PostDialData> &postDial, int64_t delayMs)
+{
+    std::weak_ptr<AppExecFwk::EventHandler> weak = weak_from_this();
+    return timerWheel_->Arm([weak, postDial]() {
+        auto handler = weak.lock();
+        if (handler != nullptr) {
+            handler->SendEvent(EVENT_EXECUTE_POST_DIAL, postDial);
+        }
+    }, delayMs);
+}
+
 void CellularCallHandler::RegisterImsCallCallbackHandler()
 {
     // Register IMS
@@ -315,22 +637,23 @@ void CellularCallHandler::ProcessEvent(const AppExecFwk::InnerEvent::Pointer &ev
 
     uint32_t eventId = event->GetInnerEventId();
     TELEPHONY_LOGD("[slot%{public}d] eventId = %{public}d", slotId_, eventId);
+    int64_t waitMs = RecordQueueWait(eventId, event);
+    int64_t startMs = CellularCallClock::GetInstance()->NowMs();
 
     auto itFunc = requestFuncMap_.find(event->GetInnerEventId());
-    if (itFunc != requestFuncMap_.end()) {
-        auto requestFunc = itFunc->second;
-        if (requestFunc != nullptr) {
-            return requestFunc(event);
-        }
+    if (itFunc != requestFuncMap_.end() && itFunc->second != nullptr) {
+        itFunc->second(event);
+    } else {
+        TELEPHONY_LOGI("[slot%{public}d] Function not found, need check.", slotId_);
     }
-    TELEPHONY_LOGI("[slot%{public}d] Function not found, need check.", slotId_);
+    int64_t endMs = CellularCallClock::GetInstance()->NowMs();
+    queueWatchdog_.OnDispatch(eventId, waitMs, endMs - startMs, endMs);
 }
 
 void CellularCallHandler::OnReceiveEvent(const EventFwk::CommonEventData &data)
 {
     EventFwk::Want want = data.GetWant();
     std::string action = want.GetAction();
-    auto operatorState = std::make_shared<int32_t>();
     TELEPHONY_LOGI("[slot%{public}d] action=%{public}s code=%{public}d", slotId_, action.c_str(), data.GetCode());
     if (action == EventFwk::CommonEventSupport::COMMON_EVENT_OPERATOR_CONFIG_CHANGED) {
         int32_t slotId = want.GetIntParam(BROADCAST_ARG_SLOT_ID, DEFAULT_SIM_SLOT_ID);
@@ -338,16 +661,15 @@ void CellularCallHandler::OnReceiveEvent(const EventFwk::CommonEventData &data)
         if (slotId_ != slotId) {
             return;
         }
-        *operatorState = state;
-        TELEPHONY_LOGI("[slot%{public}d] state=%{public}d", slotId_, *operatorState);
-        this->SendEvent(OPERATOR_CONFIG_CHANGED_ID, operatorState, DELAY_TIME);
+        TELEPHONY_LOGI("[slot%{public}d] state=%{public}d", slotId_, state);
+        DebounceBroadcast(OPERATOR_CONFIG_CHANGED_ID, state);
     }
     if (action == EventFwk::CommonEventSupport::COMMON_EVENT_NETWORK_STATE_CHANGED) {
         int32_t slotId = want.GetIntParam(BROADCAST_ARG_SLOT_ID, DEFAULT_SIM_SLOT_ID);
         if (slotId_ != slotId) {
             return;
         }
-        this->SendEvent(NETWORK_STATE_CHANGED, 0, Priority::HIGH);
+        DebounceBroadcast(NETWORK_STATE_CHANGED, 0);
     }
 #ifdef BASE_POWER_IMPROVEMENT_FEATURE
     if (action == ENTER_STR_TELEPHONY_NOTIFY) {
@@ -363,6 +685,77 @@ void CellularCallHandler::OnReceiveEvent(const EventFwk::CommonEventData &data)
 #endif
 }
 
+void CellularCallHandler::DebounceBroadcast(uint32_t eventId, int32_t param)
+{
+    int64_t nowMs = CellularCallClock::GetInstance()->NowMs();
+    std::unique_lock<ffrt::mutex> lock(debounceMutex_);
+    BroadcastDebounce &debounce = debounces_[eventId];
+    debounce.stats.eventId = eventId;
+    debounce.stats.received++;
+    bool isQuiet = !debounce.isPending && (debounce.lastMs < 0 || nowMs - debounce.lastMs >= BROADCAST_SETTLE_MS);
+    debounce.lastMs = nowMs;
+    if (isQuiet) {
+        debounce.stats.leading++;
+        lock.unlock();
+        DispatchBroadcast(eventId, param);
+        return;
+    }
+    if (debounce.isPending) {
+        debounce.stats.coalesced++;
+    } else {
+        debounce.isPending = true;
+        debounce.firstPendingMs = nowMs;
+    }
+    debounce.param = param;
+    int64_t delayMs = std::min(BROADCAST_SETTLE_MS, debounce.firstPendingMs + BROADCAST_MAX_DEFER_MS - nowMs);
+    std::weak_ptr<AppExecFwk::EventHandler> weak = weak_from_this();
+    debounce.timer = timerWheel_->ArmScoped([weak, eventId]() {
+        auto handler = std::static_pointer_cast<CellularCallHandler>(weak.lock());
+        if (handler != nullptr) {
+            handler->FlushBroadcast(eventId);
+        }
+    }, std::max<int64_t>(delayMs, 0));
+}
+
+void CellularCallHandler::FlushBroadcast(uint32_t eventId)
+{
+    int32_t param = 0;
+    {
+        std::lock_guard<ffrt::mutex> lock(debounceMutex_);
+        BroadcastDebounce &debounce = debounces_[eventId];
+        if (!debounce.isPending) {
+            return;
+        }
+        debounce.isPending = false;
+        debounce.lastMs = CellularCallClock::GetInstance()->NowMs();
+        debounce.stats.trailing++;
+        param = debounce.param;
+    }
+    DispatchBroadcast(eventId, param);
+}
+
+void CellularCallHandler::DispatchBroadcast(uint32_t eventId, int32_t param)
+{
+    if (eventId == OPERATOR_CONFIG_CHANGED_ID) {
+        auto operatorState = std::make_shared<int32_t>(param);
+        CellularCallClock::GetInstance()->SendEvent(
+            shared_from_this(), OPERATOR_CONFIG_CHANGED_ID, operatorState, DELAY_TIME);
+        return;
+    }
+    if (eventId == NETWORK_STATE_CHANGED && !ShouldShedEvent(NETWORK_STATE_CHANGED)) {
+        this->SendEvent(NETWORK_STATE_CHANGED, 0, GetEventPriority(NETWORK_STATE_CHANGED));
+    }
+}
+
+void CellularCallHandler::GetBroadcastDebounceStats(std::vector<BroadcastDebounceStats> &stats)
+{
+    stats.clear();
+    std::lock_guard<ffrt::mutex> lock(debounceMutex_);
+    for (const auto &it : debounces_) {
+        stats.push_back(it.second.stats);
+    }
+}
+
 #ifdef BASE_POWER_IMPROVEMENT_FEATURE
 bool CellularCallHandler::IsCellularCallExist()
 {
@@ -396,12 +789,12 @@ void CellularCallHandler::ProcessFinishCommonEvent()
 
 void CellularCallHandler::GetCsCallData(const AppExecFwk::InnerEvent::Pointer &event)
 {
-    this->SendEvent(GET_CS_CALL_DATA_ID, 0, Priority::HIGH);
+    this->SendEvent(GET_CS_CALL_DATA_ID, 0, GetEventPriority(GET_CS_CALL_DATA_ID));
 }
 
 void CellularCallHandler::GetImsCallData(const AppExecFwk::InnerEvent::Pointer &event)
 {
-    this->SendEvent(GET_IMS_CALL_DATA_ID, 0, Priority::HIGH);
+    this->SendEvent(GET_IMS_CALL_DATA_ID, 0, GetEventPriority(GET_IMS_CALL_DATA_ID));
 }
 
 void CellularCallHandler::CellularCallIncomingStartTrace(const int32_t state)
@@ -638,7 +1031,7 @@ void CellularCallHandler::DialResponse(const AppExecFwk::InnerEvent::Pointer &ev
 #ifdef CELLULAR_CALL_SATELLITE
 void CellularCallHandler::GetSatelliteCallData(const AppExecFwk::InnerEvent::Pointer &event)
 {
-    this->SendEvent(GET_SATELLITE_CALL_DATA_ID, 0, Priority::HIGH);
+    this->SendEvent(GET_SATELLITE_CALL_DATA_ID, 0, GetEventPriority(GET_SATELLITE_CALL_DATA_ID));
 }
 
 void CellularCallHandler::DialSatelliteResponse(const AppExecFwk::InnerEvent::Pointer &event)
@@ -880,7 +1273,7 @@ void CellularCallHandler::SendDtmfResponse(const AppExecFwk::InnerEvent::Pointer
     std::shared_ptr<PostDialData> postDial = std::make_shared<PostDialData>();
     postDial->callId = result->flag;
     postDial->isIms = event->GetParam() == static_cast<int32_t>(CallType::TYPE_IMS);
-    this->SendEvent(EVENT_EXECUTE_POST_DIAL, postDial, DELAY_TIME);
+    SendPostDialEvent(postDial, DELAY_TIME);
 
     CellularCallEventInfo eventInfo;
     eventInfo.eventType = CellularCallEventType::EVENT_REQUEST_RESULT_TYPE;
@@ -1129,6 +1522,8 @@ void CellularCallHandler::HandleImsSuppExtResponse(const AppExecFwk::InnerEvent:
 void CellularCallHandler::SetSlotId(int32_t id)
 {
     slotId_ = id;
+    queueWatchdog_.SetSlotId(id);
+    timerWheel_->SetSlotId(id);
 }
 
 int32_t CellularCallHandler::GetSlotId()
@@ -1341,6 +1736,8 @@ void CellularCallHandler::GetEmergencyCallListResponse(const AppExecFwk::InnerEv
         TELEPHONY_LOGE("[slot%{public}d] eccList is null", slotId_);
         return;
     }
+    // the queried list replaces the chunks still assembled
+    eccAssembler_.Reset();
     CellularCallConfig config;
     config.UpdateEmergencyCallFromRadio(slotId_, *eccList);
 }
@@ -1444,19 +1841,56 @@ void CellularCallHandler::ReportEccChanged(const AppExecFwk::InnerEvent::Pointer
         TELEPHONY_LOGE("[slot%{public}d] emergencyInfoList is null", slotId_);
         return;
     }
-    CellularCallConfig config;
-    auto calls = emergencyInfoList->calls;
-    if (calls.size() > 0 && static_cast<uint32_t>(calls.back().total) != calls.size()) {
+    EmergencyInfoList eccList;
+    bool isNewAssembly = false;
+    EccAssemblyResult result =
+        eccAssembler_.AddChunk(*emergencyInfoList, CellularCallClock::GetInstance()->NowMs(), eccList, isNewAssembly);
+    if (result == EccAssemblyResult::INVALID) {
         TELEPHONY_LOGE("[slot%{public}d] data error", slotId_);
-        auto endCall = calls.back();
-        if (endCall.index < endCall.total) {
-            return;
+        RequeryEccList(std::vector<EccIndexRange>());
+        return;
+    }
+    if (result == EccAssemblyResult::PARTIAL) {
+        if (isNewAssembly) {
+            CellularCallClock::GetInstance()->SendEvent(shared_from_this(), ECC_ASSEMBLY_TIMEOUT_ID,
+                ECC_ASSEMBLY_TIMEOUT_MS);
         }
-        TELEPHONY_LOGI("[slot%{public}d] try query", slotId_);
-        config.GetEmergencyCallList(slotId_);
         return;
     }
-    config.UpdateEmergencyCallFromRadio(slotId_, *emergencyInfoList);
+    CellularCallConfig config;
+    config.UpdateEmergencyCallFromRadio(slotId_, eccList);
+}
+
+void CellularCallHandler::HandleEccAssemblyTimeout(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    // an assembly completed or restarted since the event was sent is not dropped
+    std::vector<EccIndexRange> missing;
+    if (!eccAssembler_.CheckTimeout(CellularCallClock::GetInstance()->NowMs(), missing)) {
+        return;
+    }
+    TELEPHONY_LOGE("[slot%{public}d] ecc list timeout, missing ranges:%{public}d", slotId_,
+        static_cast<int32_t>(missing.size()));
+    RequeryEccList(missing);
+}
+
+void CellularCallHandler::RequeryEccList(const std::vector<EccIndexRange> &missing)
+{
+    for (const auto &range : missing) {
+        TELEPHONY_LOGI("[slot%{public}d] ecc list missing %{public}d-%{public}d", slotId_, range.begin, range.end);
+    }
+    if (!eccAssembler_.TryRequery(CellularCallClock::GetInstance()->NowMs())) {
+        TELEPHONY_LOGI("[slot%{public}d] ecc list query in flight", slotId_);
+        return;
+    }
+    // the radio interface has no ranged query, the whole list is queried again
+    TELEPHONY_LOGI("[slot%{public}d] try query", slotId_);
+    CellularCallConfig config;
+    config.GetEmergencyCallList(slotId_);
+}
+
+void CellularCallHandler::GetEccAssemblyStats(EccAssemblyStats &stats)
+{
+    eccAssembler_.GetStats(stats);
 }
 
 void CellularCallHandler::SrvccStateCompleted()
@@ -1884,6 +2318,17 @@ void CellularCallHandler::HandleOperatorConfigChanged(const AppExecFwk::InnerEve
     config.HandleOperatorConfigChanged(slotId_, *state);
 }
 
+void CellularCallHandler::HandleOperatorConfigParsed(const AppExecFwk::InnerEvent::Pointer &event)
+{
+    auto result = event->GetSharedObject<OperatorConfigParseResult>();
+    if (result == nullptr || result->slotId != slotId_) {
+        TELEPHONY_LOGE("[slot%{public}d] parse result is invalid", slotId_);
+        return;
+    }
+    CellularCallConfig config;
+    config.ApplyImsConfiguration(*result);
+}
+
 void CellularCallHandler::UpdateRsrvccStateReport(const AppExecFwk::InnerEvent::Pointer &event)
 {
     isDuringRSRVCC_ = true;
@@ -1908,8 +2353,29 @@ void CellularCallHandler::SaveSsRequestCommand(const std::shared_ptr<SsRequestCo
         return;
     }
     int32_t indexCommand = indexCommand_;
+    std::weak_ptr<AppExecFwk::EventHandler> weakHandler = weak_from_this();
+    std::weak_ptr<SsRequestCommand> weakCommand = utCommand;
     std::lock_guard<std::mutex> lock(mutex_);
-    utCommandMap_.insert(std::make_pair(indexCommand, utCommand));
+    utCommandMap_[indexCommand] = utCommand;
+    utCommandTimers_[indexCommand] = timerWheel_->ArmScoped([weakHandler, weakCommand, indexCommand]() {
+        auto handler = std::static_pointer_cast<CellularCallHandler>(weakHandler.lock());
+        if (handler != nullptr) {
+            handler->RemoveTimedOutSsRequestCommand(indexCommand, weakCommand);
+        }
+    }, SS_REQUEST_TIMEOUT_MS);
+}
+
+void CellularCallHandler::RemoveTimedOutSsRequestCommand(
+    int32_t index, const std::weak_ptr<SsRequestCommand> &utCommand)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto itor = utCommandMap_.find(index);
+    if (itor == utCommandMap_.end() || itor->second != utCommand.lock()) {
+        return;
+    }
+    TELEPHONY_LOGW("[slot%{public}d] the ss request(%{public}d) is not answered, drop it", slotId_, index);
+    utCommandMap_.erase(itor);
+    utCommandTimers_.erase(index);
 }
 
 int32_t CellularCallHandler::ConfirmAndRemoveSsRequestCommand(int32_t index, int32_t &flag)
@@ -1927,6 +2393,7 @@ int32_t CellularCallHandler::ConfirmAndRemoveSsRequestCommand(int32_t index, int
     }
     flag = itor->second->flag;
     utCommandMap_.erase(index);
+    utCommandTimers_.erase(index);
     return TELEPHONY_SUCCESS;
 }
 
@@ -1946,6 +2413,7 @@ int32_t CellularCallHandler::ConfirmAndRemoveSsRequestCommand(int32_t index, int
     flag = itor->second->flag;
     action = itor->second->action;
     utCommandMap_.erase(index);
+    utCommandTimers_.erase(index);
     return TELEPHONY_SUCCESS;
 }
 
@@ -2108,7 +2576,8 @@ void CellularCallHandler::NvCfgFinishedIndication(const AppExecFwk::InnerEvent::
         TELEPHONY_LOGE("[slot%{public}d] NvCfgFinishedIndication no simcard", slotId_);
         return;
     }
-    bool isUseCloudImsNV = system::GetBoolParameter(KEY_CONST_TELEPHONY_IS_USE_CLOUD_IMS_NV, true);
+    bool isUseCloudImsNV = DelayedSingleton<CellularCallParameterCache>::GetInstance()->GetBool(
+        KEY_CONST_TELEPHONY_IS_USE_CLOUD_IMS_NV, true);
     TELEPHONY_LOGI("[slot%{public}d] entry, isUseCloudImsNV = %{public}d", slotId_, isUseCloudImsNV);
     if (isUseCloudImsNV && GetImsCapabilities(slotId_) == TELEPHONY_ERR_SUCCESS) {
         TELEPHONY_LOGI("[slot%{public}d] GetImsCapabilities success", slotId_);
@@ -2161,7 +2630,7 @@ void CellularCallHandler::UpdateImsConfiguration()
     }
     CellularCallConfig config;
     TELEPHONY_LOGI("[slot%{public}d] UpdateImsConfiguration", slotId_);
-    config.UpdateImsConfiguration(slotId_, INVALID_OPERATOR_CONFIG_STATE, false);
+    config.UpdateImsConfigurationAsync(slotId_, INVALID_OPERATOR_CONFIG_STATE, false);
 }
 
 void CellularCallHandler::GetImsSwitchStatusRequest()
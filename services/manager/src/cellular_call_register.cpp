@@ -44,8 +44,8 @@ void CellularCallRegister::ReportCallsInfo(const CallsReportInfo &callsReportInf
         detailInfo.rttChannelId = (*it).rttChannelId;
     }
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportCallsInfo return, callManagerCallBack_ is nullptr, report fail!");
         if (detailInfo.state == TelCallState::CALL_STATUS_INCOMING) {
             FinishAsyncTrace(HITRACE_TAG_OHOS, "CellularCallIncoming", getpid());
@@ -59,7 +59,7 @@ void CellularCallRegister::ReportCallsInfo(const CallsReportInfo &callsReportInf
             static_cast<int32_t>(detailInfo.callType), static_cast<int32_t>(detailInfo.callMode));
         FinishAsyncTrace(HITRACE_TAG_OHOS, "CellularCallIncoming", getpid());
     }
-    callManagerCallBack_->UpdateCallsReportInfo(callsReportInfo);
+    callback->UpdateCallsReportInfo(callsReportInfo);
 }
 
 int32_t CellularCallRegister::RegisterCallManagerCallBack(const sptr<ICallStatusCallback> &callback)
@@ -75,12 +75,12 @@ void CellularCallRegister::ReportSingleCallInfo(const CallReportInfo &info, TelC
     TELEPHONY_LOGD("ReportSingleCallInfo entry");
     CallReportInfo cellularCallReportInfo = info;
     cellularCallReportInfo.state = callState;
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportSingleCallInfo return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateCallReportInfo(cellularCallReportInfo);
+    callback->UpdateCallReportInfo(cellularCallReportInfo);
 }
 
 int32_t CellularCallRegister::UnRegisterCallManagerCallBack()
@@ -94,58 +94,58 @@ int32_t CellularCallRegister::UnRegisterCallManagerCallBack()
 void CellularCallRegister::ReportEventResultInfo(const CellularCallEventInfo &info)
 {
     TELEPHONY_LOGI("ReportEventResultInfo entry eventId:%{public}d", info.eventId);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportEventResultInfo return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateEventResultInfo(info);
+    callback->UpdateEventResultInfo(info);
 }
 
 void CellularCallRegister::ReportGetWaitingResult(const CallWaitResponse &response)
 {
     TELEPHONY_LOGI("ReportGetWaitingResult result:%{public}d, status:%{public}d, class:%{public}d", response.result,
         response.status, response.classCw);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportGetWaitingResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateGetWaitingResult(response);
+    callback->UpdateGetWaitingResult(response);
 }
 
 void CellularCallRegister::ReportSetWaitingResult(int32_t result)
 {
     TELEPHONY_LOGI("ReportSetWaitingResult result:%{public}d", result);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportSetWaitingResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateSetWaitingResult(result);
+    callback->UpdateSetWaitingResult(result);
 }
 
 void CellularCallRegister::ReportGetRestrictionResult(const CallRestrictionResponse &response)
 {
     TELEPHONY_LOGI("ReportGetRestrictionResult result:%{public}d, status:%{public}d, class:%{public}d",
         response.result, response.status, response.classCw);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportGetRestrictionResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateGetRestrictionResult(response);
+    callback->UpdateGetRestrictionResult(response);
 }
 
 void CellularCallRegister::ReportSetRestrictionResult(int32_t result)
 {
     TELEPHONY_LOGI("ReportSetRestrictionResult result:%{public}d", result);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportSetRestrictionResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateSetRestrictionResult(result);
+    callback->UpdateSetRestrictionResult(result);
 }
 
 void CellularCallRegister::ReportGetTransferResult(const CallTransferResponse &response)
@@ -154,139 +154,139 @@ void CellularCallRegister::ReportGetTransferResult(const CallTransferResponse &r
         response.status, response.classx);
     TELEPHONY_LOGI("ReportGetTransferResult type:%{public}d, reason:%{public}d, time:%{public}d",
         response.type, response.reason, response.time);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportGetTransferResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateGetTransferResult(response);
+    callback->UpdateGetTransferResult(response);
 }
 
 void CellularCallRegister::ReportSetBarringPasswordResult(int32_t result)
 {
     TELEPHONY_LOGI("Set barring password result:%{public}d", result);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateSetRestrictionPasswordResult(result);
+    callback->UpdateSetRestrictionPasswordResult(result);
 }
 
 void CellularCallRegister::ReportSetTransferResult(int32_t result)
 {
     TELEPHONY_LOGI("ReportSetTransferResult result:%{public}d", result);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportSetTransferResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateSetTransferResult(result);
+    callback->UpdateSetTransferResult(result);
 }
 
 void CellularCallRegister::ReportGetClipResult(const ClipResponse &response)
 {
     TELEPHONY_LOGI("ReportGetClipResult result:%{public}d, action:%{public}d, stat:%{public}d", response.result,
         response.action, response.clipStat);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportGetClipResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateGetCallClipResult(response);
+    callback->UpdateGetCallClipResult(response);
 }
 
 void CellularCallRegister::ReportGetClirResult(const ClirResponse &response)
 {
     TELEPHONY_LOGI("ReportGetClirResult result:%{public}d, action:%{public}d, stat:%{public}d", response.result,
         response.action, response.clirStat);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportGetClirResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateGetCallClirResult(response);
+    callback->UpdateGetCallClirResult(response);
 }
 
 void CellularCallRegister::ReportSetClirResult(int32_t result)
 {
     TELEPHONY_LOGI("ReportSetClirResult result:%{public}d", result);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportSetClirResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateSetCallClirResult(result);
+    callback->UpdateSetCallClirResult(result);
 }
 
 void CellularCallRegister::ReportGetImsConfigResult(const GetImsConfigResponse &response)
 {
     TELEPHONY_LOGI("ReportGetImsConfigResult entry, value:%{public}d", response.value);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportGetImsConfigResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->GetImsConfigResult(response);
+    callback->GetImsConfigResult(response);
 }
 
 void CellularCallRegister::ReportSetImsConfigResult(int32_t result)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportSetImsConfigResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->SetImsConfigResult(result);
+    callback->SetImsConfigResult(result);
 }
 
 void CellularCallRegister::ReportSetImsFeatureResult(int32_t result)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportSetImsFeatureResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->SetImsFeatureValueResult(result);
+    callback->SetImsFeatureValueResult(result);
 }
 
 void CellularCallRegister::ReportGetImsFeatureResult(const GetImsFeatureValueResponse &response)
 {
     TELEPHONY_LOGI("ReportGetImsFeatureResult entry, value:%{public}d", response.value);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportGetImsFeatureResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->GetImsFeatureValueResult(response);
+    callback->GetImsFeatureValueResult(response);
 }
 
 void CellularCallRegister::ReportCallRingBackResult(int32_t status)
 {
     TELEPHONY_LOGI("ReportCallRingBackResult entry");
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportCallRingBackResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateRBTPlayInfo(static_cast<RBTPlayInfo>(status));
+    callback->UpdateRBTPlayInfo(static_cast<RBTPlayInfo>(status));
 }
 
 void CellularCallRegister::ReportCallFailReason(const DisconnectedDetails &details)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportCallFailReason return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->UpdateDisconnectedCause(details);
+    callback->UpdateDisconnectedCause(details);
 }
 
 void CellularCallRegister::ReportGetMuteResult(const MuteControlResponse &response)
 {
     TELEPHONY_LOGI("ReportGetMuteResult entry result:%{public}d, value:%{public}d", response.result, response.value);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportMuteResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
@@ -300,83 +300,83 @@ void CellularCallRegister::ReportSetMuteResult(const MuteControlResponse &respon
 void CellularCallRegister::ReportInviteToConferenceResult(int32_t result)
 {
     TELEPHONY_LOGI("ReportInviteToConferenceResult entry result:%{public}d", result);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportInviteToConferenceResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->InviteToConferenceResult(result);
+    callback->InviteToConferenceResult(result);
 }
 
 void CellularCallRegister::ReportGetCallDataResult(int32_t result)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportGetCallDataResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->GetImsCallDataResult(result);
+    callback->GetImsCallDataResult(result);
 }
 
 void CellularCallRegister::ReportStartDtmfResult(int32_t result)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportStartDtmfResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->StartDtmfResult(result);
+    callback->StartDtmfResult(result);
 }
 
 void CellularCallRegister::ReportStopDtmfResult(int32_t result)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportStopDtmfResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->StopDtmfResult(result);
+    callback->StopDtmfResult(result);
 }
 
 void CellularCallRegister::ReportStartRttResult(int32_t result)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportStartRttResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->StartRttResult(result);
+    callback->StartRttResult(result);
 }
 
 void CellularCallRegister::ReportStopRttResult(int32_t result)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportStopRttResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->StopRttResult(result);
+    callback->StopRttResult(result);
 }
 
 void CellularCallRegister::ReportSendUssdResult(int32_t result)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportSendUssdResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->SendUssdResult(result);
+    callback->SendUssdResult(result);
 }
 
 void CellularCallRegister::ReportMmiCodeResult(const MmiCodeInfo &info)
 {
     TELEPHONY_LOGI("ReportMmiCodeResult entry result:%{public}d, value:%{public}s", info.result, info.message);
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportMmiCodeResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->SendMmiCodeResult(info);
+    callback->SendMmiCodeResult(info);
 }
 
 void CellularCallRegister::ReportSetEmergencyCallListResponse(const SetEccListResponse &response)
@@ -385,6 +385,12 @@ void CellularCallRegister::ReportSetEmergencyCallListResponse(const SetEccListRe
         response.value);
 }
 
+sptr<ICallStatusCallback> CellularCallRegister::GetCallManagerCallBack()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return callManagerCallBack_;
+}
+
 bool CellularCallRegister::IsCallManagerCallBackRegistered()
 {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -393,39 +399,39 @@ bool CellularCallRegister::IsCallManagerCallBackRegistered()
 
 void CellularCallRegister::ReportCloseUnFinishedUssdResult(int32_t result)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportCloseUnFinishedUssdResult return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->CloseUnFinishedUssdResult(result);
+    callback->CloseUnFinishedUssdResult(result);
 }
 
 void CellularCallRegister::ReportPostDialChar(char c)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportPostDialChar return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
     std::string nextDtmf(CHAR_LENG, c);
-    callManagerCallBack_->ReportPostDialChar(nextDtmf);
+    callback->ReportPostDialChar(nextDtmf);
 }
 
 void CellularCallRegister::ReportPostDialDelay(std::string str)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReportPostDialChar return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
-    callManagerCallBack_->ReportPostDialDelay(str);
+    callback->ReportPostDialDelay(str);
 }
 
 void CellularCallRegister::ReceiveUpdateCallMediaModeRequest(int32_t slotId, ImsCallModeReceiveInfo &callModeInfo)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReceiveUpdateCallMediaModeRequest return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
@@ -435,13 +441,13 @@ void CellularCallRegister::ReceiveUpdateCallMediaModeRequest(int32_t slotId, Ims
     response.slotId = slotId;
     ImsCallMode callMode = ConverToImsCallMode(callModeInfo.callType);
     response.callMode = callMode;
-    callManagerCallBack_->ReceiveUpdateCallMediaModeRequest(response);
+    callback->ReceiveUpdateCallMediaModeRequest(response);
 }
 
 void CellularCallRegister::ReceiveUpdateCallMediaModeResponse(int32_t slotId, ImsCallModeReceiveInfo &callModeInfo)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReceiveUpdateCallMediaModeResponse return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
@@ -451,26 +457,26 @@ void CellularCallRegister::ReceiveUpdateCallMediaModeResponse(int32_t slotId, Im
     ImsCallMode callMode = ConverToImsCallMode(callModeInfo.callType);
     response.callMode = callMode;
     response.slotId = slotId;
-    callManagerCallBack_->ReceiveUpdateCallMediaModeResponse(response);
+    callback->ReceiveUpdateCallMediaModeResponse(response);
 }
 
 void CellularCallRegister::HandleCallSessionEventChanged(ImsCallSessionEventInfo &callSessionEventInfo)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("HandleCallSessionEventChanged return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
     CallSessionReportInfo response;
     response.index = callSessionEventInfo.callIndex;
     response.eventId = static_cast<CallSessionEventId>(callSessionEventInfo.eventType);
-    callManagerCallBack_->HandleCallSessionEventChanged(response);
+    callback->HandleCallSessionEventChanged(response);
 }
 
 void CellularCallRegister::HandlePeerDimensionsChanged(ImsCallPeerDimensionsInfo &callPeerDimensionsInfo)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("HandlePeerDimensionsChanged return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
@@ -478,24 +484,24 @@ void CellularCallRegister::HandlePeerDimensionsChanged(ImsCallPeerDimensionsInfo
     response.index = callPeerDimensionsInfo.callIndex;
     response.width = callPeerDimensionsInfo.width;
     response.height = callPeerDimensionsInfo.height;
-    callManagerCallBack_->HandlePeerDimensionsChanged(response);
+    callback->HandlePeerDimensionsChanged(response);
 }
 
 void CellularCallRegister::HandleCallDataUsageChanged(ImsCallDataUsageInfo &callDataUsageInfo)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("HandleCallDataUsageChanged return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
     int64_t response = callDataUsageInfo.dataUsage;
-    callManagerCallBack_->HandleCallDataUsageChanged(response);
+    callback->HandleCallDataUsageChanged(response);
 }
 
 void CellularCallRegister::HandleCameraCapabilitiesChanged(CameraCapabilitiesInfo &cameraCapabilitiesInfo)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("HandleCameraCapabilitiesChanged return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
@@ -503,13 +509,13 @@ void CellularCallRegister::HandleCameraCapabilitiesChanged(CameraCapabilitiesInf
     response.index = cameraCapabilitiesInfo.callIndex;
     response.width = cameraCapabilitiesInfo.width;
     response.height = cameraCapabilitiesInfo.height;
-    callManagerCallBack_->HandleCameraCapabilitiesChanged(response);
+    callback->HandleCameraCapabilitiesChanged(response);
 }
 
 void CellularCallRegister::HandleImsSuppExtResponse(ImsSuppExtInfo &imsSuppExtInfo)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("HandleImsSuppExtResponse return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
@@ -517,14 +523,14 @@ void CellularCallRegister::HandleImsSuppExtResponse(ImsSuppExtInfo &imsSuppExtIn
     suppExtInfo.slotId = imsSuppExtInfo.slotId;
     suppExtInfo.code = imsSuppExtInfo.code;
     suppExtInfo.callIndex = imsSuppExtInfo.callId;
-    callManagerCallBack_->HandleImsSuppExtChanged(suppExtInfo);
+    callback->HandleImsSuppExtChanged(suppExtInfo);
 }
 
 #ifdef SUPPORT_RTT_CALL
 void CellularCallRegister::ReceiveUpdateCallRttEvtResponse(int32_t slotId, ImsCallRttEventInfo &rttEvtInfo)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReceiveUpdateCallRttEvtResponse return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
@@ -533,13 +539,13 @@ void CellularCallRegister::ReceiveUpdateCallRttEvtResponse(int32_t slotId, ImsCa
     info.eventType = rttEvtInfo.eventType;
     info.reason = rttEvtInfo.reason;
     info.slotId = slotId;
-    callManagerCallBack_->HandleRttEvtChanged(info);
+    callback->HandleRttEvtChanged(info);
 }
 
 void CellularCallRegister::ReceiveUpdateCallRttErrResponse(int32_t slotId, ImsCallRttErrorInfo &rttErrInfo)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (callManagerCallBack_ == nullptr) {
+    sptr<ICallStatusCallback> callback = GetCallManagerCallBack();
+    if (callback == nullptr) {
         TELEPHONY_LOGE("ReceiveUpdateCallRttErrResponse return, callManagerCallBack_ is nullptr, report fail!");
         return;
     }
@@ -549,7 +555,7 @@ void CellularCallRegister::ReceiveUpdateCallRttErrResponse(int32_t slotId, ImsCa
     info.causeCode = rttErrInfo.causeCode;
     info.reasonText = rttErrInfo.reasonText;
     info.slotId = slotId;
-    callManagerCallBack_->HandleRttErrReport(info);
+    callback->HandleRttErrReport(info);
 }
 #endif
 
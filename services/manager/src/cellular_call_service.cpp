@@ -14,9 +14,11 @@
  */
 
 #include "cellular_call_service.h"
+#include <algorithm>
 #include <shared_mutex>
 
 #include "cellular_call_callback.h"
+#include "cellular_call_clock.h"
 #include "cellular_call_dump_helper.h"
 #include "cellular_call_hisysevent.h"
 #include "common_event.h"
@@ -38,18 +40,30 @@
 
 namespace OHOS {
 namespace Telephony {
-const uint32_t CONNECT_MAX_TRY_COUNT = 20;
-const uint32_t CONNECT_CORE_SERVICE_WAIT_TIME = 2000; // ms
+const uint32_t CORE_SERVICE_INIT_MAX_RETRY_COUNT = 400;
+const int64_t CORE_SERVICE_INIT_RETRY_TIME = 100; // ms
+static constexpr const char *STARTUP_STAGE_INIT = "Init";
+static constexpr const char *STARTUP_STAGE_CORE_SERVICE = "CoreService";
 const uint32_t TELEPHONY_SATELLITE_SYS_ABILITY_ID = 4012;
 #ifdef BASE_POWER_IMPROVEMENT_FEATURE
 constexpr const char *PERMISSION_STARTUP_COMPLETED = "ohos.permission.RECEIVER_STARTUP_COMPLETED";
 #endif
+static constexpr const char *CELLULAR_CALL_HANDLER_NAME = "CellularCallHandler";
 bool g_registerResult =
     SystemAbility::MakeAndRegisterAbility(DelayedSingleton<CellularCallService>::GetInstance().get());
 
+static int64_t GetCurrentTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
 CellularCallService::CellularCallService() : SystemAbility(TELEPHONY_CELLULAR_CALL_SYS_ABILITY_ID, true)
 {
     state_ = ServiceRunningState::STATE_STOPPED;
+    for (int32_t slotId = 0; slotId < SIM_SLOT_COUNT; slotId++) {
+        slotContexts_.push_back(std::make_unique<SlotContext>());
+    }
 }
 
 CellularCallService::~CellularCallService()
@@ -64,14 +78,51 @@ CellularCallService::~CellularCallService()
 bool CellularCallService::Init()
 {
     TELEPHONY_LOGD("CellularCallService::Init start");
-#ifdef OHOS_BUILD_ENABLE_TELEPHONY_EXT
-    TELEPHONY_EXT_WRAPPER.InitTelephonyExtWrapper();
-#endif
-    CreateHandler();
-    SendEventRegisterHandler();
     for (int32_t i = DEFAULT_SIM_SLOT_ID; i < SIM_SLOT_COUNT; ++i) {
         isRadioOn_.insert(std::pair<int, bool>(i, false));
     }
+    CellularCallStartupOrchestrator orchestrator(STARTUP_STAGE_INIT);
+#ifdef OHOS_BUILD_ENABLE_TELEPHONY_EXT
+    orchestrator.AddPhase("ExtWrapper", []() { TELEPHONY_EXT_WRAPPER.InitTelephonyExtWrapper(); });
+    // the handlers call into the ext wrapper once core service reports to them
+    std::vector<std::string> coreServiceDependencies = { "Handler", "ExtWrapper" };
+#else
+    std::vector<std::string> coreServiceDependencies = { "Handler" };
+#endif
+    orchestrator.AddPhase("Handler", [this]() { CreateHandler(); });
+    orchestrator.AddPhase("CoreService", [this]() { SubscribeCoreService(); }, coreServiceDependencies);
+    orchestrator.AddPhase("CallManager", [this]() { SubscribeCallManager(); });
+    // connect ims_service, its callbacks are dispatched to the handlers registered by CreateHandler
+    orchestrator.AddPhase(
+        "ImsClient", []() { DelayedSingleton<ImsCallClient>::GetInstance()->Init(); }, { "Handler" });
+    orchestrator.AddPhase("EccListener", [this]() { RegisterEccListener(); });
+    if (orchestrator.Run() != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("CellularCallService::Init, startup phases invalid");
+        return false;
+    }
+    RecordStartupStage(orchestrator);
+    TELEPHONY_LOGD("CellularCallService::Init, init success");
+    return true;
+}
+
+void CellularCallService::SubscribeCoreService()
+{
+    auto samgrProxy = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
+    coreServiceListener_ = new (std::nothrow) SystemAbilityStatusChangeListener();
+    int32_t coreServiceRet = TELEPHONY_ERR_FAIL;
+    if (samgrProxy != nullptr && coreServiceListener_ != nullptr) {
+        coreServiceRet =
+            samgrProxy->SubscribeSystemAbility(TELEPHONY_CORE_SERVICE_SYS_ABILITY_ID, coreServiceListener_);
+    }
+    TELEPHONY_LOGI("SubscribeSystemAbility TELEPHONY_CORE_SERVICE_SYS_ABILITY_ID result:%{public}d", coreServiceRet);
+    if (coreServiceRet != TELEPHONY_SUCCESS) {
+        // without the notification check core service on the handler until it is ready
+        SendEventRegisterHandler();
+    }
+}
+
+void CellularCallService::SubscribeCallManager()
+{
     auto samgrProxy = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
     callManagerListener_ = new (std::nothrow) SystemAbilityStatusChangeListener();
     if (samgrProxy == nullptr || callManagerListener_ == nullptr) {
@@ -80,19 +131,37 @@ bool CellularCallService::Init()
         int32_t ret = samgrProxy->SubscribeSystemAbility(TELEPHONY_CALL_MANAGER_SYS_ABILITY_ID, callManagerListener_);
         TELEPHONY_LOGI("SubscribeSystemAbility TELEPHONY_CALL_MANAGER_SYS_ABILITY_ID result:%{public}d", ret);
     }
-    // connect ims_service
-    DelayedSingleton<ImsCallClient>::GetInstance()->Init();
-    TELEPHONY_LOGD("CellularCallService::Init, init success");
-    RegisterEccListener();
-    return true;
+}
+
+void CellularCallService::RecordStartupStage(const CellularCallStartupOrchestrator &orchestrator)
+{
+    std::vector<StartupPhaseInfo> phases;
+    orchestrator.GetPhases(phases);
+    std::string summary;
+    for (const auto &phase : phases) {
+        summary.append(phase.name).append(":").append(std::to_string(phase.startMs)).append("+")
+            .append(std::to_string(phase.costMs)).append(";");
+    }
+    TELEPHONY_LOGI("startup stage %{public}s spend %{public}lld ms, phases %{public}s",
+        orchestrator.GetStage().c_str(), static_cast<long long>(orchestrator.GetTotalCostMs()), summary.c_str());
+    CellularCallHiSysEvent::WriteStartupBehaviorEvent(orchestrator.GetStage(), orchestrator.GetTotalCostMs(), summary);
+    std::lock_guard<ffrt::mutex> lock(startupMutex_);
+    startupPhases_.erase(std::remove_if(startupPhases_.begin(), startupPhases_.end(),
+        [&orchestrator](const StartupPhaseInfo &phase) { return phase.stage == orchestrator.GetStage(); }),
+        startupPhases_.end());
+    startupPhases_.insert(startupPhases_.end(), phases.begin(), phases.end());
+}
+
+void CellularCallService::GetStartupPhases(std::vector<StartupPhaseInfo> &phases)
+{
+    std::lock_guard<ffrt::mutex> lock(startupMutex_);
+    phases = startupPhases_;
 }
 
 void CellularCallService::OnStart()
 {
     TELEPHONY_LOGD("CellularCallService OnStart");
-    bindTime_ =
-        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
-            .count();
+    bindTime_ = GetCurrentTimeMs();
     if (state_ == ServiceRunningState::STATE_RUNNING) {
         TELEPHONY_LOGE("CellularCallService::OnStart return, has already started.");
         return;
@@ -106,9 +175,7 @@ void CellularCallService::OnStart()
     if (!ret) {
         TELEPHONY_LOGE("CellularCallService::OnStart Publish failed!");
     }
-    endTime_ =
-        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
-            .count();
+    publishTime_ = GetCurrentTimeMs();
     TELEPHONY_LOGD("CellularCallService start success.");
 }
 
@@ -120,21 +187,46 @@ void CellularCallService::OnStop()
     HandlerResetUnRegister();
 }
 
+void CellularCallService::OnCoreServiceReady()
+{
+    int64_t expected = 0L;
+    if (coreServiceReadyTime_.compare_exchange_strong(expected, GetCurrentTimeMs())) {
+        TELEPHONY_LOGI("core service ready after %{public}lld ms",
+            static_cast<long long>(coreServiceReadyTime_.load() - bindTime_));
+    }
+    if (isCoreServiceRegistered_.load()) {
+        return;
+    }
+    SendEventRegisterHandler();
+}
+
 void CellularCallService::RegisterHandler()
 {
-    TELEPHONY_LOGI("connect core service Register Handler start");
-    networkSearchCallBack_ = (std::make_unique<CellularCallCallback>()).release();
-    for (uint32_t i = 0; i < CONNECT_MAX_TRY_COUNT; i++) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(CONNECT_CORE_SERVICE_WAIT_TIME));
-        if (CoreManagerInner::GetInstance().IsInitFinished()) {
-            TELEPHONY_LOGI("connect core service Register Handler start");
-            RegisterCoreServiceHandler();
-            CoreManagerInner::GetInstance().RegisterCellularCallObject(networkSearchCallBack_);
-            break;
+    if (isCoreServiceRegistered_.load() || isCoreServiceRegistering_) {
+        TELEPHONY_LOGI("core service Register Handler already done");
+        return;
+    }
+    if (!CoreManagerInner::GetInstance().IsInitFinished()) {
+        // core service is published before its init finishes, check again shortly without blocking the queue
+        if (coreServiceRetryCount_++ < CORE_SERVICE_INIT_MAX_RETRY_COUNT) {
+            SendEventRegisterHandler(CORE_SERVICE_INIT_RETRY_TIME);
+        } else {
+            TELEPHONY_LOGE("connect core service Register Handler not init, give up");
         }
-        TELEPHONY_LOGW("connect core service Register Handler null or not init");
+        return;
     }
-    TELEPHONY_LOGI("connect core service Register Handler end");
+    TELEPHONY_LOGI("connect core service Register Handler start");
+    networkSearchCallBack_ = (std::make_unique<CellularCallCallback>()).release();
+    isCoreServiceRegistering_ = RegisterCoreServiceHandler();
+}
+
+void CellularCallService::OnCoreServiceHandlerRegistered()
+{
+    CoreManagerInner::GetInstance().RegisterCellularCallObject(networkSearchCallBack_);
+    isCoreServiceRegistered_.store(true);
+    endTime_ = GetCurrentTimeMs();
+    TELEPHONY_LOGI("connect core service Register Handler end, startup spend %{public}lld ms",
+        static_cast<long long>(endTime_.load() - bindTime_));
 }
 
 void CellularCallService::SubscribeToEvents(const std::vector<std::string>& events, int priority,
@@ -157,13 +249,17 @@ void CellularCallService::SubscribeToEvents(const std::vector<std::string>& even
     }
 
     for (const auto &it : slotVector) {
-        auto handler = std::make_shared<CellularCallHandler>(subscriberInfo);
+        auto handler =
+            std::make_shared<CellularCallHandler>(subscriberInfo, CELLULAR_CALL_HANDLER_NAME + std::to_string(it));
         TELEPHONY_LOGI("setSlotId:%{public}d", it);
         handler->SetSlotId(it);
         handler->RegisterImsCallCallbackHandler();
-        {
-            std::unique_lock<std::mutex> lock(handlerMapMutex_);
-            handlerMap_.insert(std::make_pair(it, handler));
+        SlotContext *context = GetSlotContext(it);
+        if (context != nullptr) {
+            std::lock_guard<std::mutex> lock(context->mutex);
+            if (context->handler == nullptr) {
+                context->handler = handler;
+            }
         }
         auto samgrProxy = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
         if (samgrProxy == nullptr) {
@@ -209,13 +305,12 @@ void CellularCallService::StartOrderEventSubscriber()
 void CellularCallService::HandlerResetUnRegister()
 {
     TELEPHONY_LOGI("HandlerResetUnRegister");
-    std::unique_lock<std::mutex> lock(handlerMapMutex_);
-    for (const auto &it : handlerMap_) {
-        int32_t slot = it.first;
-        auto handler = it.second;
-        if (handler != nullptr) {
-            handler.reset();
+    for (int32_t slot = 0; slot < static_cast<int32_t>(slotContexts_.size()); slot++) {
+        auto handler = GetHandler(slot);
+        if (handler == nullptr) {
+            continue;
         }
+        handler.reset();
         CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
         coreInner.UnRegisterCoreNotify(slot, handler, RadioEvent::RADIO_AVAIL);
         coreInner.UnRegisterCoreNotify(slot, handler, RadioEvent::RADIO_NOT_AVAIL);
@@ -241,59 +336,75 @@ void CellularCallService::HandlerResetUnRegister()
     }
 }
 
-void CellularCallService::RegisterCoreServiceHandler()
+bool CellularCallService::RegisterCoreServiceHandler()
 {
     TELEPHONY_LOGI("RegisterCoreServiceHandle");
-    std::unique_lock<std::mutex> lock(handlerMapMutex_, std::defer_lock);
-    lock.lock();
-    for (const auto &it : handlerMap_) {
-        int32_t slot = it.first;
-        auto handler = it.second;
-        if (handler != nullptr) {
-            CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_AVAIL, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_NOT_AVAIL, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_SIM_STATE_CHANGE, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_SIM_RECORDS_LOADED, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_SIM_ACCOUNT_LOADED, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_STATUS_INFO, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_USSD_NOTICE, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_SS_NOTICE, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_EMERGENCY_NUMBER_REPORT, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_RINGBACK_VOICE, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_SRVCC_STATUS, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_RSRVCC_STATUS, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_RESIDENT_NETWORK_CHANGE, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_RIL_ADAPTER_HOST_DIED, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_FACTORY_RESET, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_NV_REFRESH_FINISHED, nullptr);
-            coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_STATE_CHANGED, nullptr);
-            coreInner.GetRadioState(slot, RadioEvent::RADIO_GET_STATUS, handler);
-        }
-        lock.unlock();
+    auto orchestrator = std::make_shared<CellularCallStartupOrchestrator>(STARTUP_STAGE_CORE_SERVICE);
+    orchestrator->AddPhase("ConfigInit", []() {
         CellularCallConfig config;
         config.InitModeActive();
-        if (config.GetDomainPreferenceMode(slot) != TELEPHONY_SUCCESS) {
-            TELEPHONY_LOGW("RegisterCoreServiceHandler, GetDomainPreferenceMode request fail");
-        }
-        if (config.GetEmergencyCallList(it.first) != TELEPHONY_SUCCESS) {
-            TELEPHONY_LOGW("RegisterCoreServiceHandler, GetEmergencyCallList request fail");
-        }
-        lock.lock();
+    });
+    // every slot registers to its own handler, the slots do not wait for each other
+    for (int32_t slot = 0; slot < static_cast<int32_t>(slotContexts_.size()); slot++) {
+        orchestrator->AddPhase(
+            "Slot" + std::to_string(slot), [this, slot]() { RegisterSlotCoreServiceHandler(slot); }, { "ConfigInit" });
+    }
+    // called on the handler of the default slot, so the phases are not waited for
+    int32_t ret = orchestrator->RunAsync([this, orchestrator]() {
+        RecordStartupStage(*orchestrator);
+        OnCoreServiceHandlerRegistered();
+    });
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("RegisterCoreServiceHandler, startup phases invalid");
+        return false;
+    }
+    return true;
+}
+
+void CellularCallService::RegisterSlotCoreServiceHandler(int32_t slot)
+{
+    auto handler = GetHandler(slot);
+    if (handler == nullptr) {
+        return;
+    }
+    CoreManagerInner &coreInner = CoreManagerInner::GetInstance();
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_AVAIL, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_NOT_AVAIL, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_SIM_STATE_CHANGE, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_SIM_RECORDS_LOADED, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_SIM_ACCOUNT_LOADED, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_STATUS_INFO, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_USSD_NOTICE, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_SS_NOTICE, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_EMERGENCY_NUMBER_REPORT, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_RINGBACK_VOICE, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_SRVCC_STATUS, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_CALL_RSRVCC_STATUS, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_RESIDENT_NETWORK_CHANGE, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_RIL_ADAPTER_HOST_DIED, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_FACTORY_RESET, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_NV_REFRESH_FINISHED, nullptr);
+    coreInner.RegisterCoreNotify(slot, handler, RadioEvent::RADIO_STATE_CHANGED, nullptr);
+    coreInner.GetRadioState(slot, RadioEvent::RADIO_GET_STATUS, handler);
+    CellularCallConfig config;
+    if (config.GetDomainPreferenceMode(slot) != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGW("RegisterCoreServiceHandler, GetDomainPreferenceMode request fail");
+    }
+    if (config.GetEmergencyCallList(slot) != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGW("RegisterCoreServiceHandler, GetEmergencyCallList request fail");
     }
 }
 
-void CellularCallService::SendEventRegisterHandler()
+void CellularCallService::SendEventRegisterHandler(int64_t delayTime)
 {
-    int64_t delayTime = 1000;
     int32_t slot = DEFAULT_SIM_SLOT_ID;
-    std::unique_lock<std::mutex> lock(handlerMapMutex_);
-    auto handler = handlerMap_[slot];
+    auto handler = GetHandler(slot);
     if (handler == nullptr) {
         TELEPHONY_LOGE("SendEventRegisterHandler return, handler is nullptr");
         return;
     }
-    handler->SendEvent(handler->REGISTER_HANDLER_ID, delayTime, CellularCallHandler::Priority::HIGH);
+    CellularCallClock::GetInstance()->SendEvent(
+        handler, handler->REGISTER_HANDLER_ID, delayTime, CellularCallHandler::Priority::HIGH);
 }
 
 int32_t CellularCallService::Dump(int32_t fd, const std::vector<std::u16string> &args)
@@ -335,18 +446,34 @@ std::string CellularCallService::GetBindTime()
 std::string CellularCallService::GetEndTime()
 {
     std::ostringstream oss;
-    oss << endTime_;
+    oss << endTime_.load();
     return oss.str();
 }
 
 std::string CellularCallService::GetSpendTime()
 {
-    spendTime_ = endTime_ - bindTime_;
+    // the startup is not finished until the handlers are registered to core service
+    int64_t endTime = endTime_.load();
+    spendTime_ = endTime > bindTime_ ? endTime - bindTime_ : 0L;
     std::ostringstream oss;
     oss << spendTime_;
     return oss.str();
 }
 
+std::string CellularCallService::GetPublishTime()
+{
+    std::ostringstream oss;
+    oss << publishTime_;
+    return oss.str();
+}
+
+std::string CellularCallService::GetCoreServiceReadyTime()
+{
+    std::ostringstream oss;
+    oss << coreServiceReadyTime_.load();
+    return oss.str();
+}
+
 int32_t CellularCallService::Dial(const CellularCallInfo &callInfo)
 {
     if (!IsValidSlotId(callInfo.slotId)) {
@@ -1139,61 +1266,71 @@ int32_t CellularCallService::GetCallTransferInfo(int32_t slotId, CallTransferTyp
 
 std::shared_ptr<CSControl> CellularCallService::GetCsControl(int32_t slotId)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!IsValidSlotId(slotId)) {
+    SlotContext *context = GetSlotContext(slotId);
+    if (context == nullptr) {
         TELEPHONY_LOGE("return nullptr, invalid slot id");
         return nullptr;
     }
-    return csControlMap_[slotId];
+    std::lock_guard<std::mutex> lock(context->mutex);
+    return context->csControl;
 }
 
 std::shared_ptr<IMSControl> CellularCallService::GetImsControl(int32_t slotId)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!IsValidSlotId(slotId)) {
+    SlotContext *context = GetSlotContext(slotId);
+    if (context == nullptr) {
         TELEPHONY_LOGE("return nullptr, invalid slot id");
         return nullptr;
     }
-    return imsControlMap_[slotId];
+    std::lock_guard<std::mutex> lock(context->mutex);
+    return context->imsControl;
 }
 
 #ifdef CELLULAR_CALL_SATELLITE
 std::shared_ptr<SatelliteControl> CellularCallService::GetSatelliteControl(int32_t slotId)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return satelliteControlMap_[slotId];
+    SlotContext *context = GetSlotContext(slotId);
+    if (context == nullptr) {
+        TELEPHONY_LOGE("return nullptr, invalid slot id");
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(context->mutex);
+    return context->satelliteControl;
 }
 #endif // CELLULAR_CALL_SATELLITE
 
 void CellularCallService::SetCsControl(int32_t slotId, const std::shared_ptr<CSControl> &csControl)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!IsValidSlotId(slotId)) {
+    SlotContext *context = GetSlotContext(slotId);
+    if (context == nullptr) {
         TELEPHONY_LOGE("invalid slot id, return");
         return;
     }
-    csControlMap_[slotId] = csControl;
+    std::lock_guard<std::mutex> lock(context->mutex);
+    context->csControl = csControl;
 }
 
 void CellularCallService::SetImsControl(int32_t slotId, const std::shared_ptr<IMSControl> &imsControl)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!IsValidSlotId(slotId)) {
+    SlotContext *context = GetSlotContext(slotId);
+    if (context == nullptr) {
         TELEPHONY_LOGE("invalid slot id, return");
         return;
     }
-    imsControlMap_[slotId] = imsControl;
+    std::lock_guard<std::mutex> lock(context->mutex);
+    context->imsControl = imsControl;
 }
 
 #ifdef CELLULAR_CALL_SATELLITE
 void CellularCallService::SetSatelliteControl(int32_t slotId, const std::shared_ptr<SatelliteControl> &satelliteControl)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!IsValidSlotId(slotId)) {
+    SlotContext *context = GetSlotContext(slotId);
+    if (context == nullptr) {
         TELEPHONY_LOGE("invalid slot id, return");
         return;
     }
-    satelliteControlMap_[slotId] = satelliteControl;
+    std::lock_guard<std::mutex> lock(context->mutex);
+    context->satelliteControl = satelliteControl;
 }
 #endif // CELLULAR_CALL_SATELLITE
 
@@ -1432,8 +1569,20 @@ bool CellularCallService::IsNeedIms(int32_t slotId) const
 
 std::shared_ptr<CellularCallHandler> CellularCallService::GetHandler(int32_t slotId)
 {
-    std::unique_lock<std::mutex> lock(handlerMapMutex_);
-    return handlerMap_[slotId];
+    SlotContext *context = GetSlotContext(slotId);
+    if (context == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(context->mutex);
+    return context->handler;
+}
+
+CellularCallService::SlotContext *CellularCallService::GetSlotContext(int32_t slotId) const
+{
+    if (!IsValidSlotId(slotId) || slotId >= static_cast<int32_t>(slotContexts_.size())) {
+        return nullptr;
+    }
+    return slotContexts_[slotId].get();
 }
 
 int32_t CellularCallService::ControlCamera(int32_t slotId, int32_t index, const std::string &cameraId)
@@ -1675,6 +1824,15 @@ CellularCallService::SystemAbilityStatusChangeListener::SystemAbilityStatusChang
 void CellularCallService::SystemAbilityStatusChangeListener::OnAddSystemAbility(
     int32_t systemAbilityId, const std::string &deviceId)
 {
+    if (systemAbilityId == TELEPHONY_CORE_SERVICE_SYS_ABILITY_ID) {
+        auto cellularCallService = DelayedSingleton<CellularCallService>::GetInstance();
+        if (cellularCallService == nullptr) {
+            TELEPHONY_LOGE("cellularCallService is nullptr");
+            return;
+        }
+        cellularCallService->OnCoreServiceReady();
+        return;
+    }
     if (systemAbilityId != COMMON_EVENT_SERVICE_ID && systemAbilityId != TELEPHONY_SATELLITE_SYS_ABILITY_ID) {
         TELEPHONY_LOGE("systemAbilityId is not COMMON_EVENT_SERVICE_ID or TELEPHONY_SATELLITE_SYS_ABILITY_ID");
         return;
@@ -17,6 +17,8 @@
 
 #include "call_manager_errors.h"
 #include "call_status_callback_proxy.h"
+#include "cellular_call_clock.h"
+#include "cellular_call_ipc_metrics.h"
 #include "emergency_utils.h"
 #include "ipc_skeleton.h"
 #include "i_call_status_callback.h"
@@ -50,7 +52,13 @@ int32_t CellularCallStub::OnRemoteRequest(
         }
         auto requestFunc = itFunc->second;
         if (requestFunc != nullptr) {
-            return requestFunc(data, reply);
+            std::shared_ptr<CellularCallClock> clock = CellularCallClock::GetInstance();
+            int64_t startTime = clock->NowUs();
+            int32_t result = requestFunc(data, reply);
+            int64_t cost = clock->NowUs() - startTime;
+            DelayedRefSingleton<CellularCallIpcMetrics>::GetInstance().Record(
+                IpcDirection::CALL_MANAGER_INBOUND, code, result, data.GetDataSize() + reply.GetDataSize(), cost);
+            return result;
         }
     }
     TELEPHONY_LOGI("CellularCallStub::OnRemoteRequest, default case, need check.");
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_CLOCK_H
+#define TELEPHONY_CELLULAR_CALL_CLOCK_H
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "event_handler.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief Source of time and of every delayed work of cellular call.
+ *
+ * The service uses the steady clock, tests install a virtual clock with {SetInstance} to run
+ * timing dependent scenarios without waiting for the real time to pass.
+ */
+class CellularCallClock : public std::enable_shared_from_this<CellularCallClock> {
+public:
+    static constexpr int64_t CLOCK_US_PER_MS = 1000;
+    using TimerId = uint64_t;
+    using Task = std::function<void()>;
+    using Predicate = std::function<bool()>;
+
+    virtual ~CellularCallClock() = default;
+
+    static std::shared_ptr<CellularCallClock> GetInstance();
+
+    /**
+     * @brief Replace the clock used by the service, nullptr restores the steady clock
+     */
+    static void SetInstance(const std::shared_ptr<CellularCallClock> &clock);
+
+    /**
+     * @brief Get the monotonic time in milliseconds
+     */
+    virtual int64_t NowMs() = 0;
+
+    /**
+     * @brief Get the monotonic time in microseconds, derived from {NowMs} unless the clock is finer
+     */
+    virtual int64_t NowUs()
+    {
+        return NowMs() * CLOCK_US_PER_MS;
+    }
+
+    /**
+     * @brief Run a task on a worker after a delay
+     *
+     * @return the id used to cancel the task, 0 on failure
+     */
+    virtual TimerId PostDelayed(const Task &task, int64_t delayMs) = 0;
+
+    /**
+     * @brief Cancel a task posted by {PostDelayed}
+     *
+     * @return Returns true when the task was not run yet
+     */
+    virtual bool Cancel(TimerId timerId) = 0;
+
+    virtual void SleepMs(int64_t delayMs) = 0;
+
+    /**
+     * @brief Wait on {cv} until {predicate} is true or the timeout elapses
+     *
+     * @return the value of {predicate} when the wait ends
+     */
+    virtual bool WaitFor(std::unique_lock<std::mutex> &lock, std::condition_variable &cv, int64_t timeoutMs,
+        const Predicate &predicate) = 0;
+
+    /**
+     * @brief Send an event to a handler after a delay
+     *
+     * @return Returns true on success
+     */
+    virtual bool SendEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler,
+        AppExecFwk::InnerEvent::Pointer &event, int64_t delayMs,
+        AppExecFwk::EventHandler::Priority priority = AppExecFwk::EventHandler::Priority::LOW) = 0;
+
+    template<typename T>
+    bool SendEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler, uint32_t eventId,
+        const std::shared_ptr<T> &object, int64_t delayMs)
+    {
+        AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(eventId, object);
+        return SendEvent(handler, event, delayMs);
+    }
+
+    bool SendEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler, uint32_t eventId, int64_t delayMs,
+        AppExecFwk::EventHandler::Priority priority = AppExecFwk::EventHandler::Priority::LOW)
+    {
+        AppExecFwk::InnerEvent::Pointer event = AppExecFwk::InnerEvent::Get(eventId);
+        return SendEvent(handler, event, delayMs, priority);
+    }
+};
+
+/**
+ * @brief The clock of the service, delayed work runs on ffrt and delayed events on the handler queue.
+ */
+class SteadyCellularCallClock : public CellularCallClock {
+public:
+    int64_t NowMs() override;
+    int64_t NowUs() override;
+    TimerId PostDelayed(const Task &task, int64_t delayMs) override;
+    bool Cancel(TimerId timerId) override;
+    void SleepMs(int64_t delayMs) override;
+    bool WaitFor(std::unique_lock<std::mutex> &lock, std::condition_variable &cv, int64_t timeoutMs,
+        const Predicate &predicate) override;
+    bool SendEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler, AppExecFwk::InnerEvent::Pointer &event,
+        int64_t delayMs, AppExecFwk::EventHandler::Priority priority) override;
+    using CellularCallClock::SendEvent;
+
+private:
+    ffrt::mutex mutex_;
+    TimerId nextTimerId_ = 1;
+    std::map<TimerId, ffrt::task_handle> timers_;
+};
+
+/**
+ * @brief Deterministic clock for tests, the time only moves on {AdvanceMs}, {SleepMs} and timed out
+ * {WaitFor}. Due tasks and delayed events run on the thread moving the time, in deadline order.
+ */
+class VirtualCellularCallClock : public CellularCallClock {
+public:
+    int64_t NowMs() override;
+    TimerId PostDelayed(const Task &task, int64_t delayMs) override;
+    bool Cancel(TimerId timerId) override;
+    void SleepMs(int64_t delayMs) override;
+    bool WaitFor(std::unique_lock<std::mutex> &lock, std::condition_variable &cv, int64_t timeoutMs,
+        const Predicate &predicate) override;
+    bool SendEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler, AppExecFwk::InnerEvent::Pointer &event,
+        int64_t delayMs, AppExecFwk::EventHandler::Priority priority) override;
+    using CellularCallClock::SendEvent;
+
+    /**
+     * @brief Move the time forward and run every task that becomes due
+     */
+    void AdvanceMs(int64_t deltaMs);
+
+    size_t GetPendingCount();
+
+private:
+    bool RunNextTimer(int64_t limitMs);
+
+    struct Timer {
+        TimerId timerId = 0;
+        Task task = nullptr;
+    };
+
+    std::mutex mutex_;
+    int64_t nowMs_ = 0;
+    TimerId nextTimerId_ = 1;
+    // keyed by the deadline, timers with the same deadline run in posting order
+    std::multimap<int64_t, Timer> timers_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_CLOCK_H
@@ -16,9 +16,14 @@
 #ifndef CELLULAR_CALL_CONFIG_H
 #define CELLULAR_CALL_CONFIG_H
 
+#include <atomic>
+#include <functional>
 #include <map>
-#include <shared_mutex>
+#include <memory>
+#include <unordered_map>
 
+#include "cellular_call_ecc_merger.h"
+#include "cellular_call_ecc_plmn_lru.h"
 #include "config_request.h"
 #include "global_params_data.h"
 #include "operator_config_types.h"
@@ -29,6 +34,158 @@
 namespace OHOS {
 namespace Telephony {
 constexpr int32_t INVALID_OPERATOR_CONFIG_STATE = -1;
+
+/**
+ * @brief Vendor disconnect reason mapped by {KEY_IMS_CALL_DISCONNECT_REASONINFO_MAPPING_STRING_ARRAY}, whose
+ * entries are written "reason|message" or "reason|message|mappedReason".
+ */
+struct DisconnectReasonMapping {
+    std::string message;
+    bool hasReason = false;
+    int32_t reason = 0;
+};
+
+using DisconnectReasonTable = std::unordered_map<int32_t, DisconnectReasonMapping>;
+
+/**
+ * @brief Operator config values used by cellular call, parsed off the handler and never modified afterwards.
+ */
+struct OperatorConfigSnapshot {
+    std::map<std::string, bool> boolValues;
+    bool hasNrModeSupportedList = false;
+    std::vector<int32_t> nrModeSupportedList;
+    bool hasCallWaitingServiceClass = false;
+    int32_t callWaitingServiceClass = 0;
+    bool hasDisconnectReasonMapping = false;
+    std::vector<std::string> disconnectReasonMapping;
+    std::shared_ptr<const DisconnectReasonTable> disconnectReasonTable = nullptr;
+};
+
+/**
+ * @brief Groups of operator config values, a group is only pushed to its consumers when one of its values changed.
+ */
+enum OperatorConfigChange : uint32_t {
+    OPERATOR_CONFIG_CHANGE_NONE = 0,
+    // switch, volte, vonr, ut and gba values the ims capabilities are computed from
+    OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY = 1u << 0,
+    OPERATOR_CONFIG_CHANGE_CARRIER_VT = 1u << 1,
+    OPERATOR_CONFIG_CHANGE_VIDEO_CALL_WAITING = 1u << 2,
+    // values only read on the call path
+    OPERATOR_CONFIG_CHANGE_CALL_POLICY = 1u << 3,
+    OPERATOR_CONFIG_CHANGE_DISCONNECT_MAPPING = 1u << 4,
+    OPERATOR_CONFIG_CHANGE_ALL = 0xFFFFFFFFu,
+};
+
+struct OperatorConfigCacheStats {
+    uint64_t parses = 0;
+    uint64_t parseHits = 0;
+    uint64_t applies = 0;
+    uint64_t unchangedApplies = 0;
+    uint32_t lastChanges = OPERATOR_CONFIG_CHANGE_NONE;
+};
+
+enum class EccListSource : int32_t {
+    UNKNOWN = 0,
+    MEMORY,
+    DISK_CACHE,
+    DATABASE,
+    OPERATOR_CONFIG,
+};
+
+/**
+ * @brief Time from an ECC list update request to the right list pushed to the modem.
+ */
+struct EccReadyStats {
+    // steady time of the oldest request not served yet, 0 when none is pending
+    int64_t requestTimeMs = 0;
+    // the first list of the slot after the service started
+    int64_t bootReadyCostMs = -1;
+    int64_t lastReadyCostMs = -1;
+    EccListSource lastSource = EccListSource::UNKNOWN;
+    uint64_t readyCount = 0;
+};
+
+struct OperatorConfigParseResult {
+    int32_t slotId = 0;
+    int32_t configState = INVALID_OPERATOR_CONFIG_STATE;
+    bool isOpcChanged = false;
+    uint64_t generation = 0;
+    uint64_t fingerprint = 0;
+    std::shared_ptr<const OperatorConfigSnapshot> snapshot = nullptr;
+};
+
+/**
+ * @brief Per slot configuration read on the call path: operator flags, switches, domain preference, network
+ * state and the merged ECC list.
+ *
+ * A published snapshot is never modified. A writer copies the current one, changes the copy and publishes it
+ * with the next version, so a reader gets a consistent view of one slot without taking any lock.
+ */
+struct SlotConfig {
+    uint64_t version = 0;
+    bool imsSwitchOnByDefault = false;
+    bool hideImsSwitch = false;
+    bool volteSupported = false;
+    bool carrierVtAvailable = false;
+    std::vector<int32_t> nrModeSupportedList;
+    bool volteProvisioningSupported = false;
+    bool ssOverUtSupported = false;
+    bool imsGbaRequired = false;
+    bool utProvisioningSupported = false;
+    bool imsPreferForEmergency = false;
+    int32_t callWaitingServiceClass = 0;
+    std::vector<std::string> imsCallDisconnectResoninfoMapping;
+    // parsed from the mapping above, replaced by a new version whenever the mapping changes
+    std::shared_ptr<const DisconnectReasonTable> disconnectReasonTable = nullptr;
+    uint64_t disconnectReasonTableVersion = 0;
+    bool forceVolteSwitchOn = false;
+    bool videoCallWaiting = false;
+    bool imsSipCauseEnable = false;
+    bool readyToCall = false;
+    int32_t vonrSwitchStatus = 0;
+    int32_t domainPreferenceMode = 0;
+    // the mode requested to the modem, it becomes the domain preference mode once the modem accepts it
+    int32_t tempDomainPreferenceMode = 0;
+    bool shouldCheckImsAfterNvUpdate = false;
+    bool isInService = false;
+    bool isRoaming = false;
+    int32_t simState = 0;
+    std::string curPlmn = "";
+    std::shared_ptr<const std::vector<EmergencyCall>> eccList = nullptr;
+};
+
+struct PlmnEccList {
+    std::string plmn = "";
+    std::vector<EmergencyCall> eccInfoList = {};
+};
+
+/**
+ * @brief Per slot state of the operator config and ECC list updates. It is not read on the call path, so it is
+ * kept apart from {SlotConfig} and published the same way: a snapshot is never modified, a writer publishes a
+ * changed copy with the next version.
+ */
+struct SlotUpdateState {
+    uint64_t version = 0;
+    // the newest operator config request, the results of the older ones are dropped
+    uint64_t operatorConfigGeneration = 0;
+    // a push sending every value, like after a loaded sim account, is queued and not applied yet
+    bool isFullImsPushPending = false;
+    bool isOperatorConfigApplied = false;
+    uint64_t appliedOperatorConfigFingerprint = 0;
+    int32_t appliedOperatorConfigState = INVALID_OPERATOR_CONFIG_STATE;
+    uint64_t parsedOperatorConfigFingerprint = 0;
+    std::shared_ptr<const OperatorConfigSnapshot> parsedOperatorConfig = nullptr;
+    OperatorConfigCacheStats operatorConfigCacheStats;
+    // inputs of the last ecc list pushed to the modem, 0 forces the next update
+    uint64_t eccInputFingerprint = 0;
+    std::shared_ptr<const PlmnEccList> hplmnEccList = nullptr;
+    std::shared_ptr<const PlmnEccList> currentPlmnEccList = nullptr;
+    std::shared_ptr<const PlmnEccList> hplmnFakeEccList = nullptr;
+    // the numbers last reported by the radio, an input of the merged list of {SlotConfig}
+    std::shared_ptr<const std::vector<EmergencyCall>> radioEccList = nullptr;
+    EccReadyStats eccReadyStats;
+};
+
 class CellularCallConfig {
 public:
     /**
@@ -314,6 +471,62 @@ public:
      */
     void UpdateImsConfiguration(int32_t slotId, int32_t configState, bool isOpcChanged);
 
+    /**
+     * Fetch and parse the operator config on the ffrt worker pool, the parsed snapshot is posted back
+     * to the slot handler, which applies it by {ApplyImsConfiguration}.
+     *
+     * @param slotId
+     * @param configState
+     * @param isOpcChanged
+     */
+    void UpdateImsConfigurationAsync(int32_t slotId, int32_t configState, bool isOpcChanged);
+
+    /**
+     * Cache a parsed operator config and update the ims configuration, results of a superseded
+     * request are dropped.
+     *
+     * @param result
+     */
+    void ApplyImsConfiguration(const OperatorConfigParseResult &result);
+
+    /**
+     * Hash the content of an operator config, equal configs give equal fingerprints.
+     *
+     * @param poc
+     * @return the fingerprint
+     */
+    static uint64_t GetOperatorConfigFingerprint(const OperatorConfig &poc);
+
+    /**
+     * Get the parse cache statistics of one slot and the value groups changed by the last applied config.
+     *
+     * @param slotId
+     * @param stats
+     */
+    static void GetOperatorConfigCacheStats(int32_t slotId, OperatorConfigCacheStats &stats);
+
+    /**
+     * Get the immutable snapshot of the Ecc Call List, it is replaced as a whole on every merge
+     *
+     * @param slotId
+     * @return the snapshot, nullptr when no list is merged yet
+     */
+    std::shared_ptr<const std::vector<EmergencyCall>> GetEccCallListSnapshot(int32_t slotId);
+
+    /**
+     * Get the configuration snapshot of one slot without taking any lock
+     *
+     * @param slotId
+     * @return the current snapshot, never nullptr. Every value is zero for an invalid slot id.
+     */
+    static std::shared_ptr<const SlotConfig> GetSlotConfig(int32_t slotId);
+
+    static void GetEccReadyStats(int32_t slotId, EccReadyStats &stats);
+
+    static void GetEccPlmnLruStats(EccPlmnLruStats &stats);
+
+    static void GetEccMergeStats(int32_t slotId, EccMergeStats &stats);
+
     /**
      * Get Ecc Call List
      *
@@ -431,6 +644,25 @@ public:
      */
     std::vector<std::string> GetImsCallDisconnectResoninfoMappingConfig(int32_t slotId);
 
+    /**
+     * @brief Look a vendor disconnect reason up in the parsed disconnect reason mapping of the slot
+     *
+     * @param slotId
+     * @param reason Indicates the reason reported by the vendor
+     * @param mapping Returns the message and the reason the vendor reason is mapped to
+     * @return Returns true when the mapping has an entry for the reason
+     */
+    static bool GetDisconnectReasonMapping(int32_t slotId, int32_t reason, DisconnectReasonMapping &mapping);
+
+    /**
+     * @brief Parse the entries of {KEY_IMS_CALL_DISCONNECT_REASONINFO_MAPPING_STRING_ARRAY}
+     *
+     * Empty fields are skipped. The first entry with a message wins when a reason is listed twice, and a mapped
+     * reason equal to the vendor one is passed over for the next field.
+     */
+    static std::shared_ptr<const DisconnectReasonTable> ParseDisconnectReasonMapping(
+        const std::vector<std::string> &mapping);
+
     /**
      * The IF used to get the value of operator config
      * {@link OperatorConfig#KEY_FORCE_VOLTE_SWITCH_ON_BOOL}
@@ -493,14 +725,63 @@ public:
 
 private:
     static void InitDefaultOperatorConfig();
+    static std::shared_ptr<SlotConfig> CreateDefaultSlotConfig();
+    /**
+     * Copy the snapshot of the slot, let {updater} change the copy and publish it, writers are serialized
+     */
+    static void UpdateSlotConfig(int32_t slotId, const std::function<void(SlotConfig &)> &updater);
+    static std::shared_ptr<const SlotUpdateState> GetSlotUpdateState(int32_t slotId);
+    /**
+     * Same as {UpdateSlotConfig} for the update state of the slot, the updater must not publish anything else
+     */
+    static void UpdateSlotUpdateState(int32_t slotId, const std::function<void(SlotUpdateState &)> &updater);
     EmergencyCall BuildDefaultEmergencyCall(const std::string &number, SimpresentType simType);
+    /**
+     * The 3GPP numbers merged into every ecc list, built once
+     */
+    const std::vector<EmergencyCall> &GetDefaultEccList(bool hasSim);
     EmergencyCall BuildEmergencyCall(int32_t slotId, const EmergencyInfo &from);
-    void UniqueEccCallList(int32_t slotId, std::vector<EmergencyCall> &eccList);
-    void MergeEccCallList(int32_t slotId);
+    /**
+     * Merge the radio, default and fake numbers of the slot and publish the list when it changed
+     *
+     * @param isFakeListQueried false keeps the fake numbers of the last merge and does not touch the ecc database
+     */
+    void MergeEccCallList(int32_t slotId, bool isFakeListQueried);
+    void GetHplmnFakeEccList(
+        int32_t slotId, bool hasSim, const std::string &mcc, std::vector<EmergencyCall> &fakeEccList);
     bool CheckAndUpdateSimState(int32_t slotId);
-    int32_t ParseAndCacheOperatorConfigs(int32_t slotId, OperatorConfig &poc);
-    void ParseBoolOperatorConfigs(
-        int32_t slotId, std::map<int32_t, bool> &config, OperatorConfig &poc, std::string configName);
+    int32_t ParseAndCacheOperatorConfigs(int32_t slotId, OperatorConfig &poc, uint64_t fingerprint, uint32_t &changes);
+    struct BoolOperatorConfig {
+        std::string key;
+        bool SlotConfig::*value;
+        OperatorConfigChange change;
+    };
+    static const std::vector<BoolOperatorConfig> &GetBoolOperatorConfigTable();
+    static std::shared_ptr<const OperatorConfigSnapshot> ParseOperatorConfigs(OperatorConfig &poc);
+    /**
+     * Parse an operator config, the snapshot of the last config of the slot is reused when the fingerprint matches
+     */
+    static std::shared_ptr<const OperatorConfigSnapshot> GetParsedOperatorConfigs(int32_t slotId,
+        OperatorConfig &poc, uint64_t fingerprint);
+    /**
+     * Cache the values of a snapshot in the slot config
+     *
+     * @return the {OperatorConfigChange} groups having a changed value, all of them on the first config of the slot
+     */
+    uint32_t CacheOperatorConfigs(int32_t slotId, const OperatorConfigSnapshot &snapshot);
+    void PushImsConfiguration(int32_t slotId, int32_t configState, bool isOpcChanged, uint32_t changes);
+    /**
+     * Start an operator config request superseding the queued ones of the slot. While a full push is
+     * pending, isOpcChanged is cleared so that the newest request takes the full push over.
+     *
+     * @return the generation of the request
+     */
+    static uint64_t NewOperatorConfigRequest(int32_t slotId, bool &isOpcChanged);
+    static bool IsOperatorConfigApplied(int32_t slotId, uint64_t fingerprint, int32_t configState);
+    static void RecordOperatorConfigApplied(int32_t slotId, uint64_t fingerprint, int32_t configState);
+    uint64_t GetEccInputFingerprint(int32_t slotId, const std::string &hplmn, bool isHomeAndPresent);
+    static void SubmitSlotTask(int32_t slotId, std::function<void()> &&task);
+    void UpdateEccNumberListAsync(int32_t slotId);
     void ResetImsSwitch(int32_t slotId);
     void UpdateImsUtCapabilities(int32_t slotId, ImsCapabilityList &imsCapabilityList);
     void UpdateImsVoiceCapabilities(int32_t slotId, ImsCapabilityList &imsCapabilityList);
@@ -526,62 +807,47 @@ private:
         std::vector<std::string> &callListWithCard, std::vector<std::string> &callListNoCard);
     bool ProcessCurrentPlmnEccList(int32_t slotId, std::vector<std::string> &callListWithCard,
         std::vector<std::string> &callListNoCard);
+    /**
+     * Query the ecc database row of a PLMN, served from the persisted ecc cache when it has the PLMN
+     */
+    int32_t QueryEccList(int32_t slotId, const std::string &plmn, std::vector<EccNum> &eccVec);
+    /**
+     * Query the row of a PLMN together with the home, the current and the invalidated recent PLMNs in one
+     * round trip, every row found is kept in the PLMN lru
+     */
+    int32_t BatchQueryEccList(int32_t slotId, const std::string &plmn, EccNum &eccNum);
+    /**
+     * Fetch the rows of every PLMN of the new country when the serving network crosses a border,
+     * queued before the ecc update of the slot so it finds the rows in memory
+     */
+    void PrefetchEccListAsync(int32_t slotId, const std::string &oldPlmn, const std::string &newPlmn);
+    static void PrefetchEccList(const std::string &plmn);
+    static void VerifyEccCacheAsync(int32_t slotId, const std::string &plmn);
+    static void RecordEccReady(int32_t slotId, EccListSource source);
     void UpdateHplmnFakeEccList(const std::vector<std::string> &callList, const std::string &hplmn,
                                 int32_t slotId, std::vector<EmergencyCall> &eccList, const std::string &mcc);
     void UpdateEccListByFakeEccList(int32_t slotId, std::vector<EmergencyCall> &eccList);
     void ClearCachedEcclist(int32_t slotId);
 
 private:
-    struct EccList {
-        std::string plmn = "";
-        std::vector<EmergencyCall> eccInfoList = {};
-    };
-    static std::map<int32_t, int32_t> modeTempMap_;
-    static std::map<int32_t, int32_t> modeMap_;
-    static std::map<int32_t, std::vector<EmergencyCall>> eccListRadioMap_;
-    static std::vector<EmergencyCall> eccList3gppHasSim_;
-    static std::vector<EmergencyCall> eccList3gppNoSim_;
-    static std::map<int32_t, std::vector<EmergencyCall>> allEccList_;
-    static std::map<int32_t, int32_t> simState_;
-    static std::map<int32_t, std::string> curPlmn_;
-    static std::shared_mutex simStateLock_;
-    static std::shared_mutex mutex_;
-    static ffrt::mutex operatorMutex_;
+    // read with atomic_load, replaced with atomic_store under slotConfigMutex_
+    static std::vector<std::shared_ptr<const SlotConfig>> slotConfigs_;
+    static std::vector<std::shared_ptr<const SlotUpdateState>> slotUpdateStates_;
+    // serializes the writers of both snapshots
+    static ffrt::mutex slotConfigMutex_;
     ConfigRequest configRequest_;
-    static std::map<int32_t, bool> imsSwitchOnByDefault_;
-    static std::map<int32_t, bool> hideImsSwitch_;
-    static std::map<int32_t, bool> volteSupported_;
-    static std::map<int32_t, bool> carrierVtAvailable_;
-    static std::map<int32_t, std::vector<int32_t>> nrModeSupportedList_;
-    static std::map<int32_t, bool> volteProvisioningSupported_;
-    static std::map<int32_t, bool> ssOverUtSupported_;
-    static std::map<int32_t, bool> imsGbaRequired_;
-    static std::map<int32_t, bool> utProvisioningSupported_;
-    static std::map<int32_t, bool> imsPreferForEmergency_;
-    static std::map<int32_t, int32_t> callWaitingServiceClass_;
-    static std::map<int32_t, std::vector<std::string>> imsCallDisconnectResoninfoMapping_;
-    static std::map<int32_t, bool> forceVolteSwitchOn_;
-    static std::map<int32_t, bool> videoCallWaiting_;
-    static std::map<int32_t, bool> readyToCall_;
-    static std::map<int32_t, int32_t> vonrSwithStatus_;
-    static std::map<int32_t, bool> imsSipCauseEnable_;
-    static std::map<int32_t, bool> shouldCheckImsAfterNvUpdate_;
+    // where the list of the running ecc update comes from, an instance serves one update
+    EccListSource eccListSource_ = EccListSource::DATABASE;
     static int32_t lastDisconnectCode_;
     static bool isOperatorConfigInit_;
 #ifdef CELLULAR_CALL_REDCAP_ABILITY
-    static bool isRadioOn_;
-    static bool isOperatorConfigChanged_;
+    static std::atomic<bool> isRadioOn_;
+    static std::atomic<bool> isOperatorConfigChanged_;
 #endif
-    struct cellularNetworkState {
-        bool isInService_ = false;
-        bool isRoaming_ = false;
-    };
-    static std::map<int32_t, cellularNetworkState> networkServiceState_;
-    static std::vector<EccList> hplmnEccList_;
-    static std::vector<EccList> currentPlmnEccList_;
-    static std::vector<EccList> hplmnFakeEccList_;
-    static ffrt::mutex plmnMutex_;
-    static ffrt::mutex modeMutex_;
+    static std::vector<int32_t> slotTaskKeys_;
+    static CellularCallEccPlmnLru eccPlmnLru_;
+    // the merged ecc list of every slot, only touched by the slot tasks after the init
+    static std::vector<CellularCallEccMerger> eccMergers_;
 };
 } // namespace Telephony
 } // namespace OHOS
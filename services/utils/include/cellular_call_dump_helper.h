@@ -32,6 +32,19 @@ public:
 private:
     void ShowHelp(std::string &result) const;
     void ShowCellularCallInfo(std::string &result) const;
+    void ShowStartupPhaseInfo(std::string &result) const;
+    void ShowImsConnectionInfo(std::string &result) const;
+    void ShowIpcMetrics(std::string &result) const;
+    void ShowEventLaneInfo(std::string &result) const;
+    void ShowQueueWatchdogInfo(std::string &result) const;
+    void ShowTelemetryQueueInfo(std::string &result) const;
+    void ShowTimerWheelInfo(std::string &result) const;
+    void ShowBroadcastDebounceInfo(std::string &result) const;
+    void ShowEccAssemblyInfo(std::string &result) const;
+    void ShowOperatorConfigInfo(std::string &result) const;
+    void ShowEccCacheInfo(std::string &result) const;
+    void ShowParameterCacheInfo(std::string &result) const;
+    void ShowDataShareInfo(std::string &result) const;
     bool WhetherHasSimCard(const int32_t slotId) const;
 };
 } // namespace Telephony
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_ECC_ASSEMBLER_H
+#define TELEPHONY_CELLULAR_CALL_ECC_ASSEMBLER_H
+
+#include <map>
+#include <vector>
+
+#include "ffrt.h"
+#include "tel_ril_call_parcel.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * A list still missing chunks this long after its first chunk is dropped and queried again.
+ */
+static constexpr int64_t ECC_ASSEMBLY_TIMEOUT_MS = 3000;
+/**
+ * The modem is not asked for the list again more often than this.
+ */
+static constexpr int64_t ECC_REQUERY_MIN_INTERVAL_MS = 1000;
+static constexpr int32_t ECC_ASSEMBLY_MAX_TOTAL = 1000;
+
+enum class EccAssemblyResult {
+    COMPLETE = 0,
+    PARTIAL,
+    INVALID,
+};
+
+/**
+ * Numbers of the list not received yet, from {begin} to {end} included, starting at 1 like the report.
+ */
+struct EccIndexRange {
+    int32_t begin = 0;
+    int32_t end = 0;
+};
+
+struct EccAssemblyStats {
+    uint64_t chunks = 0;
+    uint64_t completed = 0;
+    uint64_t outOfOrder = 0;
+    uint64_t duplicates = 0;
+    uint64_t restarts = 0;
+    uint64_t invalid = 0;
+    uint64_t timeouts = 0;
+    uint64_t requeries = 0;
+    uint64_t suppressedRequeries = 0;
+};
+
+/**
+ * @brief Rebuilds the emergency list the radio reports in several chunks.
+ *
+ * Every number carries its index in the list and the size of the list, so chunks are placed by index and
+ * may come in any order or more than once. A chunk announcing another size starts a new list.
+ */
+class CellularCallEccAssembler {
+public:
+    CellularCallEccAssembler() = default;
+    ~CellularCallEccAssembler() = default;
+
+    /**
+     * @brief Add a chunk reported by the radio
+     *
+     * @param chunk Indicates the numbers of the chunk
+     * @param nowMs Indicates the current time of {CellularCallClock}
+     * @param eccList Returns the whole list in index order when the result is COMPLETE
+     * @param isNewAssembly Returns true when the chunk started a new partial list
+     * @return Returns INVALID when a number can not be placed in the list
+     */
+    EccAssemblyResult AddChunk(const EmergencyInfoList &chunk, int64_t nowMs, EmergencyInfoList &eccList,
+        bool &isNewAssembly);
+
+    /**
+     * @brief Drop the partial list when it is older than {ECC_ASSEMBLY_TIMEOUT_MS}
+     *
+     * @param missing Returns the ranges never received
+     * @return Returns true when the list was dropped
+     */
+    bool CheckTimeout(int64_t nowMs, std::vector<EccIndexRange> &missing);
+
+    void Reset();
+
+    /**
+     * @brief Count a query of the whole list
+     *
+     * @return Returns false when the last query is too recent, the caller does not query then
+     */
+    bool TryRequery(int64_t nowMs);
+
+    void GetStats(EccAssemblyStats &stats);
+
+private:
+    void GetMissingRangesLocked(std::vector<EccIndexRange> &missing) const;
+
+    ffrt::mutex mutex_;
+    int32_t total_ = 0;
+    int64_t startMs_ = 0;
+    int32_t lastIndex_ = 0;
+    std::map<int32_t, EmergencyInfo> received_;
+    int64_t lastRequeryMs_ = -ECC_REQUERY_MIN_INTERVAL_MS;
+    EccAssemblyStats stats_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_ECC_ASSEMBLER_H
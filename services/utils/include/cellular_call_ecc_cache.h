@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_ECC_CACHE_H
+#define TELEPHONY_CELLULAR_CALL_ECC_CACHE_H
+
+#include <map>
+#include <set>
+#include <string>
+
+#include "ffrt.h"
+#include "global_params_data.h"
+#include "singleton.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr const char *ECC_CACHE_FILE_PATH = "/data/service/el1/public/telephony/cellular_call_ecc_cache.bin";
+static constexpr uint32_t ECC_CACHE_MAGIC = 0x43434345;
+/**
+ * Bump it whenever the layout of the file changes, a file of another version is dropped on load.
+ */
+static constexpr uint32_t ECC_CACHE_VERSION = 1;
+static constexpr uint32_t ECC_CACHE_MAX_ENTRIES = 64;
+static constexpr size_t ECC_CACHE_PLMN_LEN = 8;
+static constexpr size_t ECC_CACHE_MAX_FILE_SIZE = 64 * 1024;
+
+struct EccCacheStats {
+    bool isMapped = false;
+    uint32_t entryCount = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t writes = 0;
+    uint64_t loadFailures = 0;
+};
+
+/**
+ * @brief Emergency numbers of the ecc database, persisted per PLMN so a warm start does not wait for the
+ * database before the right list reaches the modem.
+ *
+ * The file is a header, the entries sorted by PLMN and a string pool, checked with a checksum and mapped
+ * read only. A store rewrites a temporary file and renames it over the old one, so a reader or a reboot
+ * never sees a half written cache.
+ */
+class CellularCallEccCache : public DelayedSingleton<CellularCallEccCache> {
+    DECLARE_DELAYED_SINGLETON(CellularCallEccCache);
+
+public:
+    /**
+     * @brief Map the cache file, a missing file gives an empty cache and a broken one is removed
+     *
+     * @param path Indicates the cache file, {ECC_CACHE_FILE_PATH} is opened on first use otherwise
+     * @return Returns TELEPHONY_SUCCESS when a valid file is mapped
+     */
+    int32_t Open(const std::string &path);
+
+    /**
+     * @brief Find the emergency numbers of a PLMN
+     *
+     * @param plmn Indicates the MCC and MNC
+     * @param eccNum Returns the numbers with card, without card and the fake ones
+     * @param needVerify Returns true until a {Store} of the PLMN confirmed the entry since the cache was opened,
+     * the caller then checks the entry against the database
+     * @return Returns true on hit
+     */
+    bool Lookup(const std::string &plmn, EccNum &eccNum, bool &needVerify);
+
+    /**
+     * @brief Save the emergency numbers of a PLMN, the file is only rewritten when they changed
+     *
+     * @param isChanged Returns true when the entry was added or modified
+     */
+    int32_t Store(const std::string &plmn, const EccNum &eccNum, bool &isChanged);
+
+    /**
+     * @brief Drop every entry and remove the file, used when the ecc database changes
+     */
+    void Clear();
+
+    void GetStats(EccCacheStats &stats);
+
+private:
+    struct FileHeader {
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint32_t entryCount = 0;
+        uint32_t poolSize = 0;
+        uint32_t checksum = 0;
+        uint32_t sequence = 0;
+    };
+
+    struct FileEntry {
+        char plmn[ECC_CACHE_PLMN_LEN] = { 0 };
+        // higher is newer, the oldest entry is evicted when the cache is full
+        uint32_t sequence = 0;
+        uint32_t withCardOffset = 0;
+        uint32_t noCardOffset = 0;
+        uint32_t fakeOffset = 0;
+        uint16_t withCardLen = 0;
+        uint16_t noCardLen = 0;
+        uint16_t fakeLen = 0;
+        uint16_t reserved = 0;
+    };
+
+    struct Record {
+        uint32_t sequence = 0;
+        std::string withCard;
+        std::string noCard;
+        std::string fake;
+    };
+
+    static uint32_t GetChecksum(const uint8_t *data, size_t size);
+    void OpenDefaultLocked();
+    int32_t MapLocked();
+    void UnmapLocked();
+    bool IsValidLocked() const;
+    const FileEntry *FindLocked(const std::string &plmn) const;
+    std::string GetStringLocked(uint32_t offset, uint16_t len) const;
+    void ReadRecordsLocked(std::map<std::string, Record> &records) const;
+    int32_t WriteLocked(const std::map<std::string, Record> &records, uint32_t sequence);
+
+private:
+    ffrt::mutex mutex_;
+    bool isOpened_ = false;
+    std::string path_;
+    uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+    const FileHeader *header_ = nullptr;
+    const FileEntry *entries_ = nullptr;
+    const char *pool_ = nullptr;
+    // PLMNs stored since the cache was opened, their entries match the database
+    std::set<std::string> verifiedPlmns_;
+    EccCacheStats stats_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_ECC_CACHE_H
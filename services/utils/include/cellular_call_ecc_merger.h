@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_ECC_MERGER_H
+#define TELEPHONY_CELLULAR_CALL_ECC_MERGER_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ffrt.h"
+#include "tel_ril_call_parcel.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Sources of the merged emergency list, a number reported by several sources is taken from the first one.
+ */
+enum class EccMergeSource : uint32_t {
+    RADIO = 0,
+    DEFAULT,
+    FAKE,
+    COUNT,
+};
+
+struct EccMergeStats {
+    uint64_t updates = 0;
+    uint64_t unchanged = 0;
+    uint64_t added = 0;
+    uint64_t removed = 0;
+    uint64_t rebuilds = 0;
+};
+
+/**
+ * @brief The emergency list of one slot, merged from the lists of its sources.
+ *
+ * Every source keeps its numbers hashed by number and mcc, the same identity {EmergencyCall::operator==}
+ * uses. Replacing the list of a source only applies the numbers it gained or lost to the merged index,
+ * an identical list is detected by its hash and changes nothing.
+ */
+class CellularCallEccMerger {
+public:
+    CellularCallEccMerger() = default;
+    ~CellularCallEccMerger() = default;
+
+    /**
+     * @brief Replace the numbers of a source
+     *
+     * @return Returns true when the merged list changed
+     */
+    bool SetSource(EccMergeSource source, const std::vector<EmergencyCall> &eccList);
+
+    /**
+     * @brief Get the merged list, the numbers of the first source first, every number once
+     *
+     * @return the list, rebuilt only after a change and shared by the callers until the next one
+     */
+    std::shared_ptr<const std::vector<EmergencyCall>> GetMergedList();
+
+    void Clear();
+
+    void GetStats(EccMergeStats &stats);
+
+    static std::string GetKey(const EmergencyCall &call);
+
+private:
+    struct SourceState {
+        uint64_t hash = 0;
+        std::vector<EmergencyCall> calls;
+        // key to the first position of the number in {calls}
+        std::unordered_map<std::string, size_t> positions;
+    };
+
+    static uint64_t GetHash(const std::vector<EmergencyCall> &eccList);
+
+    ffrt::mutex mutex_;
+    SourceState sources_[static_cast<uint32_t>(EccMergeSource::COUNT)];
+    // key to the mask of the sources having the number, the lowest bit is the source the number is taken from
+    std::unordered_map<std::string, uint32_t> merged_;
+    std::shared_ptr<const std::vector<EmergencyCall>> mergedList_ = nullptr;
+    EccMergeStats stats_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_ECC_MERGER_H
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_ECC_PLMN_LRU_H
+#define TELEPHONY_CELLULAR_CALL_ECC_PLMN_LRU_H
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ffrt.h"
+#include "global_params_data.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr size_t ECC_PLMN_LRU_CAPACITY = 16;
+
+struct EccPlmnLruStats {
+    uint32_t size = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+};
+
+/**
+ * @brief The ecc database rows of the recently seen PLMNs, the least recently used one is evicted when full.
+ *
+ * A PLMN without a row in the database is kept with an empty row, so it is not queried again.
+ * {Invalidate} drops the rows but keeps the PLMNs, the next database query fetches all of them at once.
+ */
+class CellularCallEccPlmnLru {
+public:
+    explicit CellularCallEccPlmnLru(size_t capacity = ECC_PLMN_LRU_CAPACITY);
+    ~CellularCallEccPlmnLru() = default;
+
+    /**
+     * @brief Find the row of a PLMN and mark it as the most recently used
+     *
+     * @return Returns true when the PLMN has a valid row
+     */
+    bool Get(const std::string &plmn, EccNum &eccNum);
+
+    /**
+     * @brief Check that a PLMN has a valid row, without counting a hit or changing the order
+     */
+    bool Contains(const std::string &plmn);
+
+    void Put(const std::string &plmn, const EccNum &eccNum);
+
+    /**
+     * @brief Add the row of a PLMN as the least recently used one, only when the lru is not full
+     *
+     * Used for the prefetched rows, which must not evict the rows in use.
+     *
+     * @return Returns true when the row is added
+     */
+    bool PutIfRoom(const std::string &plmn, const EccNum &eccNum);
+
+    void Invalidate();
+
+    void Clear();
+
+    /**
+     * @brief Get the PLMNs which lost their row on {Invalidate}, the most recently used first
+     */
+    void GetInvalidPlmns(std::vector<std::string> &plmns);
+
+    void GetStats(EccPlmnLruStats &stats);
+
+private:
+    struct Node {
+        std::string plmn;
+        EccNum eccNum;
+        bool isValid = false;
+    };
+
+    size_t capacity_ = ECC_PLMN_LRU_CAPACITY;
+    ffrt::mutex mutex_;
+    // the most recently used first
+    std::list<Node> nodes_;
+    std::unordered_map<std::string, std::list<Node>::iterator> index_;
+    EccPlmnLruStats stats_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_ECC_PLMN_LRU_H
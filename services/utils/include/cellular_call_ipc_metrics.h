@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_IPC_METRICS_H
+#define TELEPHONY_CELLULAR_CALL_IPC_METRICS_H
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "singleton.h"
+
+namespace OHOS {
+namespace Telephony {
+enum class IpcDirection : int32_t {
+    CALL_MANAGER_INBOUND = 0,
+    IMS_OUTBOUND,
+    IMS_CALLBACK_INBOUND,
+    DIRECTION_BUTT,
+};
+
+static constexpr int32_t IPC_METRICS_MAX_CODES = 128;
+static constexpr int32_t IPC_LATENCY_BUCKET_NUM = 8;
+/**
+ * Upper bound in microseconds of every latency bucket but the last one, which takes the rest.
+ */
+static constexpr uint64_t IPC_LATENCY_BUCKET_BOUNDS_US[IPC_LATENCY_BUCKET_NUM - 1] = {
+    100, 500, 1000, 5000, 10000, 50000, 100000 };
+
+struct IpcCodeStats {
+    uint32_t code = 0;
+    uint64_t count = 0;
+    uint64_t errors = 0;
+    uint64_t bytes = 0;
+    uint64_t totalCostUs = 0;
+    uint64_t maxCostUs = 0;
+    uint64_t latency[IPC_LATENCY_BUCKET_NUM] = { 0 };
+};
+
+/**
+ * @brief Per interface code binder statistics of cellular call.
+ *
+ * Every direction owns a fixed open addressing table keyed by the interface code, recording only
+ * touches atomics so it is safe on any binder thread. A summary hisysevent is written at most once
+ * every report interval, triggered by the recording itself.
+ */
+class CellularCallIpcMetrics {
+    DECLARE_DELAYED_REF_SINGLETON(CellularCallIpcMetrics);
+
+public:
+    /**
+     * @brief Record one transaction
+     *
+     * @param direction Indicates who sends and who serves the transaction
+     * @param code Indicates the interface code
+     * @param result Indicates the transaction result, non zero is counted as error
+     * @param bytes Indicates the request plus reply payload size
+     * @param costUs Indicates the time spent in microseconds
+     */
+    void Record(IpcDirection direction, uint32_t code, int32_t result, size_t bytes, int64_t costUs);
+
+    /**
+     * @brief Copy the statistics of one direction, sorted by count in descending order
+     */
+    void GetStats(IpcDirection direction, std::vector<IpcCodeStats> &stats);
+
+    uint64_t GetOverflowCount(IpcDirection direction);
+
+    /**
+     * @brief Clear all the tables, must not race with {Record}
+     */
+    void Reset();
+
+private:
+    struct CodeCounter {
+        // interface code plus one, zero marks a free slot
+        std::atomic<uint64_t> key { 0 };
+        std::atomic<uint64_t> count { 0 };
+        std::atomic<uint64_t> errors { 0 };
+        std::atomic<uint64_t> bytes { 0 };
+        std::atomic<uint64_t> totalCostUs { 0 };
+        std::atomic<uint64_t> maxCostUs { 0 };
+        std::atomic<uint64_t> latency[IPC_LATENCY_BUCKET_NUM] = {};
+    };
+
+    struct CodeTable {
+        CodeCounter counters[IPC_METRICS_MAX_CODES];
+        std::atomic<uint64_t> overflow { 0 };
+    };
+
+    CodeCounter *FindCounter(CodeTable &table, uint32_t code);
+    static int32_t GetLatencyBucket(uint64_t costUs);
+    void TryReportSummary(int64_t now);
+    void ReportSummary();
+
+private:
+    CodeTable tables_[static_cast<int32_t>(IpcDirection::DIRECTION_BUTT)];
+    std::atomic<int64_t> lastReportTimeUs_ { 0 };
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_IPC_METRICS_H
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_PARAMETER_CACHE_H
+#define TELEPHONY_CELLULAR_CALL_PARAMETER_CACHE_H
+
+#include <atomic>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "singleton.h"
+
+namespace OHOS {
+namespace Telephony {
+struct ParameterCacheStats {
+    uint32_t cachedKeys = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t updates = 0;
+    uint64_t watchFailures = 0;
+};
+
+/**
+ * @brief System parameters read on the call path, served from memory.
+ *
+ * The first read of a key watches it and reads it directly, the watcher keeps the value up to date afterwards.
+ * A key which can not be watched is always read directly. A parameter written by this service is written
+ * through {SetString}, so that a read right after the write does not wait for the watcher.
+ */
+class CellularCallParameterCache : public DelayedSingleton<CellularCallParameterCache> {
+    DECLARE_DELAYED_SINGLETON(CellularCallParameterCache);
+
+public:
+    /**
+     * @brief Get the value of a parameter
+     *
+     * @return the value, {defValue} when the parameter is not set
+     */
+    std::string GetString(const std::string &key, const std::string &defValue);
+
+    /**
+     * @brief Get a decimal parameter
+     *
+     * @return the value, {defValue} when the parameter is not set or not a number
+     */
+    int32_t GetInt(const std::string &key, int32_t defValue);
+
+    /**
+     * @brief Get a boolean parameter, "1", "y", "yes", "on" and "true" are true, "0", "n", "no", "off" and
+     * "false" are false
+     *
+     * @return the value, {defValue} when the parameter is not set or not a boolean
+     */
+    bool GetBool(const std::string &key, bool defValue);
+
+    /**
+     * @brief Set a parameter and the cached value
+     *
+     * @return Returns 0 on success, the error of SetParameter on failure
+     */
+    int32_t SetString(const std::string &key, const std::string &value);
+
+    void GetStats(ParameterCacheStats &stats);
+
+private:
+    struct Entry {
+        // the watcher is registered but the first value is not read yet
+        bool isPending = true;
+        std::string value;
+    };
+
+    std::string Read(const std::string &key);
+    bool Watch(const std::string &key);
+    void OnParameterChanged(const std::string &key, const std::string &value);
+    static void ParameterChangedCallback(const char *key, const char *value, void *context);
+
+    std::shared_mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::atomic<uint64_t> hits_ { 0 };
+    std::atomic<uint64_t> misses_ { 0 };
+    std::atomic<uint64_t> updates_ { 0 };
+    std::atomic<uint64_t> watchFailures_ { 0 };
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_PARAMETER_CACHE_H
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_QUEUE_WATCHDOG_H
+#define TELEPHONY_CELLULAR_CALL_QUEUE_WATCHDOG_H
+
+#include <atomic>
+#include <map>
+#include <vector>
+
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * An event waiting in the queue longer than this starts the backpressure.
+ */
+static constexpr int64_t QUEUE_WATCHDOG_WAIT_THRESHOLD_MS = 500;
+/**
+ * An event running in the handler longer than this is reported as slow.
+ */
+static constexpr int64_t QUEUE_WATCHDOG_RUN_THRESHOLD_MS = 200;
+/**
+ * The backpressure stops after this many events in a row waited less than the recover threshold.
+ */
+static constexpr int64_t QUEUE_WATCHDOG_RECOVER_THRESHOLD_MS = 50;
+static constexpr uint32_t QUEUE_WATCHDOG_RECOVER_COUNT = 8;
+static constexpr int64_t QUEUE_WATCHDOG_REPORT_INTERVAL_MS = 10 * 60 * 1000;
+
+struct QueueWatchdogEventStats {
+    uint32_t eventId = 0;
+    uint64_t count = 0;
+    uint64_t slowRunCount = 0;
+    uint64_t maxWaitMs = 0;
+    uint64_t maxRunMs = 0;
+};
+
+struct QueueWatchdogState {
+    bool backpressure = false;
+    uint64_t backpressureCount = 0;
+    uint64_t shedCount = 0;
+    uint64_t slowRunCount = 0;
+    uint64_t reportCount = 0;
+};
+
+/**
+ * @brief Watches how long the events of one CellularCallHandler wait in the queue and run.
+ *
+ * {OnDispatch} is only called on the handler thread, the other methods may be called from any thread.
+ * While the backpressure is on, the handler drops or collapses the event types it considers sheddable.
+ */
+class CellularCallQueueWatchdog {
+public:
+    CellularCallQueueWatchdog() = default;
+    ~CellularCallQueueWatchdog() = default;
+
+    void SetSlotId(int32_t slotId);
+
+    /**
+     * @brief Record one event after the handler finished it
+     *
+     * @param eventId Indicates the inner event id
+     * @param waitMs Indicates the time from the planned handle time to the dispatch, negative when unknown
+     * @param runMs Indicates the time spent in the handler
+     * @param nowMs Indicates the current steady time
+     */
+    void OnDispatch(uint32_t eventId, int64_t waitMs, int64_t runMs, int64_t nowMs);
+
+    bool IsBackpressure() const;
+
+    /**
+     * @brief Count one event dropped or collapsed because of the backpressure
+     */
+    void RecordShed(uint32_t eventId);
+
+    void GetState(QueueWatchdogState &state) const;
+
+    /**
+     * @brief Copy the statistics of every event id, sorted by the max wait time in descending order
+     */
+    void GetEventStats(std::vector<QueueWatchdogEventStats> &stats);
+
+private:
+    void UpdateBackpressure(uint32_t eventId, int64_t waitMs, int64_t nowMs);
+    void TryReport(uint32_t eventId, int64_t waitMs, int64_t runMs, int64_t nowMs);
+
+private:
+    int32_t slotId_ = 0;
+    std::atomic<bool> backpressure_ { false };
+    std::atomic<uint64_t> backpressureCount_ { 0 };
+    std::atomic<uint64_t> shedCount_ { 0 };
+    std::atomic<uint64_t> slowRunCount_ { 0 };
+    std::atomic<uint64_t> reportCount_ { 0 };
+    // only touched on the handler thread
+    uint32_t recoverCount_ = 0;
+    int64_t lastReportTimeMs_ = 0;
+    ffrt::mutex statsMutex_;
+    std::map<uint32_t, QueueWatchdogEventStats> eventStats_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_QUEUE_WATCHDOG_H
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_STARTUP_ORCHESTRATOR_H
+#define TELEPHONY_CELLULAR_CALL_STARTUP_ORCHESTRATOR_H
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cellular_call_clock.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Telephony {
+struct StartupPhaseInfo {
+    std::string stage = "";
+    std::string name = "";
+    // offset from the start of the stage
+    int64_t startMs = 0;
+    int64_t costMs = 0;
+    bool isDone = false;
+};
+
+/**
+ * @brief Runs the phases of one startup stage as a dependency graph.
+ *
+ * Every phase is an ffrt task writing its own dependence and reading the ones of the phases it depends on,
+ * so independent phases run concurrently and a phase starts as soon as its dependencies are done.
+ * {Run} blocks until every phase is done, {RunAsync} returns at once and reports the end to a callback.
+ * The time of each phase is taken from {CellularCallClock}.
+ */
+class CellularCallStartupOrchestrator {
+public:
+    using Task = std::function<void()>;
+
+    explicit CellularCallStartupOrchestrator(const std::string &stage);
+    ~CellularCallStartupOrchestrator() = default;
+
+    /**
+     * @brief Add a phase, the dependencies must be added before {Run}
+     *
+     * @param name Indicates the unique name of the phase
+     * @param task Indicates the work of the phase
+     * @param dependencies Indicates the names of the phases to finish first
+     * @return Returns TELEPHONY_SUCCESS on success, others on failure.
+     */
+    int32_t AddPhase(const std::string &name, const Task &task, const std::vector<std::string> &dependencies = {});
+
+    /**
+     * @brief Run every phase and wait for them, can only be called once
+     *
+     * @return Returns TELEPHONY_SUCCESS on success, TELEPHONY_ERR_ARGUMENT_INVALID when a dependency is unknown
+     * or the phases depend on each other in a cycle, in which case nothing is run.
+     */
+    int32_t Run();
+
+    /**
+     * @brief Run every phase without waiting, can only be called once. Use it on a queue or in an ffrt task,
+     * where {Run} would block the thread. The orchestrator must stay alive until onDone runs.
+     *
+     * @param onDone Indicates the work run on an ffrt worker once every phase is done
+     * @return Returns the same as {Run}, onDone is not run on failure
+     */
+    int32_t RunAsync(const Task &onDone);
+
+    /**
+     * @brief Copy the phases in the order they were started
+     */
+    void GetPhases(std::vector<StartupPhaseInfo> &phases) const;
+
+    int64_t GetTotalCostMs() const;
+
+    const std::string &GetStage() const;
+
+private:
+    struct Phase {
+        StartupPhaseInfo info;
+        Task task = nullptr;
+        std::vector<std::string> dependencies;
+        std::vector<Phase *> dependencyPhases;
+    };
+
+    Phase *FindPhase(const std::string &name);
+    bool SortPhases(std::vector<Phase *> &order);
+    int32_t SubmitPhases(std::vector<ffrt::dependence> &allDeps);
+    void FinishRun();
+
+private:
+    std::string stage_ = "";
+    // the address of a phase is its ffrt dependence, a list keeps it stable
+    std::list<Phase> phases_;
+    bool isRun_ = false;
+    std::shared_ptr<CellularCallClock> clock_ = nullptr;
+    int64_t startMs_ = 0;
+    int64_t totalCostMs_ = 0;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_STARTUP_ORCHESTRATOR_H
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_CELLULAR_CALL_TIMER_WHEEL_H
+#define TELEPHONY_CELLULAR_CALL_TIMER_WHEEL_H
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "cellular_call_clock.h"
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr int64_t TIMER_WHEEL_TICK_MS = 50;
+static constexpr uint32_t TIMER_WHEEL_LEVEL_BITS = 6;
+static constexpr uint32_t TIMER_WHEEL_SLOTS = 1u << TIMER_WHEEL_LEVEL_BITS;
+/**
+ * Four levels of 64 slots cover 2^24 ticks, about 9 days, longer delays are clamped.
+ */
+static constexpr uint32_t TIMER_WHEEL_LEVELS = 4;
+
+struct TimerWheelStats {
+    uint64_t pending = 0;
+    uint64_t armed = 0;
+    uint64_t fired = 0;
+    uint64_t cancelled = 0;
+    uint64_t cascaded = 0;
+};
+
+class CellularCallTimerWheel;
+
+/**
+ * @brief Owner of one armed timer, the timer is cancelled when the last owner goes away.
+ *
+ * Keep it in the object whose lifetime bounds the timeout, e.g. the connection of a post dial pause.
+ */
+class CellularCallTimer {
+public:
+    CellularCallTimer() = default;
+    CellularCallTimer(const std::shared_ptr<CellularCallTimerWheel> &wheel, CellularCallClock::TimerId timerId);
+    ~CellularCallTimer();
+    CellularCallTimer(const CellularCallTimer &) = delete;
+    CellularCallTimer &operator=(const CellularCallTimer &) = delete;
+    CellularCallTimer(CellularCallTimer &&other) noexcept;
+    CellularCallTimer &operator=(CellularCallTimer &&other) noexcept;
+
+    /**
+     * @brief Cancel the timer
+     *
+     * @return Returns true when the timer was not fired yet
+     */
+    bool Cancel();
+
+    CellularCallClock::TimerId GetTimerId() const;
+
+private:
+    std::weak_ptr<CellularCallTimerWheel> wheel_;
+    CellularCallClock::TimerId timerId_ = 0;
+};
+
+/**
+ * @brief Hierarchical timer wheel of one slot, arming and cancelling a timer are O(1).
+ *
+ * The wheel must be owned by a shared_ptr. It is driven by a single tick posted on {CellularCallClock} while at
+ * least one timer is armed, ticks with nothing due in the lowest level are skipped, so an idle slot costs nothing.
+ * Expired tasks run on the tick thread without the lock of the wheel held, a task may arm or cancel timers.
+ */
+class CellularCallTimerWheel : public std::enable_shared_from_this<CellularCallTimerWheel> {
+public:
+    using Task = std::function<void()>;
+
+    CellularCallTimerWheel();
+    ~CellularCallTimerWheel();
+
+    void SetSlotId(int32_t slotId);
+
+    /**
+     * @brief Run a task after a delay, rounded up to the tick
+     *
+     * @return the id used to cancel the timer, 0 on failure
+     */
+    CellularCallClock::TimerId Arm(const Task &task, int64_t delayMs);
+
+    /**
+     * @brief Arm a timer owned by the returned handle
+     */
+    CellularCallTimer ArmScoped(const Task &task, int64_t delayMs);
+
+    /**
+     * @brief Cancel a timer
+     *
+     * @return Returns true when the timer was not fired yet
+     */
+    bool Cancel(CellularCallClock::TimerId timerId);
+
+    void GetStats(TimerWheelStats &stats);
+
+private:
+    struct TimerNode {
+        CellularCallClock::TimerId timerId = 0;
+        uint64_t expireTick = 0;
+        Task task = nullptr;
+    };
+    using Bucket = std::list<TimerNode>;
+
+    struct TimerLocation {
+        uint32_t level = 0;
+        uint32_t index = 0;
+        Bucket::iterator node;
+    };
+
+    uint64_t GetNowTick();
+    void Place(Bucket &from, Bucket::iterator node);
+    void Cascade(uint32_t level);
+    void OnTick(uint64_t generation);
+    void ScheduleTickLocked();
+
+private:
+    int32_t slotId_ = 0;
+    // the clock at construction drives the wheel for its whole lifetime
+    std::shared_ptr<CellularCallClock> clock_;
+    ffrt::mutex mutex_;
+    int64_t startMs_ = -1;
+    uint64_t currentTick_ = 0;
+    CellularCallClock::TimerId nextTimerId_ = 1;
+    CellularCallClock::TimerId tickTimerId_ = 0;
+    uint64_t tickTick_ = 0;
+    uint64_t tickGeneration_ = 0;
+    Bucket buckets_[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+    std::unordered_map<CellularCallClock::TimerId, TimerLocation> locations_;
+    TimerWheelStats stats_;
+};
+} // namespace Telephony
+} // namespace OHOS
+
+#endif // TELEPHONY_CELLULAR_CALL_TIMER_WHEEL_H
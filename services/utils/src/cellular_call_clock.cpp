@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_clock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr uint64_t US_PER_MS = 1000;
+
+static std::shared_ptr<CellularCallClock> &GetClockHolder()
+{
+    static std::shared_ptr<CellularCallClock> clock = std::make_shared<SteadyCellularCallClock>();
+    return clock;
+}
+
+std::shared_ptr<CellularCallClock> CellularCallClock::GetInstance()
+{
+    return std::atomic_load(&GetClockHolder());
+}
+
+void CellularCallClock::SetInstance(const std::shared_ptr<CellularCallClock> &clock)
+{
+    std::shared_ptr<CellularCallClock> newClock = clock;
+    if (newClock == nullptr) {
+        newClock = std::make_shared<SteadyCellularCallClock>();
+    }
+    std::atomic_store(&GetClockHolder(), newClock);
+}
+
+int64_t SteadyCellularCallClock::NowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t SteadyCellularCallClock::NowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+CellularCallClock::TimerId SteadyCellularCallClock::PostDelayed(const Task &task, int64_t delayMs)
+{
+    if (task == nullptr) {
+        return 0;
+    }
+    std::weak_ptr<CellularCallClock> weak = weak_from_this();
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    TimerId timerId = nextTimerId_++;
+    auto timerTask = [weak, timerId, task]() {
+        auto clock = std::static_pointer_cast<SteadyCellularCallClock>(weak.lock());
+        if (clock != nullptr) {
+            std::lock_guard<ffrt::mutex> lock(clock->mutex_);
+            clock->timers_.erase(timerId);
+        }
+        task();
+    };
+    uint64_t delayUs = static_cast<uint64_t>(std::max<int64_t>(delayMs, 0)) * US_PER_MS;
+    ffrt::task_handle handle = ffrt::submit_h(timerTask, {}, {}, ffrt::task_attr().delay(delayUs));
+    if (handle == nullptr) {
+        TELEPHONY_LOGE("submit timer task fail");
+        return 0;
+    }
+    timers_.emplace(timerId, std::move(handle));
+    return timerId;
+}
+
+bool SteadyCellularCallClock::Cancel(TimerId timerId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto it = timers_.find(timerId);
+    if (it == timers_.end()) {
+        return false;
+    }
+    bool isSkipped = ffrt::skip(it->second) == 0;
+    timers_.erase(it);
+    return isSkipped;
+}
+
+void SteadyCellularCallClock::SleepMs(int64_t delayMs)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+}
+
+bool SteadyCellularCallClock::WaitFor(std::unique_lock<std::mutex> &lock, std::condition_variable &cv,
+    int64_t timeoutMs, const Predicate &predicate)
+{
+    return cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), predicate);
+}
+
+bool SteadyCellularCallClock::SendEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler,
+    AppExecFwk::InnerEvent::Pointer &event, int64_t delayMs, AppExecFwk::EventHandler::Priority priority)
+{
+    if (handler == nullptr || event == nullptr) {
+        return false;
+    }
+    return handler->SendEvent(event, delayMs, priority);
+}
+
+int64_t VirtualCellularCallClock::NowMs()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return nowMs_;
+}
+
+CellularCallClock::TimerId VirtualCellularCallClock::PostDelayed(const Task &task, int64_t delayMs)
+{
+    if (task == nullptr) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    TimerId timerId = nextTimerId_++;
+    timers_.emplace(nowMs_ + std::max<int64_t>(delayMs, 0), Timer { timerId, task });
+    return timerId;
+}
+
+bool VirtualCellularCallClock::Cancel(TimerId timerId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find_if(
+        timers_.begin(), timers_.end(), [timerId](const auto &timer) { return timer.second.timerId == timerId; });
+    if (it == timers_.end()) {
+        return false;
+    }
+    timers_.erase(it);
+    return true;
+}
+
+void VirtualCellularCallClock::SleepMs(int64_t delayMs)
+{
+    AdvanceMs(delayMs);
+}
+
+bool VirtualCellularCallClock::WaitFor(std::unique_lock<std::mutex> &lock, std::condition_variable &cv,
+    int64_t timeoutMs, const Predicate &predicate)
+{
+    int64_t deadline = NowMs() + std::max<int64_t>(timeoutMs, 0);
+    while (!predicate()) {
+        // the due tasks may take the lock of the waiter, like a notifier would
+        lock.unlock();
+        bool hasRun = RunNextTimer(deadline);
+        lock.lock();
+        if (!hasRun) {
+            std::lock_guard<std::mutex> timeLock(mutex_);
+            nowMs_ = std::max(nowMs_, deadline);
+            return predicate();
+        }
+    }
+    return true;
+}
+
+bool VirtualCellularCallClock::SendEvent(const std::shared_ptr<AppExecFwk::EventHandler> &handler,
+    AppExecFwk::InnerEvent::Pointer &event, int64_t delayMs, AppExecFwk::EventHandler::Priority priority)
+{
+    if (handler == nullptr || event == nullptr) {
+        return false;
+    }
+    if (delayMs <= 0) {
+        return handler->SendEvent(event, 0, priority);
+    }
+    std::weak_ptr<AppExecFwk::EventHandler> weakHandler = handler;
+    auto pendingEvent = std::make_shared<AppExecFwk::InnerEvent::Pointer>(std::move(event));
+    return PostDelayed([weakHandler, pendingEvent, priority]() {
+        auto strongHandler = weakHandler.lock();
+        if (strongHandler != nullptr) {
+            strongHandler->SendEvent(*pendingEvent, 0, priority);
+        }
+    }, delayMs) != 0;
+}
+
+void VirtualCellularCallClock::AdvanceMs(int64_t deltaMs)
+{
+    int64_t target = NowMs() + std::max<int64_t>(deltaMs, 0);
+    while (RunNextTimer(target)) {
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    nowMs_ = std::max(nowMs_, target);
+}
+
+size_t VirtualCellularCallClock::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return timers_.size();
+}
+
+bool VirtualCellularCallClock::RunNextTimer(int64_t limitMs)
+{
+    Task task = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (timers_.empty() || timers_.begin()->first > limitMs) {
+            return false;
+        }
+        nowMs_ = std::max(nowMs_, timers_.begin()->first);
+        task = timers_.begin()->second.task;
+        timers_.erase(timers_.begin());
+    }
+    task();
+    return true;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -15,8 +15,13 @@
 
 #include "cellular_call_config.h"
 
+#include <algorithm>
+
+#include "cellular_call_clock.h"
 #include "cellular_call_data_struct.h"
+#include "cellular_call_ecc_cache.h"
 #include "cellular_call_hisysevent.h"
+#include "cellular_call_parameter_cache.h"
 #include "cellular_call_rdb_helper.h"
 #include "cellular_call_register.h"
 #include "cellular_call_service.h"
@@ -63,78 +68,142 @@ static constexpr int32_t NR_MODE_MIN = static_cast<int32_t>(PreferredNetworkMode
 static constexpr int32_t NR_MODE_MAX =
     static_cast<int32_t>(PreferredNetworkMode::CORE_NETWORK_MODE_NR_LTE_TDSCDMA_WCDMA_GSM_EVDO_CDMA);
 static constexpr int32_t DEFAULT_NETWORK_MODE = static_cast<int32_t>(PreferredNetworkMode::CORE_NETWORK_MODE_MAX_VALUE);
+static constexpr uint64_t FINGERPRINT_OFFSET_BASIS = 14695981039346656037ULL;
+static constexpr uint64_t FINGERPRINT_PRIME = 1099511628211ULL;
+// the reason and its message, a mapped reason may follow
+static constexpr size_t DISCONNECT_REASON_MAPPING_MIN_FIELDS = 2;
+
+// FNV-1a, strings and containers are prefixed by their size so that adjacent values cannot be confused
+static void HashBytes(uint64_t &hash, const void *data, size_t length)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * FINGERPRINT_PRIME;
+    }
+}
+
+template<typename T>
+static void HashValue(uint64_t &hash, const T &value)
+{
+    HashBytes(hash, &value, sizeof(value));
+}
+
+static void HashValue(uint64_t &hash, const std::string &value)
+{
+    HashValue(hash, value.size());
+    HashBytes(hash, value.data(), value.size());
+}
+
+template<typename T>
+static void HashValue(uint64_t &hash, const std::vector<T> &values)
+{
+    HashValue(hash, values.size());
+    for (const auto &value : values) {
+        HashValue(hash, value);
+    }
+}
+
+template<typename T>
+static void HashValue(uint64_t &hash, const std::map<std::string, T> &values)
+{
+    HashValue(hash, values.size());
+    for (const auto &item : values) {
+        HashValue(hash, item.first);
+        HashValue(hash, item.second);
+    }
+}
 
-std::map<int32_t, int32_t> CellularCallConfig::modeMap_;
-std::map<int32_t, int32_t> CellularCallConfig::modeTempMap_;
-std::map<int32_t, bool> CellularCallConfig::imsSwitchOnByDefault_;
-std::map<int32_t, bool> CellularCallConfig::hideImsSwitch_;
-std::map<int32_t, bool> CellularCallConfig::volteSupported_;
-std::map<int32_t, bool> CellularCallConfig::carrierVtAvailable_;
-std::map<int32_t, std::vector<int32_t>> CellularCallConfig::nrModeSupportedList_;
-std::map<int32_t, bool> CellularCallConfig::volteProvisioningSupported_;
-std::map<int32_t, bool> CellularCallConfig::ssOverUtSupported_;
-std::map<int32_t, bool> CellularCallConfig::imsGbaRequired_;
-std::map<int32_t, bool> CellularCallConfig::utProvisioningSupported_;
-std::map<int32_t, bool> CellularCallConfig::imsPreferForEmergency_;
-std::map<int32_t, int32_t> CellularCallConfig::callWaitingServiceClass_;
-std::map<int32_t, std::vector<std::string>> CellularCallConfig::imsCallDisconnectResoninfoMapping_;
-std::map<int32_t, bool> CellularCallConfig::forceVolteSwitchOn_;
-std::map<int32_t, bool> CellularCallConfig::videoCallWaiting_;
-std::map<int32_t, int32_t> CellularCallConfig::vonrSwithStatus_;
-std::map<int32_t, bool> CellularCallConfig::imsSipCauseEnable_;
-std::map<int32_t, bool> CellularCallConfig::shouldCheckImsAfterNvUpdate_;
 int32_t CellularCallConfig::lastDisconnectCode_ = 0;
-std::shared_mutex CellularCallConfig::mutex_;
-ffrt::mutex CellularCallConfig::operatorMutex_;
-std::shared_mutex CellularCallConfig::simStateLock_;
-std::map<int32_t, std::vector<EmergencyCall>> CellularCallConfig::eccListRadioMap_;
-std::vector<EmergencyCall> CellularCallConfig::eccList3gppHasSim_;
-std::vector<EmergencyCall> CellularCallConfig::eccList3gppNoSim_;
-std::map<int32_t, std::vector<EmergencyCall>> CellularCallConfig::allEccList_;
-std::map<int32_t, int32_t> CellularCallConfig::simState_;
-std::map<int32_t, std::string> CellularCallConfig::curPlmn_;
-std::map<int32_t, CellularCallConfig::cellularNetworkState> CellularCallConfig::networkServiceState_;
-std::map<int32_t, bool> CellularCallConfig::readyToCall_;
+std::vector<std::shared_ptr<const SlotConfig>> CellularCallConfig::slotConfigs_(SIM_SLOT_COUNT);
+std::vector<std::shared_ptr<const SlotUpdateState>> CellularCallConfig::slotUpdateStates_(SIM_SLOT_COUNT);
+ffrt::mutex CellularCallConfig::slotConfigMutex_;
 bool CellularCallConfig::isOperatorConfigInit_ = false;
 #ifdef CELLULAR_CALL_REDCAP_ABILITY
-bool CellularCallConfig::isRadioOn_ = false;
-bool CellularCallConfig::isOperatorConfigChanged_ = false;
+std::atomic<bool> CellularCallConfig::isRadioOn_ { false };
+std::atomic<bool> CellularCallConfig::isOperatorConfigChanged_ { false };
 #endif
-std::vector<CellularCallConfig::EccList> CellularCallConfig::hplmnEccList_(SIM_SLOT_COUNT);
-std::vector<CellularCallConfig::EccList> CellularCallConfig::currentPlmnEccList_(SIM_SLOT_COUNT);
-std::vector<CellularCallConfig::EccList> CellularCallConfig::hplmnFakeEccList_(SIM_SLOT_COUNT);
-ffrt::mutex CellularCallConfig::plmnMutex_;
-ffrt::mutex CellularCallConfig::modeMutex_;
+std::vector<int32_t> CellularCallConfig::slotTaskKeys_(SIM_SLOT_COUNT);
+CellularCallEccPlmnLru CellularCallConfig::eccPlmnLru_;
+std::vector<CellularCallEccMerger> CellularCallConfig::eccMergers_(SIM_SLOT_COUNT);
+
+std::shared_ptr<SlotConfig> CellularCallConfig::CreateDefaultSlotConfig()
+{
+    auto config = std::make_shared<SlotConfig>();
+    config->volteSupported = true;
+    config->carrierVtAvailable = true;
+    config->nrModeSupportedList = std::vector<int32_t> { CARRIER_NR_AVAILABILITY_NSA, CARRIER_NR_AVAILABILITY_SA };
+    config->imsPreferForEmergency = true;
+    config->callWaitingServiceClass = DEFAULT_CALL_WAITING_SERVICE_CLASS_CONFIG;
+    config->imsCallDisconnectResoninfoMapping = IMS_CALL_DISCONNECT_REASONINFO_MAPPING_CONFIG;
+    config->disconnectReasonTable = ParseDisconnectReasonMapping(config->imsCallDisconnectResoninfoMapping);
+    config->disconnectReasonTableVersion = 1;
+    config->readyToCall = true;
+    config->vonrSwitchStatus = VONR_SWITCH_STATUS_UNKNOWN;
+    config->videoCallWaiting = true;
+    config->shouldCheckImsAfterNvUpdate = true;
+    return config;
+}
 
 void CellularCallConfig::InitDefaultOperatorConfig()
 {
-    std::lock_guard<ffrt::mutex> lock(operatorMutex_);
+    std::lock_guard<ffrt::mutex> lock(slotConfigMutex_);
     for (int32_t i = DEFAULT_SIM_SLOT_ID; i < SIM_SLOT_COUNT; ++i) {
-        CellularCallConfig::imsSwitchOnByDefault_.insert(std::pair<int, bool>(i, false));
-        CellularCallConfig::hideImsSwitch_.insert(std::pair<int, bool>(i, false));
-        CellularCallConfig::volteSupported_.insert(std::pair<int, bool>(i, true));
-        CellularCallConfig::carrierVtAvailable_.insert(std::pair<int, bool>(i, true));
-        CellularCallConfig::nrModeSupportedList_.insert(std::pair<int, std::vector<int32_t>>(
-            i, std::vector<int32_t> { CARRIER_NR_AVAILABILITY_NSA, CARRIER_NR_AVAILABILITY_SA }));
-        CellularCallConfig::volteProvisioningSupported_.insert(std::pair<int, bool>(i, false));
-        CellularCallConfig::ssOverUtSupported_.insert(std::pair<int, bool>(i, false));
-        CellularCallConfig::imsGbaRequired_.insert(std::pair<int, bool>(i, false));
-        CellularCallConfig::utProvisioningSupported_.insert(std::pair<int, bool>(i, false));
-        CellularCallConfig::imsPreferForEmergency_.insert(std::pair<int, bool>(i, true));
-        CellularCallConfig::callWaitingServiceClass_.insert(
-            std::pair<int, int32_t>(i, DEFAULT_CALL_WAITING_SERVICE_CLASS_CONFIG));
-        CellularCallConfig::imsCallDisconnectResoninfoMapping_.insert(
-            std::pair<int, std::vector<std::string>>(i, IMS_CALL_DISCONNECT_REASONINFO_MAPPING_CONFIG));
-        CellularCallConfig::forceVolteSwitchOn_.insert(std::pair<int, bool>(i, false));
-        CellularCallConfig::readyToCall_.insert(std::pair<int, bool>(i, true));
-        CellularCallConfig::vonrSwithStatus_.insert(std::pair<int, int>(i, VONR_SWITCH_STATUS_UNKNOWN));
-        CellularCallConfig::cellularNetworkState cellularState;
-        CellularCallConfig::networkServiceState_.insert(std::pair<int, CellularCallConfig::cellularNetworkState>(i,
-            cellularState));
-        CellularCallConfig::videoCallWaiting_.insert(std::pair<int, bool>(i, true));
-        CellularCallConfig::imsSipCauseEnable_.insert(std::pair<int, bool>(i, false));
-        CellularCallConfig::shouldCheckImsAfterNvUpdate_.insert(std::pair<int, bool>(i, true));
+        if (std::atomic_load(&slotConfigs_[i]) == nullptr) {
+            std::shared_ptr<const SlotConfig> config = CreateDefaultSlotConfig();
+            std::atomic_store(&slotConfigs_[i], config);
+        }
+    }
+}
+
+std::shared_ptr<const SlotConfig> CellularCallConfig::GetSlotConfig(int32_t slotId)
+{
+    static const std::shared_ptr<const SlotConfig> emptyConfig = std::make_shared<SlotConfig>();
+    if (slotId < DEFAULT_SIM_SLOT_ID || slotId >= SIM_SLOT_COUNT) {
+        return emptyConfig;
+    }
+    std::shared_ptr<const SlotConfig> config = std::atomic_load(&slotConfigs_[slotId]);
+    return config != nullptr ? config : emptyConfig;
+}
+
+void CellularCallConfig::UpdateSlotConfig(int32_t slotId, const std::function<void(SlotConfig &)> &updater)
+{
+    if (slotId < DEFAULT_SIM_SLOT_ID || slotId >= SIM_SLOT_COUNT) {
+        return;
     }
+    std::lock_guard<ffrt::mutex> lock(slotConfigMutex_);
+    std::shared_ptr<const SlotConfig> current = std::atomic_load(&slotConfigs_[slotId]);
+    std::shared_ptr<SlotConfig> next =
+        current != nullptr ? std::make_shared<SlotConfig>(*current) : CreateDefaultSlotConfig();
+    updater(*next);
+    next->version = current != nullptr ? current->version + 1 : 1;
+    std::shared_ptr<const SlotConfig> published = next;
+    std::atomic_store(&slotConfigs_[slotId], published);
+}
+
+std::shared_ptr<const SlotUpdateState> CellularCallConfig::GetSlotUpdateState(int32_t slotId)
+{
+    static const std::shared_ptr<const SlotUpdateState> emptyState = std::make_shared<SlotUpdateState>();
+    if (slotId < DEFAULT_SIM_SLOT_ID || slotId >= SIM_SLOT_COUNT) {
+        return emptyState;
+    }
+    std::shared_ptr<const SlotUpdateState> state = std::atomic_load(&slotUpdateStates_[slotId]);
+    return state != nullptr ? state : emptyState;
+}
+
+void CellularCallConfig::UpdateSlotUpdateState(
+    int32_t slotId, const std::function<void(SlotUpdateState &)> &updater)
+{
+    if (slotId < DEFAULT_SIM_SLOT_ID || slotId >= SIM_SLOT_COUNT) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(slotConfigMutex_);
+    std::shared_ptr<const SlotUpdateState> current = std::atomic_load(&slotUpdateStates_[slotId]);
+    std::shared_ptr<SlotUpdateState> next =
+        current != nullptr ? std::make_shared<SlotUpdateState>(*current) : std::make_shared<SlotUpdateState>();
+    updater(*next);
+    next->version = current != nullptr ? current->version + 1 : 1;
+    std::shared_ptr<const SlotUpdateState> published = next;
+    std::atomic_store(&slotUpdateStates_[slotId], published);
 }
 
 CellularCallConfig::CellularCallConfig()
@@ -151,7 +220,7 @@ int32_t CellularCallConfig::SetDomainPreferenceMode(int32_t slotId, int32_t mode
         TELEPHONY_LOGE("SetDomainPreferenceMode return, mode out of range!");
         return CALL_ERR_PARAMETER_OUT_OF_RANGE;
     }
-    modeTempMap_[slotId] = mode;
+    UpdateSlotConfig(slotId, [mode](SlotConfig &config) { config.tempDomainPreferenceMode = mode; });
     return configRequest_.SetDomainPreferenceModeRequest(slotId, mode);
 }
 
@@ -163,7 +232,7 @@ int32_t CellularCallConfig::GetDomainPreferenceMode(int32_t slotId)
 int32_t CellularCallConfig::SetImsSwitchStatus(int32_t slotId, bool active)
 {
     TELEPHONY_LOGI("entry, slotId:%{public}d, active:%{public}d", slotId, active);
-    if (!volteSupported_[slotId]) {
+    if (!GetSlotConfig(slotId)->volteSupported) {
         TELEPHONY_LOGE("Enable ims switch failed due to volte is not supported.");
         return CALL_ERR_VOLTE_NOT_SUPPORT;
     }
@@ -195,8 +264,7 @@ int32_t CellularCallConfig::SetImsSwitchStatus(int32_t slotId, bool active)
 
 int32_t CellularCallConfig::GetImsSwitchStatus(int32_t slotId, bool &enabled)
 {
-    auto itorHide = hideImsSwitch_.find(slotId);
-    if (itorHide != hideImsSwitch_.end() && itorHide->second) {
+    if (GetSlotConfig(slotId)->hideImsSwitch) {
         enabled = true;
         return TELEPHONY_SUCCESS;
     }
@@ -207,13 +275,7 @@ int32_t CellularCallConfig::GetImsSwitchStatus(int32_t slotId, bool &enabled)
 int32_t CellularCallConfig::GetCarrierVtConfig(int32_t slotId, bool &enabled)
 {
     TELEPHONY_LOGD("entry, slotId: %{public}d", slotId);
-    auto itorHide = carrierVtAvailable_.find(slotId);
-    if (itorHide != carrierVtAvailable_.end()) {
-        enabled = itorHide -> second;
-    } else {
-        TELEPHONY_LOGI("do not find GetCarrierVtConfig");
-        enabled = false;
-    }
+    enabled = GetSlotConfig(slotId)->carrierVtAvailable;
     return TELEPHONY_SUCCESS;
 }
 
@@ -222,7 +284,7 @@ bool CellularCallConfig::GetCarrierVtAvailbleConfig(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return false;
     }
-    return carrierVtAvailable_[slotId];
+    return GetSlotConfig(slotId)->carrierVtAvailable;
 }
 
 int32_t CellularCallConfig::SetVoNRSwitchStatus(int32_t slotId, int32_t state)
@@ -237,8 +299,7 @@ int32_t CellularCallConfig::SetVoNRSwitchStatus(int32_t slotId, int32_t state)
     CoreManagerInner::GetInstance().GetSimState(slotId, simState);
     if (simState == SimState::SIM_STATE_LOADED || simState == SimState::SIM_STATE_READY) {
         configRequest_.SetVoNRSwitchStatusRequest(slotId, state);
-        std::lock_guard<ffrt::mutex> lock(operatorMutex_);
-        vonrSwithStatus_[slotId] = state;
+        UpdateSlotConfig(slotId, [state](SlotConfig &config) { config.vonrSwitchStatus = state; });
         return TELEPHONY_SUCCESS;
     }
     return TELEPHONY_ERR_NO_SIM_CARD;
@@ -262,10 +323,9 @@ void CellularCallConfig::HandleSimStateChanged(int32_t slotId)
     }
     TELEPHONY_LOGI("CellularCallConfig::HandleSimStateChanged entry, slotId: %{public}d", slotId);
     if (CheckAndUpdateSimState(slotId)) {
-        UpdateEccNumberList(slotId);
+        UpdateEccNumberListAsync(slotId);
     }
-    std::lock_guard<ffrt::mutex> lock(operatorMutex_);
-    shouldCheckImsAfterNvUpdate_[slotId] = true;
+    UpdateSlotConfig(slotId, [](SlotConfig &config) { config.shouldCheckImsAfterNvUpdate = true; });
 }
 
 void CellularCallConfig::HandleFactoryReset(int32_t slotId)
@@ -280,7 +340,7 @@ void CellularCallConfig::HandleFactoryReset(int32_t slotId)
         return;
     }
     // Set VoLTE to default
-    int32_t ret = SaveImsSwitch(slotId, BooleanToImsSwitchValue(imsSwitchOnByDefault_[slotId]));
+    int32_t ret = SaveImsSwitch(slotId, BooleanToImsSwitchValue(GetSlotConfig(slotId)->imsSwitchOnByDefault));
     TELEPHONY_LOGI("Save ims switch ret: %{public}d", ret);
     UpdateImsCapabilities(slotId, true, false, INVALID_OPERATOR_CONFIG_STATE);
 #ifdef CELLULAR_CALL_REDCAP_ABILITY
@@ -295,9 +355,8 @@ void CellularCallConfig::HandleSimRecordsLoaded(int32_t slotId)
     }
     TELEPHONY_LOGI("CellularCallConfig::HandleSimRecordsLoaded entry, slotId: %{public}d", slotId);
     CheckAndUpdateSimState(slotId);
-    UpdateEccNumberList(slotId);
-    std::lock_guard<ffrt::mutex> lock(operatorMutex_);
-    shouldCheckImsAfterNvUpdate_[slotId] = true;
+    UpdateEccNumberListAsync(slotId);
+    UpdateSlotConfig(slotId, [](SlotConfig &config) { config.shouldCheckImsAfterNvUpdate = true; });
 }
 
 void CellularCallConfig::HandleResidentNetworkChange(int32_t slotId, std::string plmn)
@@ -306,11 +365,11 @@ void CellularCallConfig::HandleResidentNetworkChange(int32_t slotId, std::string
         return;
     }
     TELEPHONY_LOGI("CellularCallConfig::HandleResidentNetworkChange entry, slotId: %{public}d", slotId);
-    std::unique_lock<ffrt::mutex> lock(modeMutex_);
-    curPlmn_[slotId] = plmn;
-    lock.unlock();
+    std::string oldPlmn = GetSlotConfig(slotId)->curPlmn;
+    UpdateSlotConfig(slotId, [&plmn](SlotConfig &config) { config.curPlmn = plmn; });
     CheckAndUpdateSimState(slotId);
-    UpdateEccNumberList(slotId);
+    PrefetchEccListAsync(slotId, oldPlmn, plmn);
+    UpdateEccNumberListAsync(slotId);
 }
 
 void CellularCallConfig::HandleNetworkStateChange(int32_t slotId)
@@ -318,36 +377,35 @@ void CellularCallConfig::HandleNetworkStateChange(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return;
     }
-    {
-        std::lock_guard<ffrt::mutex> lock(operatorMutex_);
-        TELEPHONY_LOGI("CellularCallConfig::HandleNetworkStateChange entry, slotId: %{public}d", slotId);
-        auto itSlotId = networkServiceState_.find(slotId);
-        if (itSlotId == networkServiceState_.end()) {
-            TELEPHONY_LOGE("slotId is not in networkServiceState_");
-            return;
-        }
-        sptr<NetworkState> networkState = nullptr;
-        CoreManagerInner::GetInstance().GetNetworkStatus(slotId, networkState);
-        if (networkState == nullptr) {
-            TELEPHONY_LOGE("networkState get failed, slotId: %{public}d", slotId);
-            return;
-        }
-        bool isInSrv = networkState->GetRegStatus() == RegServiceState::REG_STATE_IN_SERVICE ? true : false;
-        if (isInSrv && shouldCheckImsAfterNvUpdate_[slotId]) {
-            GetImsSwitchStatusRequest(slotId);
-            shouldCheckImsAfterNvUpdate_[slotId] = false;
-        }
-        bool isRoam = networkState->IsRoaming();
-        if (networkServiceState_[slotId].isInService_ == isInSrv
-            && networkServiceState_[slotId].isRoaming_ == isRoam) {
-            TELEPHONY_LOGI("service state and roaming state are not change, slotId: %{public}d", slotId);
-            return;
+    TELEPHONY_LOGI("CellularCallConfig::HandleNetworkStateChange entry, slotId: %{public}d", slotId);
+    sptr<NetworkState> networkState = nullptr;
+    CoreManagerInner::GetInstance().GetNetworkStatus(slotId, networkState);
+    if (networkState == nullptr) {
+        TELEPHONY_LOGE("networkState get failed, slotId: %{public}d", slotId);
+        return;
+    }
+    bool isInSrv = networkState->GetRegStatus() == RegServiceState::REG_STATE_IN_SERVICE ? true : false;
+    bool isRoam = networkState->IsRoaming();
+    bool needCheckIms = false;
+    bool isChanged = false;
+    UpdateSlotConfig(slotId, [isInSrv, isRoam, &needCheckIms, &isChanged](SlotConfig &config) {
+        if (isInSrv && config.shouldCheckImsAfterNvUpdate) {
+            needCheckIms = true;
+            config.shouldCheckImsAfterNvUpdate = false;
         }
-        networkServiceState_[slotId].isInService_ = isInSrv;
-        networkServiceState_[slotId].isRoaming_ = isRoam;
+        isChanged = config.isInService != isInSrv || config.isRoaming != isRoam;
+        config.isInService = isInSrv;
+        config.isRoaming = isRoam;
+    });
+    if (needCheckIms) {
+        GetImsSwitchStatusRequest(slotId);
+    }
+    if (!isChanged) {
+        TELEPHONY_LOGI("service state and roaming state are not change, slotId: %{public}d", slotId);
+        return;
     }
     CheckAndUpdateSimState(slotId);
-    UpdateEccNumberList(slotId);
+    UpdateEccNumberListAsync(slotId);
 }
 
 void CellularCallConfig::GetEccListFromResult(const std::vector<EccNum> &eccVec,
@@ -373,15 +431,34 @@ int32_t CellularCallConfig::CheckHomeAndPresentState(int32_t slotId, bool &isHom
     bool isRoam = networkState->IsRoaming();
     bool isNetworkInService = (regState == RegServiceState::REG_STATE_IN_SERVICE);
     bool isHomeNetRegister = isNetworkInService && !isRoam;
-    bool isSimPresent = false;
-    {
-        std::shared_lock<std::shared_mutex> lock(simStateLock_);
-        isSimPresent = simState_[slotId] == SIM_PRESENT;
-    }
+    bool isSimPresent = GetSlotConfig(slotId)->simState == SIM_PRESENT;
     isHomeAndPresent = isHomeNetRegister && isSimPresent;
     return TELEPHONY_SUCCESS;
 }
 
+void CellularCallConfig::SubmitSlotTask(int32_t slotId, std::function<void()> &&task)
+{
+    // the tasks of one slot share an output dependence, so ffrt runs them one by one in submission order
+    ffrt::submit(std::move(task), {}, { &slotTaskKeys_[slotId] });
+}
+
+void CellularCallConfig::UpdateEccNumberListAsync(int32_t slotId)
+{
+    if (!IsValidSlotId(slotId)) {
+        return;
+    }
+    int64_t nowMs = CellularCallClock::GetInstance()->NowMs();
+    UpdateSlotUpdateState(slotId, [nowMs](SlotUpdateState &state) {
+        if (state.eccReadyStats.requestTimeMs == 0) {
+            state.eccReadyStats.requestTimeMs = nowMs;
+        }
+    });
+    SubmitSlotTask(slotId, [slotId]() {
+        CellularCallConfig config;
+        config.UpdateEccNumberList(slotId);
+    });
+}
+
 void CellularCallConfig::UpdateEccNumberList(int32_t slotId)
 {
     if (!IsValidSlotId(slotId)) {
@@ -396,6 +473,17 @@ void CellularCallConfig::UpdateEccNumberList(int32_t slotId)
     if (CheckHomeAndPresentState(slotId, isHomeAndPresent) != TELEPHONY_SUCCESS) {
         return;
     }
+    uint64_t fingerprint = GetEccInputFingerprint(slotId, hplmn, isHomeAndPresent);
+    bool isInputChanged = false;
+    UpdateSlotUpdateState(slotId, [fingerprint, &isInputChanged](SlotUpdateState &state) {
+        isInputChanged = state.eccInputFingerprint != fingerprint;
+        state.eccInputFingerprint = fingerprint;
+    });
+    if (!isInputChanged) {
+        TELEPHONY_LOGI("[slot%{public}d] ecc inputs are not changed", slotId);
+        RecordEccReady(slotId, EccListSource::MEMORY);
+        return;
+    }
     bool isHplmnEccList = false;
     if (!hplmn.empty() && isHomeAndPresent) {
         if (ProcessHplmnEccList(slotId, hplmn, isHplmnEccList, callListWithCard, callListNoCard)) {
@@ -413,16 +501,13 @@ void CellularCallConfig::UpdateEccNumberList(int32_t slotId)
     for (auto it : callListNoCard) {
         eccInfoList.push_back(BuildDefaultEmergencyCall(it, SimpresentType::TYPE_NO_CARD));
     }
-    std::unique_lock<ffrt::mutex> lock(plmnMutex_);
-    if (isHplmnEccList) {
-        hplmnEccList_[slotId].eccInfoList = eccInfoList;
-        hplmnEccList_[slotId].plmn = hplmn;
-    } else {
-        currentPlmnEccList_[slotId].eccInfoList = eccInfoList;
-        currentPlmnEccList_[slotId].plmn = curPlmn_[slotId];
-    }
-    lock.unlock();
+    std::string plmn = isHplmnEccList ? hplmn : GetSlotConfig(slotId)->curPlmn;
+    std::shared_ptr<const PlmnEccList> plmnEccList = std::make_shared<PlmnEccList>(PlmnEccList { plmn, eccInfoList });
+    UpdateSlotUpdateState(slotId, [isHplmnEccList, &plmnEccList](SlotUpdateState &state) {
+        (isHplmnEccList ? state.hplmnEccList : state.currentPlmnEccList) = plmnEccList;
+    });
     SetEmergencyCallList(slotId, eccInfoList);
+    RecordEccReady(slotId, eccListSource_);
 }
 
 bool CellularCallConfig::ProcessHplmnEccList(int32_t slotId, std::string hplmn, bool &isHplmnEccList,
@@ -432,18 +517,19 @@ bool CellularCallConfig::ProcessHplmnEccList(int32_t slotId, std::string hplmn,
     CoreManagerInner::GetInstance().GetOperatorConfigs(slotId, operatorConfig);
     callListWithCard = operatorConfig.stringArrayValue[KEY_EMERGENCY_CALL_STRING_ARRAY];
     if (callListWithCard.empty()) {
-        std::unique_lock<ffrt::mutex> lock(plmnMutex_);
-        if (hplmnEccList_[slotId].plmn == hplmn) {
-            SetEmergencyCallList(slotId, hplmnEccList_[slotId].eccInfoList);
+        std::shared_ptr<const PlmnEccList> hplmnEccList = GetSlotUpdateState(slotId)->hplmnEccList;
+        if (hplmnEccList != nullptr && hplmnEccList->plmn == hplmn) {
+            SetEmergencyCallList(slotId, hplmnEccList->eccInfoList);
+            RecordEccReady(slotId, EccListSource::MEMORY);
             return true;
         }
-        lock.unlock();
         std::vector<EccNum> eccVec;
-        if (DelayedSingleton<CellularCallRdbHelper>::GetInstance()->QueryEccList(hplmn, eccVec) == TELEPHONY_SUCCESS) {
+        if (QueryEccList(slotId, hplmn, eccVec) == TELEPHONY_SUCCESS) {
             GetEccListFromResult(eccVec, callListWithCard, callListNoCard);
             isHplmnEccList = true;
             return false;
         }
+        UpdateSlotUpdateState(slotId, [](SlotUpdateState &state) { state.eccInputFingerprint = 0; });
         return true;
     }
     std::vector<EmergencyCall> eccInfoList;
@@ -451,37 +537,232 @@ bool CellularCallConfig::ProcessHplmnEccList(int32_t slotId, std::string hplmn,
         eccInfoList.push_back(BuildDefaultEmergencyCall(it, SimpresentType::TYPE_HAS_CARD));
     }
     SetEmergencyCallList(slotId, eccInfoList);
+    RecordEccReady(slotId, EccListSource::OPERATOR_CONFIG);
     return true;
 }
 
 bool CellularCallConfig::ProcessCurrentPlmnEccList(int32_t slotId, std::vector<std::string> &callListWithCard,
     std::vector<std::string> &callListNoCard)
 {
-    std::unique_lock<ffrt::mutex> lock(plmnMutex_);
-    if (curPlmn_[slotId].empty()) {
+    std::string curPlmn = GetSlotConfig(slotId)->curPlmn;
+    if (curPlmn.empty()) {
         std::u16string u16Rplmn = CoreManagerInner::GetInstance().GetOperatorNumeric(slotId);
-        std::string rplmn = Str16ToStr8(u16Rplmn);
-        if (rplmn.empty()) {
+        curPlmn = Str16ToStr8(u16Rplmn);
+        if (curPlmn.empty()) {
             TELEPHONY_LOGE("rplmn is empty");
+            UpdateSlotUpdateState(slotId, [](SlotUpdateState &state) { state.eccInputFingerprint = 0; });
             return true;
         }
-        curPlmn_[slotId] = rplmn;
+        UpdateSlotConfig(slotId, [&curPlmn](SlotConfig &config) {
+            if (config.curPlmn.empty()) {
+                config.curPlmn = curPlmn;
+            }
+        });
     }
     std::vector<EccNum> eccVec;
-    if (currentPlmnEccList_[slotId].plmn == curPlmn_[slotId]) {
-        SetEmergencyCallList(slotId, currentPlmnEccList_[slotId].eccInfoList);
+    std::shared_ptr<const PlmnEccList> currentPlmnEccList = GetSlotUpdateState(slotId)->currentPlmnEccList;
+    if (currentPlmnEccList != nullptr && currentPlmnEccList->plmn == curPlmn) {
+        SetEmergencyCallList(slotId, currentPlmnEccList->eccInfoList);
+        RecordEccReady(slotId, EccListSource::MEMORY);
         return true;
     }
-    std::string curPlmn = curPlmn_[slotId];
-    lock.unlock();
-    if (DelayedSingleton<CellularCallRdbHelper>::GetInstance()->QueryEccList(curPlmn, eccVec) !=
-        TELEPHONY_SUCCESS) {
+    if (QueryEccList(slotId, curPlmn, eccVec) != TELEPHONY_SUCCESS) {
+        UpdateSlotUpdateState(slotId, [](SlotUpdateState &state) { state.eccInputFingerprint = 0; });
         return true;
     }
     GetEccListFromResult(eccVec, callListWithCard, callListNoCard);
     return false;
 }
 
+static bool IsEmptyEccRow(const EccNum &eccNum)
+{
+    return eccNum.ecc_withcard.empty() && eccNum.ecc_nocard.empty() && eccNum.ecc_fake.empty();
+}
+
+int32_t CellularCallConfig::QueryEccList(int32_t slotId, const std::string &plmn, std::vector<EccNum> &eccVec)
+{
+    EccNum eccNum;
+    if (eccPlmnLru_.Get(plmn, eccNum)) {
+        if (!IsEmptyEccRow(eccNum)) {
+            eccVec.push_back(eccNum);
+        }
+        eccListSource_ = EccListSource::MEMORY;
+        return TELEPHONY_SUCCESS;
+    }
+    auto eccCache = DelayedSingleton<CellularCallEccCache>::GetInstance();
+    bool needVerify = false;
+    if (eccCache->Lookup(plmn, eccNum, needVerify)) {
+        if (!IsEmptyEccRow(eccNum)) {
+            eccVec.push_back(eccNum);
+        }
+        eccListSource_ = EccListSource::DISK_CACHE;
+        if (needVerify) {
+            VerifyEccCacheAsync(slotId, plmn);
+        } else {
+            eccPlmnLru_.Put(plmn, eccNum);
+        }
+        return TELEPHONY_SUCCESS;
+    }
+    int32_t ret = BatchQueryEccList(slotId, plmn, eccNum);
+    if (ret != TELEPHONY_SUCCESS) {
+        return ret;
+    }
+    if (!IsEmptyEccRow(eccNum)) {
+        eccVec.push_back(eccNum);
+    }
+    eccListSource_ = EccListSource::DATABASE;
+    bool isChanged = false;
+    eccCache->Store(plmn, eccNum, isChanged);
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CellularCallConfig::BatchQueryEccList(int32_t slotId, const std::string &plmn, EccNum &eccNum)
+{
+    std::vector<std::string> numerics = { plmn };
+    auto addNumeric = [&numerics](const std::string &numeric) {
+        if (!numeric.empty() && numerics.size() < ECC_PLMN_LRU_CAPACITY &&
+            std::find(numerics.begin(), numerics.end(), numeric) == numerics.end()) {
+            numerics.push_back(numeric);
+        }
+    };
+    std::u16string u16Hplmn = u"";
+    CoreManagerInner::GetInstance().GetSimOperatorNumeric(slotId, u16Hplmn);
+    std::string hplmn = Str16ToStr8(u16Hplmn);
+    std::string curPlmn = GetSlotConfig(slotId)->curPlmn;
+    for (const auto &numeric : { hplmn, curPlmn }) {
+        if (!eccPlmnLru_.Contains(numeric)) {
+            addNumeric(numeric);
+        }
+    }
+    std::vector<std::string> recentPlmns;
+    eccPlmnLru_.GetInvalidPlmns(recentPlmns);
+    for (const auto &numeric : recentPlmns) {
+        addNumeric(numeric);
+    }
+    std::vector<EccNum> eccVec;
+    int32_t ret = DelayedSingleton<CellularCallRdbHelper>::GetInstance()->QueryEccLists(numerics, {}, eccVec);
+    if (ret != TELEPHONY_SUCCESS) {
+        return ret;
+    }
+    TELEPHONY_LOGI("[slot%{public}d] query %{public}d plmns, %{public}d rows", slotId,
+        static_cast<int32_t>(numerics.size()), static_cast<int32_t>(eccVec.size()));
+    // the requested PLMN is put last, it is the most recently used one
+    for (auto numeric = numerics.rbegin(); numeric != numerics.rend(); ++numeric) {
+        auto row = std::find_if(eccVec.begin(), eccVec.end(),
+            [&numeric](const EccNum &eccRow) { return eccRow.numeric == *numeric; });
+        EccNum eccRow = row == eccVec.end() ? EccNum() : *row;
+        eccPlmnLru_.Put(*numeric, eccRow);
+        if (*numeric == plmn) {
+            eccNum = eccRow;
+        }
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+void CellularCallConfig::PrefetchEccListAsync(int32_t slotId, const std::string &oldPlmn,
+    const std::string &newPlmn)
+{
+    size_t mccLen = static_cast<size_t>(MCC_LEN);
+    if (newPlmn.length() < mccLen || oldPlmn.length() < mccLen || oldPlmn.compare(0, mccLen, newPlmn, 0, mccLen) == 0) {
+        return;
+    }
+    TELEPHONY_LOGI("[slot%{public}d] country changed, prefetch ecc lists", slotId);
+    SubmitSlotTask(slotId, [newPlmn]() { PrefetchEccList(newPlmn); });
+}
+
+void CellularCallConfig::PrefetchEccList(const std::string &plmn)
+{
+    if (eccPlmnLru_.Contains(plmn)) {
+        return;
+    }
+    std::vector<EccNum> eccVec;
+    if (DelayedSingleton<CellularCallRdbHelper>::GetInstance()->QueryEccLists(
+        { plmn }, { plmn.substr(0, MCC_LEN) }, eccVec) != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("prefetch ecc lists failed");
+        return;
+    }
+    EccNum eccNum;
+    for (const auto &row : eccVec) {
+        if (row.numeric == plmn) {
+            eccNum = row;
+            break;
+        }
+    }
+    eccPlmnLru_.Put(plmn, eccNum);
+    // the other networks of the country only fill the free room, the rows of the other slot are kept
+    uint32_t prefetchCount = 0;
+    for (const auto &row : eccVec) {
+        if (row.numeric != plmn && eccPlmnLru_.PutIfRoom(row.numeric, row)) {
+            prefetchCount++;
+        }
+    }
+    TELEPHONY_LOGI("prefetch %{public}u of %{public}zu ecc rows", prefetchCount, eccVec.size());
+}
+
+void CellularCallConfig::GetEccPlmnLruStats(EccPlmnLruStats &stats)
+{
+    eccPlmnLru_.GetStats(stats);
+}
+
+void CellularCallConfig::VerifyEccCacheAsync(int32_t slotId, const std::string &plmn)
+{
+    // queued behind the running update of the slot, which already pushed the cached list
+    SubmitSlotTask(slotId, [slotId, plmn]() {
+        std::vector<EccNum> eccVec;
+        if (DelayedSingleton<CellularCallRdbHelper>::GetInstance()->QueryEccList(plmn, eccVec) != TELEPHONY_SUCCESS) {
+            TELEPHONY_LOGE("[slot%{public}d] verify ecc cache failed", slotId);
+            return;
+        }
+        bool isChanged = false;
+        EccNum eccNum = eccVec.empty() ? EccNum() : eccVec[0];
+        eccPlmnLru_.Put(plmn, eccNum);
+        DelayedSingleton<CellularCallEccCache>::GetInstance()->Store(plmn, eccNum, isChanged);
+        if (!isChanged) {
+            return;
+        }
+        TELEPHONY_LOGI("[slot%{public}d] ecc cache of %{public}s is stale, reload", slotId, plmn.c_str());
+        CellularCallConfig config;
+        config.ClearCachedEcclist(slotId);
+        config.UpdateEccNumberList(slotId);
+    });
+}
+
+void CellularCallConfig::RecordEccReady(int32_t slotId, EccListSource source)
+{
+    int64_t now = CellularCallClock::GetInstance()->NowMs();
+    if (GetSlotUpdateState(slotId)->eccReadyStats.requestTimeMs == 0) {
+        return;
+    }
+    int64_t costMs = -1;
+    UpdateSlotUpdateState(slotId, [now, source, &costMs](SlotUpdateState &state) {
+        EccReadyStats &stats = state.eccReadyStats;
+        if (stats.requestTimeMs == 0) {
+            return;
+        }
+        costMs = now - stats.requestTimeMs;
+        stats.requestTimeMs = 0;
+        if (stats.bootReadyCostMs < 0) {
+            stats.bootReadyCostMs = costMs;
+        }
+        stats.lastReadyCostMs = costMs;
+        stats.lastSource = source;
+        stats.readyCount++;
+    });
+    if (costMs < 0) {
+        return;
+    }
+    TELEPHONY_LOGI("[slot%{public}d] ecc list ready in %{public}lld ms, source:%{public}d", slotId,
+        static_cast<long long>(costMs), static_cast<int32_t>(source));
+}
+
+void CellularCallConfig::GetEccReadyStats(int32_t slotId, EccReadyStats &stats)
+{
+    if (slotId < DEFAULT_SIM_SLOT_ID || slotId >= SIM_SLOT_COUNT) {
+        return;
+    }
+    stats = GetSlotUpdateState(slotId)->eccReadyStats;
+}
+
 void CellularCallConfig::HandleSimAccountLoaded(int32_t slotId)
 {
     if (!IsValidSlotId(slotId)) {
@@ -489,19 +770,16 @@ void CellularCallConfig::HandleSimAccountLoaded(int32_t slotId)
     }
     TELEPHONY_LOGI("entry, slotId: %{public}d", slotId);
     CheckAndUpdateSimState(slotId);
-    UpdateImsConfiguration(slotId, INVALID_OPERATOR_CONFIG_STATE, false);
-    UpdateEccNumberList(slotId);
+    UpdateImsConfigurationAsync(slotId, INVALID_OPERATOR_CONFIG_STATE, false);
+    UpdateEccNumberListAsync(slotId);
 }
 
 void CellularCallConfig::HandleOperatorConfigChanged(int32_t slotId, int32_t state)
 {
 #ifdef CELLULAR_CALL_REDCAP_ABILITY
-    {
-        std::unique_lock<std::shared_mutex> lock(mutex_);
-        isOperatorConfigChanged_ = true;
-    }
+    isOperatorConfigChanged_.store(true);
 #endif
-    UpdateImsConfiguration(slotId, state, true);
+    UpdateImsConfigurationAsync(slotId, state, true);
 }
 
 void CellularCallConfig::UpdateImsConfiguration(int32_t slotId, int32_t configState, bool isOpcChanged)
@@ -515,66 +793,280 @@ void CellularCallConfig::UpdateImsConfiguration(int32_t slotId, int32_t configSt
         TELEPHONY_LOGE("failed due to get operator config");
         return;
     }
+    uint64_t fingerprint = GetOperatorConfigFingerprint(operatorConfig);
+    if (isOpcChanged && IsOperatorConfigApplied(slotId, fingerprint, configState)) {
+        TELEPHONY_LOGI("[slot%{public}d] operator config is not changed", slotId);
+        return;
+    }
 
-    int32_t result = ParseAndCacheOperatorConfigs(slotId, operatorConfig);
+    uint32_t changes = OPERATOR_CONFIG_CHANGE_NONE;
+    int32_t result = ParseAndCacheOperatorConfigs(slotId, operatorConfig, fingerprint, changes);
     if (result != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("failed due to parse operator config");
         return;
     }
-    saveImsSwitchStatusToLocalForPowerOn(slotId);
-    ResetImsSwitch(slotId);
-    UpdateImsCapabilities(slotId, true, isOpcChanged, configState);
-    if (videoCallWaiting_.find(slotId) != videoCallWaiting_.end()) {
-        configRequest_.SetVideoCallWaiting(slotId, videoCallWaiting_[slotId]);
+    RecordOperatorConfigApplied(slotId, fingerprint, configState);
+    PushImsConfiguration(slotId, configState, isOpcChanged, changes);
+}
+
+void CellularCallConfig::UpdateImsConfigurationAsync(int32_t slotId, int32_t configState, bool isOpcChanged)
+{
+    if (!IsValidSlotId(slotId)) {
+        return;
     }
-    if (carrierVtAvailable_.find(slotId) != carrierVtAvailable_.end()) {
-        configRequest_.SetCarrierVtConfigRequest(slotId, carrierVtAvailable_[slotId]);
+    uint64_t generation = NewOperatorConfigRequest(slotId, isOpcChanged);
+    SubmitSlotTask(slotId, [slotId, configState, isOpcChanged, generation]() {
+        OperatorConfig operatorConfig;
+        if (CoreManagerInner::GetInstance().GetOperatorConfigs(slotId, operatorConfig) != TELEPHONY_SUCCESS) {
+            TELEPHONY_LOGE("[slot%{public}d] failed due to get operator config", slotId);
+            return;
+        }
+        uint64_t fingerprint = GetOperatorConfigFingerprint(operatorConfig);
+        if (isOpcChanged && IsOperatorConfigApplied(slotId, fingerprint, configState)) {
+            // a newer request supersedes this one, so the one in flight is dropped as well
+            TELEPHONY_LOGI("[slot%{public}d] operator config is not changed", slotId);
+            return;
+        }
+        auto result = std::make_shared<OperatorConfigParseResult>();
+        result->slotId = slotId;
+        result->configState = configState;
+        result->isOpcChanged = isOpcChanged;
+        result->generation = generation;
+        result->fingerprint = fingerprint;
+        result->snapshot = GetParsedOperatorConfigs(slotId, operatorConfig, fingerprint);
+        auto handler = DelayedSingleton<CellularCallService>::GetInstance()->GetHandler(slotId);
+        if (handler == nullptr) {
+            TELEPHONY_LOGE("[slot%{public}d] handler is null", slotId);
+            return;
+        }
+        if (!CellularCallHandler::SendLaneEvent(handler, handler->OPERATOR_CONFIG_PARSED_ID, result)) {
+            TELEPHONY_LOGE("[slot%{public}d] post parsed operator config failed", slotId);
+        }
+    });
+}
+
+void CellularCallConfig::ApplyImsConfiguration(const OperatorConfigParseResult &result)
+{
+    int32_t slotId = result.slotId;
+    if (!IsValidSlotId(slotId) || result.snapshot == nullptr) {
+        return;
+    }
+    bool isSuperseded = false;
+    UpdateSlotUpdateState(slotId, [&result, &isSuperseded](SlotUpdateState &state) {
+        isSuperseded = result.generation != state.operatorConfigGeneration;
+        if (!isSuperseded && !result.isOpcChanged) {
+            state.isFullImsPushPending = false;
+        }
+    });
+    if (isSuperseded) {
+        TELEPHONY_LOGI("[slot%{public}d] drop superseded operator config %{public}llu", slotId,
+            static_cast<unsigned long long>(result.generation));
+        return;
+    }
+    uint32_t changes = CacheOperatorConfigs(slotId, *result.snapshot);
+    RecordOperatorConfigApplied(slotId, result.fingerprint, result.configState);
+    PushImsConfiguration(slotId, result.configState, result.isOpcChanged, changes);
+}
+
+uint64_t CellularCallConfig::GetOperatorConfigFingerprint(const OperatorConfig &poc)
+{
+    uint64_t hash = FINGERPRINT_OFFSET_BASIS;
+    HashValue(hash, poc.boolValue);
+    HashValue(hash, poc.intValue);
+    HashValue(hash, poc.intArrayValue);
+    HashValue(hash, poc.stringValue);
+    HashValue(hash, poc.stringArrayValue);
+    return hash;
+}
+
+std::shared_ptr<const OperatorConfigSnapshot> CellularCallConfig::GetParsedOperatorConfigs(int32_t slotId,
+    OperatorConfig &poc, uint64_t fingerprint)
+{
+    std::shared_ptr<const SlotUpdateState> current = GetSlotUpdateState(slotId);
+    if (current->parsedOperatorConfig != nullptr && current->parsedOperatorConfigFingerprint == fingerprint) {
+        std::shared_ptr<const OperatorConfigSnapshot> parsed = current->parsedOperatorConfig;
+        UpdateSlotUpdateState(slotId, [](SlotUpdateState &state) { state.operatorConfigCacheStats.parseHits++; });
+        return parsed;
     }
+    std::shared_ptr<const OperatorConfigSnapshot> snapshot = ParseOperatorConfigs(poc);
+    UpdateSlotUpdateState(slotId, [fingerprint, &snapshot](SlotUpdateState &state) {
+        state.parsedOperatorConfigFingerprint = fingerprint;
+        state.parsedOperatorConfig = snapshot;
+        state.operatorConfigCacheStats.parses++;
+    });
+    return snapshot;
+}
+
+void CellularCallConfig::GetOperatorConfigCacheStats(int32_t slotId, OperatorConfigCacheStats &stats)
+{
+    stats = GetSlotUpdateState(slotId)->operatorConfigCacheStats;
+}
+
+uint64_t CellularCallConfig::NewOperatorConfigRequest(int32_t slotId, bool &isOpcChanged)
+{
+    uint64_t generation = 0;
+    UpdateSlotUpdateState(slotId, [&isOpcChanged, &generation](SlotUpdateState &state) {
+        state.isFullImsPushPending = state.isFullImsPushPending || !isOpcChanged;
+        isOpcChanged = !state.isFullImsPushPending;
+        generation = ++state.operatorConfigGeneration;
+    });
+    return generation;
 }
 
-int32_t CellularCallConfig::ParseAndCacheOperatorConfigs(int32_t slotId, OperatorConfig &poc)
+bool CellularCallConfig::IsOperatorConfigApplied(int32_t slotId, uint64_t fingerprint, int32_t configState)
+{
+    std::shared_ptr<const SlotUpdateState> state = GetSlotUpdateState(slotId);
+    return state->isOperatorConfigApplied && state->appliedOperatorConfigFingerprint == fingerprint &&
+        state->appliedOperatorConfigState == configState;
+}
+
+void CellularCallConfig::RecordOperatorConfigApplied(int32_t slotId, uint64_t fingerprint, int32_t configState)
+{
+    UpdateSlotUpdateState(slotId, [fingerprint, configState](SlotUpdateState &state) {
+        state.isOperatorConfigApplied = true;
+        state.appliedOperatorConfigFingerprint = fingerprint;
+        state.appliedOperatorConfigState = configState;
+    });
+}
+
+uint64_t CellularCallConfig::GetEccInputFingerprint(int32_t slotId, const std::string &hplmn, bool isHomeAndPresent)
+{
+    uint64_t hash = FINGERPRINT_OFFSET_BASIS;
+    HashValue(hash, hplmn);
+    HashValue(hash, isHomeAndPresent);
+    HashValue(hash, GetSlotUpdateState(slotId)->appliedOperatorConfigFingerprint);
+    HashValue(hash, GetSlotConfig(slotId)->curPlmn);
+    return hash;
+}
+
+void CellularCallConfig::PushImsConfiguration(int32_t slotId, int32_t configState, bool isOpcChanged,
+    uint32_t changes)
+{
+    // a push not caused by an operator config change, like a loaded sim account, sends every value again
+    if (!isOpcChanged) {
+        changes = OPERATOR_CONFIG_CHANGE_ALL;
+    }
+    if ((changes & OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY) != 0) {
+        saveImsSwitchStatusToLocalForPowerOn(slotId);
+        ResetImsSwitch(slotId);
+        UpdateImsCapabilities(slotId, true, isOpcChanged, configState);
+    } else {
+        configRequest_.NotifyOperatorConfigChanged(slotId, configState);
+    }
+    std::shared_ptr<const SlotConfig> config = GetSlotConfig(slotId);
+    if ((changes & OPERATOR_CONFIG_CHANGE_VIDEO_CALL_WAITING) != 0) {
+        configRequest_.SetVideoCallWaiting(slotId, config->videoCallWaiting);
+    }
+    if ((changes & OPERATOR_CONFIG_CHANGE_CARRIER_VT) != 0) {
+        configRequest_.SetCarrierVtConfigRequest(slotId, config->carrierVtAvailable);
+    }
+}
+
+int32_t CellularCallConfig::ParseAndCacheOperatorConfigs(int32_t slotId, OperatorConfig &poc, uint64_t fingerprint,
+    uint32_t &changes)
 {
     TELEPHONY_LOGI("CellularCallConfig::ParseAndCacheOperatorConfigs start. slotId %{public}d", slotId);
-    std::lock_guard<ffrt::mutex> lock(operatorMutex_);
     if (!IsValidSlotId(slotId)) {
         return TELEPHONY_ERROR;
     }
+    changes = CacheOperatorConfigs(slotId, *GetParsedOperatorConfigs(slotId, poc, fingerprint));
+    return TELEPHONY_SUCCESS;
+}
 
-    ParseBoolOperatorConfigs(slotId, imsSwitchOnByDefault_, poc, KEY_IMS_SWITCH_ON_BY_DEFAULT_BOOL);
-    ParseBoolOperatorConfigs(slotId, hideImsSwitch_, poc, KEY_HIDE_IMS_SWITCH_BOOL);
-    ParseBoolOperatorConfigs(slotId, volteSupported_, poc, KEY_VOLTE_SUPPORTED_BOOL);
-    ParseBoolOperatorConfigs(slotId, volteProvisioningSupported_, poc, KEY_VOLTE_PROVISIONING_SUPPORTED_BOOL);
-    ParseBoolOperatorConfigs(slotId, carrierVtAvailable_, poc, KEY_CARRIER_VT_AVAILABLE_BOOL);
-    ParseBoolOperatorConfigs(slotId, ssOverUtSupported_, poc, KEY_SS_OVER_UT_SUPPORTED_BOOL);
-    ParseBoolOperatorConfigs(slotId, imsGbaRequired_, poc, KEY_IMS_GBA_REQUIRED_BOOL);
-    ParseBoolOperatorConfigs(slotId, utProvisioningSupported_, poc, KEY_UT_PROVISIONING_SUPPORTED_BOOL);
-    ParseBoolOperatorConfigs(slotId, imsPreferForEmergency_, poc, KEY_IMS_PREFER_FOR_EMERGENCY_BOOL);
-    ParseBoolOperatorConfigs(slotId, forceVolteSwitchOn_, poc, KEY_FORCE_VOLTE_SWITCH_ON_BOOL);
-    ParseBoolOperatorConfigs(slotId, videoCallWaiting_, poc, KEY_VIDEO_CALL_WAITING_ON_BOOL);
-    ParseBoolOperatorConfigs(slotId, imsSipCauseEnable_, poc, KEY_IMS_SIP_CAUSE_CODE_ENABLE_ON_BOOL);
-
-    if (poc.intArrayValue.count(KEY_NR_MODE_SUPPORTED_LIST_INT_ARRAY) > 0) {
-        nrModeSupportedList_[slotId] = poc.intArrayValue[KEY_NR_MODE_SUPPORTED_LIST_INT_ARRAY];
+const std::vector<CellularCallConfig::BoolOperatorConfig> &CellularCallConfig::GetBoolOperatorConfigTable()
+{
+    static const std::vector<BoolOperatorConfig> boolConfigTable = {
+        { KEY_IMS_SWITCH_ON_BY_DEFAULT_BOOL, &SlotConfig::imsSwitchOnByDefault, OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY },
+        { KEY_HIDE_IMS_SWITCH_BOOL, &SlotConfig::hideImsSwitch, OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY },
+        { KEY_VOLTE_SUPPORTED_BOOL, &SlotConfig::volteSupported, OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY },
+        { KEY_VOLTE_PROVISIONING_SUPPORTED_BOOL, &SlotConfig::volteProvisioningSupported,
+            OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY },
+        { KEY_CARRIER_VT_AVAILABLE_BOOL, &SlotConfig::carrierVtAvailable, OPERATOR_CONFIG_CHANGE_CARRIER_VT },
+        { KEY_SS_OVER_UT_SUPPORTED_BOOL, &SlotConfig::ssOverUtSupported, OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY },
+        { KEY_IMS_GBA_REQUIRED_BOOL, &SlotConfig::imsGbaRequired, OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY },
+        { KEY_UT_PROVISIONING_SUPPORTED_BOOL, &SlotConfig::utProvisioningSupported,
+            OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY },
+        { KEY_IMS_PREFER_FOR_EMERGENCY_BOOL, &SlotConfig::imsPreferForEmergency, OPERATOR_CONFIG_CHANGE_CALL_POLICY },
+        { KEY_FORCE_VOLTE_SWITCH_ON_BOOL, &SlotConfig::forceVolteSwitchOn, OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY },
+        { KEY_VIDEO_CALL_WAITING_ON_BOOL, &SlotConfig::videoCallWaiting, OPERATOR_CONFIG_CHANGE_VIDEO_CALL_WAITING },
+        { KEY_IMS_SIP_CAUSE_CODE_ENABLE_ON_BOOL, &SlotConfig::imsSipCauseEnable, OPERATOR_CONFIG_CHANGE_CALL_POLICY },
+    };
+    return boolConfigTable;
+}
+
+std::shared_ptr<const OperatorConfigSnapshot> CellularCallConfig::ParseOperatorConfigs(OperatorConfig &poc)
+{
+    auto snapshot = std::make_shared<OperatorConfigSnapshot>();
+    for (const auto &item : GetBoolOperatorConfigTable()) {
+        auto it = poc.boolValue.find(item.key);
+        if (it != poc.boolValue.end()) {
+            snapshot->boolValues[item.key] = it->second;
+        } else {
+            TELEPHONY_LOGE("do't find operator config %{public}s", item.key.c_str());
+        }
     }
-    if (poc.intValue.count(KEY_CALL_WAITING_SERVICE_CLASS_INT) > 0) {
-        callWaitingServiceClass_[slotId] = poc.intValue[KEY_CALL_WAITING_SERVICE_CLASS_INT];
+    auto nrModeIt = poc.intArrayValue.find(KEY_NR_MODE_SUPPORTED_LIST_INT_ARRAY);
+    if (nrModeIt != poc.intArrayValue.end()) {
+        snapshot->hasNrModeSupportedList = true;
+        snapshot->nrModeSupportedList = nrModeIt->second;
     }
-    if (poc.stringArrayValue.count(KEY_IMS_CALL_DISCONNECT_REASONINFO_MAPPING_STRING_ARRAY) > 0) {
-        imsCallDisconnectResoninfoMapping_[slotId] =
-            poc.stringArrayValue[KEY_IMS_CALL_DISCONNECT_REASONINFO_MAPPING_STRING_ARRAY];
+    auto serviceClassIt = poc.intValue.find(KEY_CALL_WAITING_SERVICE_CLASS_INT);
+    if (serviceClassIt != poc.intValue.end()) {
+        snapshot->hasCallWaitingServiceClass = true;
+        snapshot->callWaitingServiceClass = serviceClassIt->second;
     }
-    return TELEPHONY_SUCCESS;
+    auto mappingIt = poc.stringArrayValue.find(KEY_IMS_CALL_DISCONNECT_REASONINFO_MAPPING_STRING_ARRAY);
+    if (mappingIt != poc.stringArrayValue.end()) {
+        snapshot->hasDisconnectReasonMapping = true;
+        snapshot->disconnectReasonMapping = mappingIt->second;
+        // parsed with the snapshot, so a config seen before is not parsed again
+        snapshot->disconnectReasonTable = ParseDisconnectReasonMapping(snapshot->disconnectReasonMapping);
+    }
+    return snapshot;
 }
 
-void CellularCallConfig::ParseBoolOperatorConfigs(
-    int32_t slotId, std::map<int32_t, bool> &config, OperatorConfig &poc, std::string configName)
+uint32_t CellularCallConfig::CacheOperatorConfigs(int32_t slotId, const OperatorConfigSnapshot &snapshot)
 {
-    auto it = poc.boolValue.find(configName);
-    if (it != poc.boolValue.end()) {
-        config[slotId] = it->second;
-    } else {
-        TELEPHONY_LOGE("do't find operator config %{public}s", configName.c_str());
-    }
+    uint32_t changes = OPERATOR_CONFIG_CHANGE_NONE;
+    // every operator value of the slot changes in one published snapshot
+    UpdateSlotConfig(slotId, [&snapshot, &changes](SlotConfig &config) {
+        for (const auto &item : GetBoolOperatorConfigTable()) {
+            auto it = snapshot.boolValues.find(item.key);
+            if (it != snapshot.boolValues.end() && config.*(item.value) != it->second) {
+                config.*(item.value) = it->second;
+                changes |= item.change;
+            }
+        }
+        if (snapshot.hasNrModeSupportedList && config.nrModeSupportedList != snapshot.nrModeSupportedList) {
+            config.nrModeSupportedList = snapshot.nrModeSupportedList;
+            changes |= OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY;
+        }
+        if (snapshot.hasCallWaitingServiceClass && config.callWaitingServiceClass != snapshot.callWaitingServiceClass) {
+            config.callWaitingServiceClass = snapshot.callWaitingServiceClass;
+            changes |= OPERATOR_CONFIG_CHANGE_CALL_POLICY;
+        }
+        if (snapshot.hasDisconnectReasonMapping &&
+            config.imsCallDisconnectResoninfoMapping != snapshot.disconnectReasonMapping) {
+            config.imsCallDisconnectResoninfoMapping = snapshot.disconnectReasonMapping;
+            config.disconnectReasonTable = snapshot.disconnectReasonTable != nullptr ?
+                snapshot.disconnectReasonTable : ParseDisconnectReasonMapping(snapshot.disconnectReasonMapping);
+            config.disconnectReasonTableVersion++;
+            changes |= OPERATOR_CONFIG_CHANGE_DISCONNECT_MAPPING;
+        }
+    });
+    UpdateSlotUpdateState(slotId, [&changes](SlotUpdateState &state) {
+        // the default values of the slot config were never pushed to the vendor
+        if (!state.isOperatorConfigApplied) {
+            changes = OPERATOR_CONFIG_CHANGE_ALL;
+        }
+        OperatorConfigCacheStats &stats = state.operatorConfigCacheStats;
+        stats.applies++;
+        if (changes == OPERATOR_CONFIG_CHANGE_NONE) {
+            stats.unchangedApplies++;
+        }
+        stats.lastChanges = changes;
+    });
+    return changes;
 }
 
 void CellularCallConfig::ResetImsSwitch(int32_t slotId)
@@ -587,13 +1079,14 @@ void CellularCallConfig::ResetImsSwitch(int32_t slotId)
     }
     std::u16string iccId;
     CoreManagerInner::GetInstance().GetSimIccId(slotId, iccId);
-    if (IsSimChanged(slotId, Str16ToStr8(iccId)) && forceVolteSwitchOn_[slotId]) {
+    std::shared_ptr<const SlotConfig> config = GetSlotConfig(slotId);
+    if (IsSimChanged(slotId, Str16ToStr8(iccId)) && config->forceVolteSwitchOn) {
         int32_t ret = CoreManagerInner::GetInstance().SaveImsSwitch(
-            slotId, BooleanToImsSwitchValue(imsSwitchOnByDefault_[slotId]));
+            slotId, BooleanToImsSwitchValue(config->imsSwitchOnByDefault));
         if (ret != TELEPHONY_SUCCESS) {
             TELEPHONY_LOGE("SaveImsSwitch failed");
         } else {
-            saveImsSwitchStatusToLocal(slotId, BooleanToImsSwitchValue(imsSwitchOnByDefault_[slotId]));
+            saveImsSwitchStatusToLocal(slotId, BooleanToImsSwitchValue(config->imsSwitchOnByDefault));
         }
     }
 }
@@ -616,7 +1109,7 @@ void CellularCallConfig::UpdateImsCapabilities(int32_t slotId, bool needUpdateUt
 
 bool CellularCallConfig::IsGbaValid(int32_t slotId)
 {
-    if (imsGbaRequired_[slotId]) {
+    if (GetSlotConfig(slotId)->imsGbaRequired) {
         std::u16string simist = CoreManagerInner::GetInstance().GetSimIst(slotId);
         std::string simistStr = Str16ToStr8(simist);
         // If carrier requires that IMS is only available if GBA capable SIM is used,
@@ -669,13 +1162,13 @@ void CellularCallConfig::UpdateImsUtCapabilities(int32_t slotId, ImsCapabilityLi
     ImsCapability utCapability;
     utCapability.imsCapabilityType = ImsCapabilityType::CAPABILITY_TYPE_UT;
     utCapability.imsRadioTech = ImsRegTech::IMS_REG_TECH_LTE;
-    utCapability.enable = ssOverUtSupported_[slotId] && isGbaValid && IsUtProvisioned(slotId);
+    utCapability.enable = GetSlotConfig(slotId)->ssOverUtSupported && isGbaValid && IsUtProvisioned(slotId);
     imsCapabilityList.imsCapabilities.push_back(utCapability);
 }
 
 bool CellularCallConfig::IsVolteProvisioned(int32_t slotId)
 {
-    if (volteProvisioningSupported_[slotId]) {
+    if (GetSlotConfig(slotId)->volteProvisioningSupported) {
         int32_t volteFeatureValue;
         int32_t result = configRequest_.GetImsFeatureValueRequest(FeatureType::TYPE_VOICE_OVER_LTE, volteFeatureValue);
         if (result != TELEPHONY_SUCCESS) {
@@ -689,8 +1182,9 @@ bool CellularCallConfig::IsVolteProvisioned(int32_t slotId)
 
 bool CellularCallConfig::IsVonrSupported(int32_t slotId, bool isGbaValid)
 {
-    if (std::find(nrModeSupportedList_[slotId].begin(), nrModeSupportedList_[slotId].end(),
-        CARRIER_NR_AVAILABILITY_SA) == nrModeSupportedList_[slotId].end()) {
+    std::shared_ptr<const SlotConfig> config = GetSlotConfig(slotId);
+    if (std::find(config->nrModeSupportedList.begin(), config->nrModeSupportedList.end(),
+        CARRIER_NR_AVAILABILITY_SA) == config->nrModeSupportedList.end()) {
         return false;
     }
     return isGbaValid;
@@ -710,7 +1204,7 @@ bool CellularCallConfig::IsVonrSupportedForImsSwitch(int32_t slotId, bool isGbaV
 
 bool CellularCallConfig::IsUtProvisioned(int32_t slotId)
 {
-    if (utProvisioningSupported_[slotId]) {
+    if (GetSlotConfig(slotId)->utProvisioningSupported) {
         int32_t utFeatureValue;
         int32_t result = configRequest_.GetImsFeatureValueRequest(FeatureType::TYPE_SS_OVER_UT, utFeatureValue);
         if (result != TELEPHONY_SUCCESS) {
@@ -791,37 +1285,37 @@ void CellularCallConfig::saveImsSwitchStatusToLocalForPowerOn(int32_t slotId)
     int32_t ret = CoreManagerInner::GetInstance().QueryImsSwitch(slotId, imsSwitchStatus);
     if (ret != TELEPHONY_SUCCESS || imsSwitchStatus == IMS_SWITCH_STATUS_UNKNOWN) {
         TELEPHONY_LOGI("get ims switch state failed from database, return operator config default value");
-        imsSwitchStatus = imsSwitchOnByDefault_[slotId] ? IMS_SWITCH_STATUS_ON : IMS_SWITCH_STATUS_OFF;
+        imsSwitchStatus = GetSlotConfig(slotId)->imsSwitchOnByDefault ? IMS_SWITCH_STATUS_ON : IMS_SWITCH_STATUS_OFF;
     }
 
     TELEPHONY_LOGI(
         "save slotId[%{public}d] imsSwitchStatus:%{public}d to local for Power on", slotId, imsSwitchStatus);
     std::string imsSwitchStateKey = IMSSWITCH_STATE + std::to_string(slotId);
-    std::string imsSwitchState = std::to_string(imsSwitchStatus);
-    SetParameter(imsSwitchStateKey.c_str(), imsSwitchState.c_str());
+    DelayedSingleton<CellularCallParameterCache>::GetInstance()->SetString(
+        imsSwitchStateKey, std::to_string(imsSwitchStatus));
 }
 
 void CellularCallConfig::saveImsSwitchStatusToLocal(int32_t slotId, int32_t imsSwitchStatus)
 {
     TELEPHONY_LOGI("save slotId[%{public}d] imsSwitchStatus:%{public}d to local", slotId, imsSwitchStatus);
     std::string imsSwitchStateKey = IMSSWITCH_STATE + std::to_string(slotId);
-    std::string imsSwitchState = std::to_string(imsSwitchStatus);
-    SetParameter(imsSwitchStateKey.c_str(), imsSwitchState.c_str());
+    DelayedSingleton<CellularCallParameterCache>::GetInstance()->SetString(
+        imsSwitchStateKey, std::to_string(imsSwitchStatus));
 }
 
 void CellularCallConfig::SaveVoNRState(int32_t slotId, int32_t state)
 {
     CellularCallHiSysEvent::WriteVoNRSwitchChangeEvent(state);
     TELEPHONY_LOGI("slotId: %{public}d, switchState: %{public}d", slotId, state);
-    std::string vonrState = std::to_string(state);
     std::string vonrStateKey = VONR_STATE + std::to_string(slotId);
-    SetParameter(vonrStateKey.c_str(), vonrState.c_str());
+    DelayedSingleton<CellularCallParameterCache>::GetInstance()->SetString(vonrStateKey, std::to_string(state));
 }
 
 int32_t CellularCallConfig::ObtainVoNRState(int32_t slotId)
 {
     std::string vonrStateKey = VONR_STATE + std::to_string(slotId);
-    int32_t vonrState = GetIntParameter(vonrStateKey.c_str(), VONR_SWITCH_STATUS_ON);
+    int32_t vonrState =
+        DelayedSingleton<CellularCallParameterCache>::GetInstance()->GetInt(vonrStateKey, VONR_SWITCH_STATUS_ON);
     TELEPHONY_LOGI("slotId: %{public}d, switchState: %{public}d", slotId, vonrState);
     return vonrState;
 }
@@ -844,18 +1338,16 @@ void CellularCallConfig::HandleSetLteImsSwitchResult(int32_t slotId, ErrType res
 #ifdef CELLULAR_CALL_REDCAP_ABILITY
 void CellularCallConfig::SetRadioOn(bool isRadioOn)
 {
-    std::unique_lock<std::shared_mutex> lock(mutex_);
-    isRadioOn_ = isRadioOn;
+    isRadioOn_.store(isRadioOn);
 }
 
 void CellularCallConfig::SetPreferredNetworkByConfig(int32_t slotId)
 {
-    std::unique_lock<std::shared_mutex> lock(mutex_);
+    bool isOperatorConfigChanged = isOperatorConfigChanged_.exchange(false);
+    bool isRadioOn = isRadioOn_.load();
     TELEPHONY_LOGI("SetPreferredNetworkByConfig isOperatorConfigChanged: %{public}d, isRadioOn: %{public}d",
-        isOperatorConfigChanged_, isRadioOn_);
-    bool isProcess = isOperatorConfigChanged_ || isRadioOn_;
-    isOperatorConfigChanged_ = false;
-    lock.unlock();
+        isOperatorConfigChanged, isRadioOn);
+    bool isProcess = isOperatorConfigChanged || isRadioOn;
     if (isProcess) {
         TELEPHONY_EXT_WRAPPER.SetPreferredNetworkByConfigFunc(slotId);
     }
@@ -869,9 +1361,7 @@ void CellularCallConfig::HandleSetVoNRSwitchResult(int32_t slotId, ErrType resul
         TELEPHONY_LOGE("HandleSetVoNRSwitchResult set vonr switch to modem failed!");
         return;
     }
-    std::unique_lock<ffrt::mutex> lock(operatorMutex_);
-    SaveVoNRState(slotId, vonrSwithStatus_[slotId]);
-    lock.unlock();
+    SaveVoNRState(slotId, GetSlotConfig(slotId)->vonrSwitchStatus);
     ImsCapabilityList imsCapabilityList;
     UpdateImsVoiceCapabilities(slotId, imsCapabilityList);
     configRequest_.UpdateImsCapabilities(slotId, imsCapabilityList);
@@ -879,31 +1369,31 @@ void CellularCallConfig::HandleSetVoNRSwitchResult(int32_t slotId, ErrType resul
 
 void CellularCallConfig::GetDomainPreferenceModeResponse(int32_t slotId, int32_t mode)
 {
-    std::lock_guard<ffrt::mutex> lock(modeMutex_);
     if (!IsValidSlotId(slotId)) {
         return;
     }
-    modeMap_[slotId] = mode;
+    UpdateSlotConfig(slotId, [mode](SlotConfig &config) { config.domainPreferenceMode = mode; });
 }
 
 void CellularCallConfig::GetImsSwitchStatusResponse(int32_t slotId, int32_t active) {}
 
 int32_t CellularCallConfig::GetPreferenceMode(int32_t slotId) const
 {
-    std::lock_guard<ffrt::mutex> lock(modeMutex_);
-    return modeMap_[slotId];
+    return GetSlotConfig(slotId)->domainPreferenceMode;
 }
 
 int32_t CellularCallConfig::GetSwitchStatus(int32_t slotId)
 {
     std::string imsSwitchStateKey = IMSSWITCH_STATE + std::to_string(slotId);
-    int32_t imsSwitchStatus = GetIntParameter(imsSwitchStateKey.c_str(), IMS_SWITCH_STATUS_UNKNOWN);
+    int32_t imsSwitchStatus = DelayedSingleton<CellularCallParameterCache>::GetInstance()->GetInt(
+        imsSwitchStateKey, IMS_SWITCH_STATUS_UNKNOWN);
     if (imsSwitchStatus == IMS_SWITCH_STATUS_UNKNOWN) {
         TELEPHONY_LOGI("get ims switch state failed from local, try to get it from database");
         int32_t ret = CoreManagerInner::GetInstance().QueryImsSwitch(slotId, imsSwitchStatus);
         if (ret != TELEPHONY_SUCCESS || imsSwitchStatus == IMS_SWITCH_STATUS_UNKNOWN) {
             TELEPHONY_LOGI("get ims switch state failed from database, return operator config default value");
-            imsSwitchStatus = imsSwitchOnByDefault_[slotId] ? IMS_SWITCH_STATUS_ON : IMS_SWITCH_STATUS_OFF;
+            imsSwitchStatus =
+                GetSlotConfig(slotId)->imsSwitchOnByDefault ? IMS_SWITCH_STATUS_ON : IMS_SWITCH_STATUS_OFF;
         }
     }
     TELEPHONY_LOGD("slotId[%{public}d] GetSwitchStatus imsSwitchStatus:%{public}d", slotId, imsSwitchStatus);
@@ -943,33 +1433,24 @@ int32_t CellularCallConfig::GetImsFeatureValue(FeatureType type)
 
 void CellularCallConfig::SetTempMode(int32_t slotId)
 {
-    std::lock_guard<ffrt::mutex> lock(modeMutex_);
     if (!IsValidSlotId(slotId)) {
         return;
     }
-    modeMap_[slotId] = modeTempMap_[slotId];
+    UpdateSlotConfig(slotId, [](SlotConfig &config) { config.domainPreferenceMode = config.tempDomainPreferenceMode; });
 }
 
 void CellularCallConfig::InitModeActive()
 {
     TELEPHONY_LOGI("InitModeActive");
-    int32_t slotId = DEFAULT_SIM_SLOT_ID;
-    modeMap_[slotId] = DomainPreferenceMode::IMS_PS_VOICE_PREFERRED;
-    std::unique_lock<std::shared_mutex> lock(mutex_);
-    eccListRadioMap_.clear();
-    eccList3gppHasSim_.clear();
-    eccList3gppNoSim_.clear();
-    allEccList_.clear();
-    eccList3gppHasSim_.push_back(BuildDefaultEmergencyCall("112", SimpresentType::TYPE_HAS_CARD));
-    eccList3gppHasSim_.push_back(BuildDefaultEmergencyCall("911", SimpresentType::TYPE_HAS_CARD));
-    eccList3gppNoSim_.push_back(BuildDefaultEmergencyCall("112", SimpresentType::TYPE_NO_CARD));
-    eccList3gppNoSim_.push_back(BuildDefaultEmergencyCall("911", SimpresentType::TYPE_NO_CARD));
-    eccList3gppNoSim_.push_back(BuildDefaultEmergencyCall("000", SimpresentType::TYPE_NO_CARD));
-    eccList3gppNoSim_.push_back(BuildDefaultEmergencyCall("08", SimpresentType::TYPE_NO_CARD));
-    eccList3gppNoSim_.push_back(BuildDefaultEmergencyCall("110", SimpresentType::TYPE_NO_CARD));
-    eccList3gppNoSim_.push_back(BuildDefaultEmergencyCall("118", SimpresentType::TYPE_NO_CARD));
-    eccList3gppNoSim_.push_back(BuildDefaultEmergencyCall("119", SimpresentType::TYPE_NO_CARD));
-    eccList3gppNoSim_.push_back(BuildDefaultEmergencyCall("999", SimpresentType::TYPE_NO_CARD));
+    UpdateSlotConfig(DEFAULT_SIM_SLOT_ID,
+        [](SlotConfig &config) { config.domainPreferenceMode = DomainPreferenceMode::IMS_PS_VOICE_PREFERRED; });
+    // publish the default numbers at once instead of an empty list until the first radio report
+    for (int32_t slotId = DEFAULT_SIM_SLOT_ID; slotId < SIM_SLOT_COUNT; slotId++) {
+        UpdateSlotUpdateState(slotId, [](SlotUpdateState &state) { state.radioEccList = nullptr; });
+        UpdateSlotConfig(slotId, [](SlotConfig &config) { config.eccList = nullptr; });
+        eccMergers_[slotId].Clear();
+        MergeEccCallList(slotId, false);
+    }
 }
 
 EmergencyCall CellularCallConfig::BuildDefaultEmergencyCall(const std::string &number, SimpresentType simType)
@@ -991,6 +1472,25 @@ EmergencyCall CellularCallConfig::BuildDefaultEmergencyCall(const std::string &n
     return emergencyCall;
 }
 
+const std::vector<EmergencyCall> &CellularCallConfig::GetDefaultEccList(bool hasSim)
+{
+    static const std::vector<EmergencyCall> eccList3gppHasSim = [this]() {
+        std::vector<EmergencyCall> eccList;
+        for (const std::string &number : { "112", "911" }) {
+            eccList.push_back(BuildDefaultEmergencyCall(number, SimpresentType::TYPE_HAS_CARD));
+        }
+        return eccList;
+    }();
+    static const std::vector<EmergencyCall> eccList3gppNoSim = [this]() {
+        std::vector<EmergencyCall> eccList;
+        for (const std::string &number : { "112", "911", "000", "08", "110", "118", "119", "999" }) {
+            eccList.push_back(BuildDefaultEmergencyCall(number, SimpresentType::TYPE_NO_CARD));
+        }
+        return eccList;
+    }();
+    return hasSim ? eccList3gppHasSim : eccList3gppNoSim;
+}
+
 bool CellularCallConfig::GetRoamingState(int32_t slotId)
 {
     sptr<NetworkState> networkState = nullptr;
@@ -1004,54 +1504,73 @@ bool CellularCallConfig::GetRoamingState(int32_t slotId)
     return isRoaming;
 }
 
-void CellularCallConfig::MergeEccCallList(int32_t slotId)
+void CellularCallConfig::MergeEccCallList(int32_t slotId, bool isFakeListQueried)
 {
-    std::map<int32_t, std::vector<EmergencyCall>> tempEccList;
+    std::vector<EmergencyCall> radioEccList;
     std::string mcc = GetMcc(slotId);
-    for (auto ecc : eccListRadioMap_[slotId]) {
-        ecc.mcc = mcc;
-        tempEccList[slotId].push_back(ecc);
-    }
-    TELEPHONY_LOGD("MergeEccCallList merge radio slotId  %{public}d size  %{public}d", slotId,
-        static_cast<int32_t>(eccListRadioMap_[slotId].size()));
     SimState simState = SimState::SIM_STATE_UNKNOWN;
     CoreManagerInner::GetInstance().GetSimState(slotId, simState);
     bool hasSim = simState == SimState::SIM_STATE_READY || simState == SimState::SIM_STATE_LOADED;
-    if (hasSim) {
-        if (!mcc.empty()) {
-            for (auto ecc : eccList3gppHasSim_) {
-                ecc.mcc = mcc;
-                tempEccList[slotId].push_back(ecc);
-            }
-        }
-    } else {
-        for (auto ecc : eccList3gppNoSim_) {
-            ecc.mcc = mcc;
-            tempEccList[slotId].push_back(ecc);
-        }
+    std::shared_ptr<const std::vector<EmergencyCall>> radioEccListSnapshot = GetSlotUpdateState(slotId)->radioEccList;
+    if (radioEccListSnapshot != nullptr) {
+        radioEccList = *radioEccListSnapshot;
+    }
+    std::vector<EmergencyCall> defaultEccList;
+    if (!hasSim || !mcc.empty()) {
+        defaultEccList = GetDefaultEccList(hasSim);
+    }
+    for (auto &ecc : radioEccList) {
+        ecc.mcc = mcc;
+    }
+    for (auto &ecc : defaultEccList) {
+        ecc.mcc = mcc;
+    }
+    TELEPHONY_LOGD("MergeEccCallList merge radio slotId  %{public}d size  %{public}d", slotId,
+        static_cast<int32_t>(radioEccList.size()));
+    CellularCallEccMerger &merger = eccMergers_[slotId];
+    bool isChanged = merger.SetSource(EccMergeSource::RADIO, radioEccList);
+    isChanged = merger.SetSource(EccMergeSource::DEFAULT, defaultEccList) || isChanged;
+    if (isFakeListQueried) {
+        std::vector<EmergencyCall> fakeEccList;
+        GetHplmnFakeEccList(slotId, hasSim, mcc, fakeEccList);
+        isChanged = merger.SetSource(EccMergeSource::FAKE, fakeEccList) || isChanged;
+    }
+    if (!isChanged && GetSlotConfig(slotId)->eccList != nullptr) {
+        TELEPHONY_LOGD("MergeEccCallList slotId %{public}d not changed", slotId);
+        return;
     }
+    // read inside the serialized update, so a merge finishing late never publishes an older list
+    UpdateSlotConfig(slotId, [&merger](SlotConfig &config) { config.eccList = merger.GetMergedList(); });
+}
+
+void CellularCallConfig::GetHplmnFakeEccList(
+    int32_t slotId, bool hasSim, const std::string &mcc, std::vector<EmergencyCall> &fakeEccList)
+{
     std::u16string u16Hplmn = u"";
     CoreManagerInner::GetInstance().GetSimOperatorNumeric(slotId, u16Hplmn);
     std::string hplmn = Str16ToStr8(u16Hplmn);
-    if (hasSim && !GetRoamingState(slotId) && !hplmn.empty()) {
-        std::unique_lock<ffrt::mutex> lock(plmnMutex_);
-        auto fakeEccListPlmn = hplmnFakeEccList_[slotId].plmn;
-        lock.unlock();
-        if (fakeEccListPlmn == hplmn) {
-            UpdateEccListByFakeEccList(slotId, tempEccList[slotId]);
-        } else {
-            std::vector<EccNum> eccVec;
-            DelayedSingleton<CellularCallRdbHelper>::GetInstance()->QueryEccList(hplmn, eccVec);
-            if (eccVec.empty()) {
-                UniqueEccCallList(slotId, tempEccList[slotId]);
-                return;
-            }
-            std::string ecc = eccVec[0].ecc_fake;
-            std::vector<std::string> callList = StandardizeUtils::Split(ecc, ",");
-            UpdateHplmnFakeEccList(callList, hplmn, slotId, tempEccList[slotId], mcc);
-        }
+    if (!hasSim || GetRoamingState(slotId) || hplmn.empty()) {
+        return;
+    }
+    std::shared_ptr<const PlmnEccList> hplmnFakeEccList = GetSlotUpdateState(slotId)->hplmnFakeEccList;
+    if (hplmnFakeEccList != nullptr && hplmnFakeEccList->plmn == hplmn) {
+        UpdateEccListByFakeEccList(slotId, fakeEccList);
+        return;
+    }
+    std::vector<EccNum> eccVec;
+    QueryEccList(slotId, hplmn, eccVec);
+    if (!eccVec.empty()) {
+        std::vector<std::string> callList = StandardizeUtils::Split(eccVec[0].ecc_fake, ",");
+        UpdateHplmnFakeEccList(callList, hplmn, slotId, fakeEccList, mcc);
+    }
+}
+
+void CellularCallConfig::GetEccMergeStats(int32_t slotId, EccMergeStats &stats)
+{
+    if (!IsValidSlotId(slotId)) {
+        return;
     }
-    UniqueEccCallList(slotId, tempEccList[slotId]);
+    eccMergers_[slotId].GetStats(stats);
 }
 
 void CellularCallConfig::UpdateHplmnFakeEccList(const std::vector<std::string> &callList, const std::string &hplmn,
@@ -1060,24 +1579,36 @@ void CellularCallConfig::UpdateHplmnFakeEccList(const std::vector<std::string> &
     if (callList.empty()) {
         return;
     }
-    std::unique_lock<ffrt::mutex> lock(plmnMutex_);
-    hplmnFakeEccList_[slotId].plmn = hplmn;
+    std::vector<EmergencyCall> calls;
     for (auto it : callList) {
         EmergencyCall call = BuildDefaultEmergencyCall(it, SimpresentType::TYPE_HAS_CARD);
         call.mcc = mcc;
         eccList.push_back(call);
-        auto ecc = std::find(hplmnFakeEccList_[slotId].eccInfoList.begin(), hplmnFakeEccList_[slotId].eccInfoList.end(),
-            call);
-        if (ecc == hplmnFakeEccList_[slotId].eccInfoList.end()) {
-            hplmnFakeEccList_[slotId].eccInfoList.push_back(call);
-        }
+        calls.push_back(call);
     }
+    UpdateSlotUpdateState(slotId, [&hplmn, &calls](SlotUpdateState &state) {
+        auto fakeEccList = std::make_shared<PlmnEccList>();
+        if (state.hplmnFakeEccList != nullptr) {
+            *fakeEccList = *state.hplmnFakeEccList;
+        }
+        fakeEccList->plmn = hplmn;
+        for (const auto &call : calls) {
+            auto ecc = std::find(fakeEccList->eccInfoList.begin(), fakeEccList->eccInfoList.end(), call);
+            if (ecc == fakeEccList->eccInfoList.end()) {
+                fakeEccList->eccInfoList.push_back(call);
+            }
+        }
+        state.hplmnFakeEccList = fakeEccList;
+    });
 }
  
 void CellularCallConfig::UpdateEccListByFakeEccList(int32_t slotId, std::vector<EmergencyCall> &eccList)
 {
-    std::unique_lock<ffrt::mutex> lock(plmnMutex_);
-    for (auto eccInfo : hplmnFakeEccList_[slotId].eccInfoList) {
+    std::shared_ptr<const PlmnEccList> hplmnFakeEccList = GetSlotUpdateState(slotId)->hplmnFakeEccList;
+    if (hplmnFakeEccList == nullptr) {
+        return;
+    }
+    for (auto eccInfo : hplmnFakeEccList->eccInfoList) {
         auto it = std::find(eccList.begin(), eccList.end(), eccInfo);
         if (it == eccList.end()) {
             eccList.push_back(eccInfo);
@@ -1085,21 +1616,6 @@ void CellularCallConfig::UpdateEccListByFakeEccList(int32_t slotId, std::vector<
     }
 }
 
-void CellularCallConfig::UniqueEccCallList(int32_t slotId, std::vector<EmergencyCall> &eccList)
-{
-    allEccList_[slotId].clear();
-    for (auto call : eccList) {
-        if (std::find(allEccList_[slotId].begin(), allEccList_[slotId].end(), call) ==
-            allEccList_[slotId].end()) {
-            allEccList_[slotId].push_back(call);
-        }
-    }
-    for (auto call : allEccList_[slotId]) {
-        TELEPHONY_LOGD("UniqueEccCallList end slotId %{public}d eccNum:%{public}s, mcc:%{public}s", slotId,
-            call.eccNum.c_str(), call.mcc.c_str());
-    }
-}
-
 std::string CellularCallConfig::GetMcc(int32_t slotId)
 {
     std::u16string operatorNumeric;
@@ -1158,9 +1674,11 @@ bool CellularCallConfig::CheckAndUpdateSimState(int32_t slotId)
             break;
         }
     }
-    std::unique_lock<std::shared_mutex> lock(simStateLock_);
-    bool result = (simState_[slotId] != simStateForEcc);
-    simState_[slotId] = simStateForEcc;
+    bool result = false;
+    UpdateSlotConfig(slotId, [simStateForEcc, &result](SlotConfig &config) {
+        result = config.simState != simStateForEcc;
+        config.simState = simStateForEcc;
+    });
     return result;
 }
 
@@ -1170,25 +1688,41 @@ void CellularCallConfig::UpdateEmergencyCallFromRadio(int32_t slotId, const Emer
         return;
     }
     TELEPHONY_LOGD("UpdateEmergencyCallFromRadio %{public}d size %{public}d", slotId, eccList.callSize);
-    std::unique_lock<std::shared_mutex> lock(mutex_);
-    eccListRadioMap_[slotId].clear();
+    std::vector<EmergencyCall> radioEccList;
     for (auto ecc : eccList.calls) {
         TELEPHONY_LOGD("UpdateEmergencyCallFromRadio , data: eccNum %{public}s mcc %{public}s", ecc.eccNum.c_str(),
             ecc.mcc.c_str());
-        eccListRadioMap_[slotId].push_back(BuildEmergencyCall(slotId, ecc));
+        radioEccList.push_back(BuildEmergencyCall(slotId, ecc));
     }
-    MergeEccCallList(slotId);
+    std::shared_ptr<const std::vector<EmergencyCall>> published =
+        std::make_shared<const std::vector<EmergencyCall>>(std::move(radioEccList));
+    UpdateSlotUpdateState(slotId, [&published](SlotUpdateState &state) { state.radioEccList = published; });
+    // the radio and default numbers are published before returning. The fake numbers of the home network
+    // need the ecc database, the slot task queries them and publishes again when they changed
+    MergeEccCallList(slotId, false);
+    SubmitSlotTask(slotId, [slotId]() {
+        CellularCallConfig config;
+        config.MergeEccCallList(slotId, true);
+    });
+}
+
+std::shared_ptr<const std::vector<EmergencyCall>> CellularCallConfig::GetEccCallListSnapshot(int32_t slotId)
+{
+    return GetSlotConfig(slotId)->eccList;
 }
 
 std::vector<EmergencyCall> CellularCallConfig::GetEccCallList(int32_t slotId)
 {
     TELEPHONY_LOGD("GetEccCallList  start %{public}d", slotId);
-    std::shared_lock<std::shared_mutex> lock(mutex_);
-    TELEPHONY_LOGD("GetEccCallList size %{public}zu", allEccList_[slotId].size());
-    for (auto ecc : allEccList_[slotId]) {
+    std::shared_ptr<const std::vector<EmergencyCall>> eccList = GetEccCallListSnapshot(slotId);
+    if (eccList == nullptr) {
+        return std::vector<EmergencyCall>();
+    }
+    TELEPHONY_LOGD("GetEccCallList size %{public}zu", eccList->size());
+    for (auto ecc : *eccList) {
         TELEPHONY_LOGD("GetEccCallList, data: eccNum %{public}s mcc %{public}s", ecc.eccNum.c_str(), ecc.mcc.c_str());
     }
-    return allEccList_[slotId];
+    return *eccList;
 }
 
 int32_t CellularCallConfig::BooleanToImsSwitchValue(bool value)
@@ -1201,7 +1735,7 @@ bool CellularCallConfig::GetImsSwitchOnByDefaultConfig(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return true;
     }
-    return imsSwitchOnByDefault_[slotId];
+    return GetSlotConfig(slotId)->imsSwitchOnByDefault;
 }
 
 bool CellularCallConfig::GethideImsSwitchConfig(int32_t slotId)
@@ -1209,7 +1743,7 @@ bool CellularCallConfig::GethideImsSwitchConfig(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return false;
     }
-    return hideImsSwitch_[slotId];
+    return GetSlotConfig(slotId)->hideImsSwitch;
 }
 
 bool CellularCallConfig::GetvolteSupportedConfig(int32_t slotId)
@@ -1217,7 +1751,7 @@ bool CellularCallConfig::GetvolteSupportedConfig(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return false;
     }
-    return volteSupported_[slotId];
+    return GetSlotConfig(slotId)->volteSupported;
 }
 
 std::vector<int32_t> CellularCallConfig::GetNrModeSupportedListConfig(int32_t slotId)
@@ -1225,7 +1759,7 @@ std::vector<int32_t> CellularCallConfig::GetNrModeSupportedListConfig(int32_t sl
     if (!IsValidSlotId(slotId)) {
         return std::vector<int32_t> { CARRIER_NR_AVAILABILITY_NSA, CARRIER_NR_AVAILABILITY_SA };
     }
-    return nrModeSupportedList_[slotId];
+    return GetSlotConfig(slotId)->nrModeSupportedList;
 }
 
 bool CellularCallConfig::GetVolteProvisioningSupportedConfig(int32_t slotId)
@@ -1233,7 +1767,7 @@ bool CellularCallConfig::GetVolteProvisioningSupportedConfig(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return false;
     }
-    return volteProvisioningSupported_[slotId];
+    return GetSlotConfig(slotId)->volteProvisioningSupported;
 }
 
 bool CellularCallConfig::GetSsOverUtSupportedConfig(int32_t slotId)
@@ -1241,7 +1775,7 @@ bool CellularCallConfig::GetSsOverUtSupportedConfig(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return false;
     }
-    return ssOverUtSupported_[slotId];
+    return GetSlotConfig(slotId)->ssOverUtSupported;
 }
 
 bool CellularCallConfig::GetImsGbaRequiredConfig(int32_t slotId)
@@ -1249,7 +1783,7 @@ bool CellularCallConfig::GetImsGbaRequiredConfig(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return false;
     }
-    return imsGbaRequired_[slotId];
+    return GetSlotConfig(slotId)->imsGbaRequired;
 }
 
 bool CellularCallConfig::GetUtProvisioningSupportedConfig(int32_t slotId)
@@ -1257,7 +1791,7 @@ bool CellularCallConfig::GetUtProvisioningSupportedConfig(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return false;
     }
-    return utProvisioningSupported_[slotId];
+    return GetSlotConfig(slotId)->utProvisioningSupported;
 }
 
 bool CellularCallConfig::GetImsPreferForEmergencyConfig(int32_t slotId)
@@ -1265,7 +1799,7 @@ bool CellularCallConfig::GetImsPreferForEmergencyConfig(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return true;
     }
-    return imsPreferForEmergency_[slotId];
+    return GetSlotConfig(slotId)->imsPreferForEmergency;
 }
 
 std::int32_t CellularCallConfig::GetCallWaitingServiceClassConfig(int32_t slotId)
@@ -1273,16 +1807,61 @@ std::int32_t CellularCallConfig::GetCallWaitingServiceClassConfig(int32_t slotId
     if (!IsValidSlotId(slotId)) {
         return 1;
     }
-    return callWaitingServiceClass_[slotId];
+    return GetSlotConfig(slotId)->callWaitingServiceClass;
 }
 
 std::vector<std::string> CellularCallConfig::GetImsCallDisconnectResoninfoMappingConfig(int32_t slotId)
 {
-    std::lock_guard<ffrt::mutex> lock(operatorMutex_);
     if (!IsValidSlotId(slotId)) {
         return std::vector<std::string> {};
     }
-    return imsCallDisconnectResoninfoMapping_[slotId];
+    return GetSlotConfig(slotId)->imsCallDisconnectResoninfoMapping;
+}
+
+bool CellularCallConfig::GetDisconnectReasonMapping(int32_t slotId, int32_t reason, DisconnectReasonMapping &mapping)
+{
+    std::shared_ptr<const DisconnectReasonTable> table = GetSlotConfig(slotId)->disconnectReasonTable;
+    if (table == nullptr) {
+        return false;
+    }
+    auto it = table->find(reason);
+    if (it == table->end()) {
+        return false;
+    }
+    mapping = it->second;
+    return true;
+}
+
+std::shared_ptr<const DisconnectReasonTable> CellularCallConfig::ParseDisconnectReasonMapping(
+    const std::vector<std::string> &mapping)
+{
+    auto table = std::make_shared<DisconnectReasonTable>();
+    for (const auto &reasonInfo : mapping) {
+        std::vector<std::string> fields;
+        for (auto &field : StandardizeUtils::Split(reasonInfo, "|")) {
+            if (!field.empty()) {
+                fields.push_back(std::move(field));
+            }
+        }
+        if (fields.size() < DISCONNECT_REASON_MAPPING_MIN_FIELDS) {
+            continue;
+        }
+        int32_t reason = std::atoi(fields[0].c_str());
+        if (table->find(reason) != table->end()) {
+            continue;
+        }
+        DisconnectReasonMapping item;
+        item.message = fields[1];
+        for (size_t i = DISCONNECT_REASON_MAPPING_MIN_FIELDS; i < fields.size(); i++) {
+            item.hasReason = true;
+            item.reason = std::atoi(fields[i].c_str());
+            if (item.reason != reason) {
+                break;
+            }
+        }
+        table->emplace(reason, std::move(item));
+    }
+    return table;
 }
 
 bool CellularCallConfig::GetForceVolteSwitchOnConfig(int32_t slotId)
@@ -1290,7 +1869,7 @@ bool CellularCallConfig::GetForceVolteSwitchOnConfig(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return false;
     }
-    return forceVolteSwitchOn_[slotId];
+    return GetSlotConfig(slotId)->forceVolteSwitchOn;
 }
 
 bool CellularCallConfig::IsValidSlotId(int32_t slotId)
@@ -1309,7 +1888,7 @@ void CellularCallConfig::SetReadyToCall(int32_t slotId, bool isReadyToCall)
     if (!IsValidSlotId(slotId)) {
         return;
     }
-    readyToCall_[slotId] = isReadyToCall;
+    UpdateSlotConfig(slotId, [isReadyToCall](SlotConfig &config) { config.readyToCall = isReadyToCall; });
 }
 
 bool CellularCallConfig::IsReadyToCall(int32_t slotId)
@@ -1317,19 +1896,13 @@ bool CellularCallConfig::IsReadyToCall(int32_t slotId)
     if (!IsValidSlotId(slotId)) {
         return false;
     }
-    return readyToCall_[slotId];
+    return GetSlotConfig(slotId)->readyToCall;
 }
 
 int32_t CellularCallConfig::GetVideoCallWaiting(int32_t slotId, bool &enabled)
 {
     TELEPHONY_LOGE("entry, slotId: %{public}d", slotId);
-    auto it = videoCallWaiting_.find(slotId);
-    if (it != videoCallWaiting_.end()) {
-        enabled = it->second;
-    } else {
-        TELEPHONY_LOGI("videoCallWaiting_ not find slotId:%{public}d", slotId);
-        enabled = false;
-    }
+    enabled = GetSlotConfig(slotId)->videoCallWaiting;
     return TELEPHONY_SUCCESS;
 }
 
@@ -1347,28 +1920,30 @@ bool CellularCallConfig::IsVolteSupport(int32_t slotId)
     GetImsSwitchStatus(slotId, imsSwitch);
     bool isGbaValid = IsGbaValid(slotId);
     bool isVolteProvisioned = IsVolteProvisioned(slotId);
+    bool isVolteSupported = GetSlotConfig(slotId)->volteSupported;
     TELEPHONY_LOGI("Slot[%{public}d] voltesupport[%{public}d], isGbaValid[%{public}d], imsSwitch[%{public}d], "
-        "isVolteProvisioned[%{public}d]", slotId, volteSupported_[slotId], isGbaValid, imsSwitch, isVolteProvisioned);
-    return volteSupported_[slotId] && isGbaValid && imsSwitch && isVolteProvisioned;
+        "isVolteProvisioned[%{public}d]", slotId, isVolteSupported, isGbaValid, imsSwitch, isVolteProvisioned);
+    return isVolteSupported && isGbaValid && imsSwitch && isVolteProvisioned;
 }
 
 void CellularCallConfig::HandleEccListChange()
 {
+    DelayedSingleton<CellularCallEccCache>::GetInstance()->Clear();
+    eccPlmnLru_.Invalidate();
     for (int i = 0; i < SIM_SLOT_COUNT; ++i) {
         ClearCachedEcclist(i);
-        UpdateEccNumberList(i);
+        UpdateEccNumberListAsync(i);
     }
 }
 
 void CellularCallConfig::ClearCachedEcclist(int32_t slotId)
 {
-    std::unique_lock<ffrt::mutex> lock(plmnMutex_);
-    hplmnEccList_[slotId].plmn = "";
-    hplmnEccList_[slotId].eccInfoList.clear();
-    currentPlmnEccList_[slotId].plmn = "";
-    currentPlmnEccList_[slotId].eccInfoList.clear();
-    hplmnFakeEccList_[slotId].plmn = "";
-    hplmnFakeEccList_[slotId].eccInfoList.clear();
+    UpdateSlotUpdateState(slotId, [](SlotUpdateState &state) {
+        state.hplmnEccList = nullptr;
+        state.currentPlmnEccList = nullptr;
+        state.hplmnFakeEccList = nullptr;
+        state.eccInputFingerprint = 0;
+    });
     TELEPHONY_LOGI("Cached Ecclist is cleared.");
 }
 
@@ -1384,7 +1959,7 @@ void CellularCallConfig::SetClearCode(int32_t slotId, int32_t cause)
     if (!IsValidSlotId(slotId) || cause <= 0) {
         return;
     }
-    if (cause >= IMS_CAUSE_BASE && !imsSipCauseEnable_[slotId]) {
+    if (cause >= IMS_CAUSE_BASE && !GetSlotConfig(slotId)->imsSipCauseEnable) {
         return;
     }
     int32_t code = cause;
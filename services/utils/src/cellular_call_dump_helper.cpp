@@ -15,8 +15,13 @@
 
 #include "cellular_call_dump_helper.h"
 
+#include "cellular_call_ecc_cache.h"
+#include "cellular_call_ipc_metrics.h"
+#include "cellular_call_parameter_cache.h"
+#include "cellular_call_rdb_helper.h"
 #include "cellular_call_service.h"
 #include "core_manager_inner.h"
+#include "ims_call_client.h"
 #include "module_service_utils.h"
 #include "standardize_utils.h"
 
@@ -51,18 +56,37 @@ void CellularCallDumpHelper::ShowCellularCallInfo(std::string &result) const
     result.append("CellularCallBindTime      : ")
         .append(DelayedSingleton<CellularCallService>::GetInstance()->GetBindTime())
         .append("\n");
+    result.append("CellularCallPublishTime   : ")
+        .append(DelayedSingleton<CellularCallService>::GetInstance()->GetPublishTime())
+        .append("\n");
+    result.append("CoreServiceReadyTime      : ")
+        .append(DelayedSingleton<CellularCallService>::GetInstance()->GetCoreServiceReadyTime())
+        .append("\n");
     result.append("CellularCallEndTime       : ")
         .append(DelayedSingleton<CellularCallService>::GetInstance()->GetEndTime())
         .append("\n");
     result.append("CellularCallSpendTime     : ")
         .append(DelayedSingleton<CellularCallService>::GetInstance()->GetSpendTime())
         .append("\n");
+    ShowStartupPhaseInfo(result);
     result.append("ServiceRunningState       : ")
         .append(std::to_string(DelayedSingleton<CellularCallService>::GetInstance()->GetServiceRunningState()))
         .append("\n");
     result.append("SrvccState                : ")
         .append(std::to_string(DelayedSingleton<CellularCallService>::GetInstance()->GetSrvccState()))
         .append("\n");
+    ShowImsConnectionInfo(result);
+    ShowIpcMetrics(result);
+    ShowEventLaneInfo(result);
+    ShowQueueWatchdogInfo(result);
+    ShowTelemetryQueueInfo(result);
+    ShowTimerWheelInfo(result);
+    ShowBroadcastDebounceInfo(result);
+    ShowEccAssemblyInfo(result);
+    ShowOperatorConfigInfo(result);
+    ShowEccCacheInfo(result);
+    ShowParameterCacheInfo(result);
+    ShowDataShareInfo(result);
 
     for (int32_t i = 0; i < SIM_SLOT_COUNT; i++) {
         if (WhetherHasSimCard(i)) {
@@ -84,5 +108,451 @@ void CellularCallDumpHelper::ShowCellularCallInfo(std::string &result) const
         }
     }
 }
+
+void CellularCallDumpHelper::ShowStartupPhaseInfo(std::string &result) const
+{
+    std::vector<StartupPhaseInfo> phases;
+    DelayedSingleton<CellularCallService>::GetInstance()->GetStartupPhases(phases);
+    for (const auto &phase : phases) {
+        result.append("StartupPhase              : ")
+            .append(phase.stage)
+            .append(".")
+            .append(phase.name)
+            .append(" start ")
+            .append(std::to_string(phase.startMs))
+            .append(" cost ")
+            .append(std::to_string(phase.costMs))
+            .append(phase.isDone ? "" : " not done")
+            .append("\n");
+    }
+}
+
+void CellularCallDumpHelper::ShowImsConnectionInfo(std::string &result) const
+{
+    auto imsCallClient = DelayedSingleton<ImsCallClient>::GetInstance();
+    if (imsCallClient == nullptr) {
+        return;
+    }
+    ImsConnectionStats stats;
+    imsCallClient->GetConnectionStats(stats);
+    result.append("ImsConnectState           : ")
+        .append(std::to_string(static_cast<int32_t>(stats.state)))
+        .append("\n");
+    result.append("ImsConnectAttempts        : ")
+        .append(std::to_string(stats.connectAttempts))
+        .append("\n");
+    result.append("ImsConnectFailures        : ")
+        .append(std::to_string(stats.connectFailures))
+        .append("\n");
+    result.append("ImsRemoteDiedCount        : ")
+        .append(std::to_string(stats.remoteDiedCount))
+        .append("\n");
+    result.append("ImsReconnectCount         : ")
+        .append(std::to_string(stats.reconnectCount))
+        .append("\n");
+    result.append("ImsLastReconnectCostMs    : ")
+        .append(std::to_string(stats.lastReconnectCostMs))
+        .append("\n");
+    result.append("ImsMaxReconnectCostMs     : ")
+        .append(std::to_string(stats.maxReconnectCostMs))
+        .append("\n");
+    result.append("ImsNextRetryDelayMs       : ")
+        .append(std::to_string(stats.nextRetryDelayMs))
+        .append("\n");
+    result.append("ImsEventChannelEnabled    : ")
+        .append(std::to_string(stats.eventChannelEnabled))
+        .append("\n");
+    result.append("ImsChannelEventCount      : ")
+        .append(std::to_string(stats.channelEventCount))
+        .append("\n");
+    result.append("ImsChannelDroppedCount    : ")
+        .append(std::to_string(stats.channelDroppedCount))
+        .append("\n");
+    ImsCapabilityPushStats capabilityStats;
+    imsCallClient->GetImsCapabilityPushStats(capabilityStats);
+    result.append("ImsCapabilityUpdates      : requests ")
+        .append(std::to_string(capabilityStats.requests))
+        .append(" pushes ")
+        .append(std::to_string(capabilityStats.pushes))
+        .append(" suppressed ")
+        .append(std::to_string(capabilityStats.suppressed))
+        .append(" capabilities pushed ")
+        .append(std::to_string(capabilityStats.pushedCapabilities))
+        .append(" suppressed ")
+        .append(std::to_string(capabilityStats.suppressedCapabilities))
+        .append("\n");
+}
+
+void CellularCallDumpHelper::ShowIpcMetrics(std::string &result) const
+{
+    static const char *directionNames[] = { "CallManagerInbound", "ImsOutbound", "ImsCallbackInbound" };
+    std::vector<IpcCodeStats> stats;
+    for (int32_t direction = 0; direction < static_cast<int32_t>(IpcDirection::DIRECTION_BUTT); direction++) {
+        CellularCallIpcMetrics &metrics = DelayedRefSingleton<CellularCallIpcMetrics>::GetInstance();
+        metrics.GetStats(static_cast<IpcDirection>(direction), stats);
+        result.append("IpcMetrics                : ")
+            .append(directionNames[direction])
+            .append(", overflow ")
+            .append(std::to_string(metrics.GetOverflowCount(static_cast<IpcDirection>(direction))))
+            .append("\n");
+        for (const auto &item : stats) {
+            result.append("    code ")
+                .append(std::to_string(item.code))
+                .append(" count ")
+                .append(std::to_string(item.count))
+                .append(" errors ")
+                .append(std::to_string(item.errors))
+                .append(" bytes ")
+                .append(std::to_string(item.bytes))
+                .append(" avgUs ")
+                .append(std::to_string(item.count == 0 ? 0 : item.totalCostUs / item.count))
+                .append(" maxUs ")
+                .append(std::to_string(item.maxCostUs))
+                .append(" latency");
+            for (int32_t i = 0; i < IPC_LATENCY_BUCKET_NUM; i++) {
+                result.append(i == 0 ? " " : "/").append(std::to_string(item.latency[i]));
+            }
+            result.append("\n");
+        }
+    }
+}
+
+void CellularCallDumpHelper::ShowEventLaneInfo(std::string &result) const
+{
+    static const char *laneNames[] = { "Immediate", "High", "Normal", "Idle" };
+    auto service = DelayedSingleton<CellularCallService>::GetInstance();
+    for (int32_t slotId = 0; slotId < SIM_SLOT_COUNT; slotId++) {
+        auto handler = service->GetHandler(slotId);
+        if (handler == nullptr) {
+            continue;
+        }
+        for (int32_t lane = 0; lane < EVENT_LANE_NUM; lane++) {
+            EventLaneWaitStats stats;
+            handler->GetLaneWaitStats(static_cast<CellularCallEventLane>(lane), stats);
+            result.append("EventLaneWait             : slot")
+                .append(std::to_string(slotId))
+                .append(" ")
+                .append(laneNames[lane])
+                .append(" count ")
+                .append(std::to_string(stats.count))
+                .append(" maxMs ")
+                .append(std::to_string(stats.maxWaitMs))
+                .append(" wait");
+            for (int32_t i = 0; i < EVENT_WAIT_BUCKET_NUM; i++) {
+                result.append(i == 0 ? " " : "/").append(std::to_string(stats.histogram[i]));
+            }
+            result.append("\n");
+        }
+    }
+}
+
+void CellularCallDumpHelper::ShowQueueWatchdogInfo(std::string &result) const
+{
+    static constexpr size_t topEventNum = 5;
+    auto service = DelayedSingleton<CellularCallService>::GetInstance();
+    for (int32_t slotId = 0; slotId < SIM_SLOT_COUNT; slotId++) {
+        auto handler = service->GetHandler(slotId);
+        if (handler == nullptr) {
+            continue;
+        }
+        CellularCallQueueWatchdog &watchdog = handler->GetQueueWatchdog();
+        QueueWatchdogState state;
+        watchdog.GetState(state);
+        result.append("QueueWatchdog             : slot")
+            .append(std::to_string(slotId))
+            .append(" backpressure ")
+            .append(std::to_string(state.backpressure))
+            .append(" entered ")
+            .append(std::to_string(state.backpressureCount))
+            .append(" shed ")
+            .append(std::to_string(state.shedCount))
+            .append(" slowRun ")
+            .append(std::to_string(state.slowRunCount))
+            .append(" reported ")
+            .append(std::to_string(state.reportCount))
+            .append("\n");
+        std::vector<QueueWatchdogEventStats> stats;
+        watchdog.GetEventStats(stats);
+        for (size_t i = 0; i < stats.size() && i < topEventNum; i++) {
+            result.append("QueueWatchdogEvent        : slot")
+                .append(std::to_string(slotId))
+                .append(" event ")
+                .append(std::to_string(stats[i].eventId))
+                .append(" count ")
+                .append(std::to_string(stats[i].count))
+                .append(" maxWaitMs ")
+                .append(std::to_string(stats[i].maxWaitMs))
+                .append(" maxRunMs ")
+                .append(std::to_string(stats[i].maxRunMs))
+                .append(" slowRun ")
+                .append(std::to_string(stats[i].slowRunCount))
+                .append("\n");
+        }
+    }
+}
+
+void CellularCallDumpHelper::ShowTelemetryQueueInfo(std::string &result) const
+{
+    auto service = DelayedSingleton<CellularCallService>::GetInstance();
+    for (int32_t slotId = 0; slotId < SIM_SLOT_COUNT; slotId++) {
+        auto handler = service->GetHandler(slotId);
+        if (handler == nullptr) {
+            continue;
+        }
+        std::vector<TelemetryQueueStats> stats;
+        handler->GetTelemetryQueueStats(stats);
+        for (const auto &item : stats) {
+            result.append("TelemetryQueue            : slot")
+                .append(std::to_string(slotId))
+                .append(" event ")
+                .append(std::to_string(item.eventId))
+                .append(" limit ")
+                .append(std::to_string(item.limit))
+                .append(" pending ")
+                .append(std::to_string(item.pending))
+                .append(" enqueued ")
+                .append(std::to_string(item.enqueued))
+                .append(" collapsed ")
+                .append(std::to_string(item.collapsed))
+                .append(" dropped ")
+                .append(std::to_string(item.dropped))
+                .append("\n");
+        }
+    }
+}
+
+void CellularCallDumpHelper::ShowTimerWheelInfo(std::string &result) const
+{
+    auto service = DelayedSingleton<CellularCallService>::GetInstance();
+    for (int32_t slotId = 0; slotId < SIM_SLOT_COUNT; slotId++) {
+        auto handler = service->GetHandler(slotId);
+        if (handler == nullptr) {
+            continue;
+        }
+        TimerWheelStats stats;
+        handler->GetTimerWheel()->GetStats(stats);
+        result.append("TimerWheel                : slot")
+            .append(std::to_string(slotId))
+            .append(" pending ")
+            .append(std::to_string(stats.pending))
+            .append(" armed ")
+            .append(std::to_string(stats.armed))
+            .append(" fired ")
+            .append(std::to_string(stats.fired))
+            .append(" cancelled ")
+            .append(std::to_string(stats.cancelled))
+            .append(" cascaded ")
+            .append(std::to_string(stats.cascaded))
+            .append("\n");
+    }
+}
+
+void CellularCallDumpHelper::ShowBroadcastDebounceInfo(std::string &result) const
+{
+    auto service = DelayedSingleton<CellularCallService>::GetInstance();
+    for (int32_t slotId = 0; slotId < SIM_SLOT_COUNT; slotId++) {
+        auto handler = service->GetHandler(slotId);
+        if (handler == nullptr) {
+            continue;
+        }
+        std::vector<BroadcastDebounceStats> stats;
+        handler->GetBroadcastDebounceStats(stats);
+        for (const auto &item : stats) {
+            result.append("BroadcastDebounce         : slot")
+                .append(std::to_string(slotId))
+                .append(" event ")
+                .append(std::to_string(item.eventId))
+                .append(" received ")
+                .append(std::to_string(item.received))
+                .append(" leading ")
+                .append(std::to_string(item.leading))
+                .append(" trailing ")
+                .append(std::to_string(item.trailing))
+                .append(" coalesced ")
+                .append(std::to_string(item.coalesced))
+                .append("\n");
+        }
+    }
+}
+
+void CellularCallDumpHelper::ShowEccAssemblyInfo(std::string &result) const
+{
+    auto service = DelayedSingleton<CellularCallService>::GetInstance();
+    for (int32_t slotId = 0; slotId < SIM_SLOT_COUNT; slotId++) {
+        auto handler = service->GetHandler(slotId);
+        if (handler == nullptr) {
+            continue;
+        }
+        EccAssemblyStats stats;
+        handler->GetEccAssemblyStats(stats);
+        // the lists delivered by the radio, against the ones queried again
+        uint64_t lists = stats.completed + stats.timeouts + stats.invalid;
+        result.append("EccAssembly               : slot")
+            .append(std::to_string(slotId))
+            .append(" chunks ")
+            .append(std::to_string(stats.chunks))
+            .append(" completed ")
+            .append(std::to_string(stats.completed))
+            .append(" outOfOrder ")
+            .append(std::to_string(stats.outOfOrder))
+            .append(" duplicates ")
+            .append(std::to_string(stats.duplicates))
+            .append(" restarts ")
+            .append(std::to_string(stats.restarts))
+            .append(" invalid ")
+            .append(std::to_string(stats.invalid))
+            .append(" timeouts ")
+            .append(std::to_string(stats.timeouts))
+            .append(" requeries ")
+            .append(std::to_string(stats.requeries))
+            .append("/")
+            .append(std::to_string(lists))
+            .append(" suppressed ")
+            .append(std::to_string(stats.suppressedRequeries))
+            .append("\n");
+    }
+}
+
+void CellularCallDumpHelper::ShowOperatorConfigInfo(std::string &result) const
+{
+    for (int32_t slotId = 0; slotId < SIM_SLOT_COUNT; slotId++) {
+        OperatorConfigCacheStats stats;
+        CellularCallConfig::GetOperatorConfigCacheStats(slotId, stats);
+        std::shared_ptr<const SlotConfig> config = CellularCallConfig::GetSlotConfig(slotId);
+        size_t mappedReasons = config->disconnectReasonTable != nullptr ? config->disconnectReasonTable->size() : 0;
+        result.append("OperatorConfig            : slot")
+            .append(std::to_string(slotId))
+            .append(" parses ")
+            .append(std::to_string(stats.parses))
+            .append(" parseHits ")
+            .append(std::to_string(stats.parseHits))
+            .append(" applies ")
+            .append(std::to_string(stats.applies))
+            .append(" unchanged ")
+            .append(std::to_string(stats.unchangedApplies))
+            .append(" lastChanges ")
+            .append(std::to_string(stats.lastChanges))
+            .append(" disconnectMapping v")
+            .append(std::to_string(config->disconnectReasonTableVersion))
+            .append("/")
+            .append(std::to_string(mappedReasons))
+            .append("\n");
+    }
+}
+
+void CellularCallDumpHelper::ShowEccCacheInfo(std::string &result) const
+{
+    EccCacheStats cacheStats;
+    DelayedSingleton<CellularCallEccCache>::GetInstance()->GetStats(cacheStats);
+    result.append("EccCache                  : ")
+        .append(cacheStats.isMapped ? "mapped" : "not mapped")
+        .append(" entries ")
+        .append(std::to_string(cacheStats.entryCount))
+        .append(" hits ")
+        .append(std::to_string(cacheStats.hits))
+        .append(" misses ")
+        .append(std::to_string(cacheStats.misses))
+        .append(" writes ")
+        .append(std::to_string(cacheStats.writes))
+        .append(" loadFailures ")
+        .append(std::to_string(cacheStats.loadFailures))
+        .append("\n");
+    EccPlmnLruStats lruStats;
+    CellularCallConfig::GetEccPlmnLruStats(lruStats);
+    result.append("EccPlmnLru                : size ")
+        .append(std::to_string(lruStats.size))
+        .append(" hits ")
+        .append(std::to_string(lruStats.hits))
+        .append(" misses ")
+        .append(std::to_string(lruStats.misses))
+        .append(" evictions ")
+        .append(std::to_string(lruStats.evictions))
+        .append("\n");
+    for (int32_t slotId = 0; slotId < SIM_SLOT_COUNT; slotId++) {
+        EccReadyStats readyStats;
+        CellularCallConfig::GetEccReadyStats(slotId, readyStats);
+        result.append("EccReady                  : slot")
+            .append(std::to_string(slotId))
+            .append(" boot ")
+            .append(std::to_string(readyStats.bootReadyCostMs))
+            .append(" ms last ")
+            .append(std::to_string(readyStats.lastReadyCostMs))
+            .append(" ms source ")
+            .append(std::to_string(static_cast<int32_t>(readyStats.lastSource)))
+            .append(" count ")
+            .append(std::to_string(readyStats.readyCount))
+            .append(readyStats.requestTimeMs != 0 ? " pending" : "")
+            .append("\n");
+        EccMergeStats mergeStats;
+        CellularCallConfig::GetEccMergeStats(slotId, mergeStats);
+        result.append("EccMerge                  : slot")
+            .append(std::to_string(slotId))
+            .append(" updates ")
+            .append(std::to_string(mergeStats.updates))
+            .append(" unchanged ")
+            .append(std::to_string(mergeStats.unchanged))
+            .append(" added ")
+            .append(std::to_string(mergeStats.added))
+            .append(" removed ")
+            .append(std::to_string(mergeStats.removed))
+            .append(" rebuilds ")
+            .append(std::to_string(mergeStats.rebuilds))
+            .append("\n");
+    }
+}
+
+void CellularCallDumpHelper::ShowParameterCacheInfo(std::string &result) const
+{
+    ParameterCacheStats stats;
+    DelayedSingleton<CellularCallParameterCache>::GetInstance()->GetStats(stats);
+    result.append("ParameterCache            : keys ")
+        .append(std::to_string(stats.cachedKeys))
+        .append(" hits ")
+        .append(std::to_string(stats.hits))
+        .append(" misses ")
+        .append(std::to_string(stats.misses))
+        .append(" updates ")
+        .append(std::to_string(stats.updates))
+        .append(" watchFailures ")
+        .append(std::to_string(stats.watchFailures))
+        .append("\n");
+}
+
+void CellularCallDumpHelper::ShowDataShareInfo(std::string &result) const
+{
+    static const char *operationNames[] = { "eccList", "setting", "observer" };
+    DataSharePoolStats stats;
+    DelayedSingleton<CellularCallRdbHelper>::GetInstance()->GetDataShareStats(stats);
+    result.append("DataSharePool             : active ")
+        .append(std::to_string(stats.activeConnections))
+        .append(" connects ")
+        .append(std::to_string(stats.connects))
+        .append(" connectFailures ")
+        .append(std::to_string(stats.connectFailures))
+        .append(" reuses ")
+        .append(std::to_string(stats.reuses))
+        .append(" reconnects ")
+        .append(std::to_string(stats.reconnects))
+        .append(" expires ")
+        .append(std::to_string(stats.expires))
+        .append("\n");
+    for (uint32_t i = 0; i < static_cast<uint32_t>(DataShareOperation::COUNT); i++) {
+        const DataShareOperationStats &operation = stats.operations[i];
+        if (operation.count == 0) {
+            continue;
+        }
+        result.append("DataShareQuery            : ")
+            .append(operationNames[i])
+            .append(" count ")
+            .append(std::to_string(operation.count))
+            .append(" failures ")
+            .append(std::to_string(operation.failures))
+            .append(" avg ")
+            .append(std::to_string(operation.totalCostMs / static_cast<int64_t>(operation.count)))
+            .append(" ms max ")
+            .append(std::to_string(operation.maxCostMs))
+            .append(" ms\n");
+    }
+}
 } // namespace Telephony
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_ecc_assembler.h"
+
+namespace OHOS {
+namespace Telephony {
+EccAssemblyResult CellularCallEccAssembler::AddChunk(const EmergencyInfoList &chunk, int64_t nowMs,
+    EmergencyInfoList &eccList, bool &isNewAssembly)
+{
+    isNewAssembly = false;
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    stats_.chunks++;
+    // an empty report clears the list, a report holding the whole list needs no assembly
+    if (received_.empty() &&
+        (chunk.calls.empty() || static_cast<uint32_t>(chunk.calls.back().total) == chunk.calls.size())) {
+        eccList = chunk;
+        stats_.completed++;
+        return EccAssemblyResult::COMPLETE;
+    }
+    for (const auto &call : chunk.calls) {
+        if (call.total <= 0 || call.total > ECC_ASSEMBLY_MAX_TOTAL || call.index < 1 || call.index > call.total) {
+            total_ = 0;
+            lastIndex_ = 0;
+            received_.clear();
+            stats_.invalid++;
+            return EccAssemblyResult::INVALID;
+        }
+        if (call.total != total_) {
+            if (!received_.empty()) {
+                stats_.restarts++;
+            }
+            received_.clear();
+            total_ = call.total;
+            lastIndex_ = 0;
+        }
+        if (received_.empty()) {
+            startMs_ = nowMs;
+            isNewAssembly = true;
+        }
+        auto it = received_.find(call.index);
+        if (it != received_.end()) {
+            stats_.duplicates++;
+            it->second = call;
+        } else {
+            if (call.index != lastIndex_ + 1) {
+                stats_.outOfOrder++;
+            }
+            received_.emplace(call.index, call);
+        }
+        lastIndex_ = call.index;
+    }
+    if (received_.size() != static_cast<size_t>(total_)) {
+        return EccAssemblyResult::PARTIAL;
+    }
+    eccList.callSize = total_;
+    eccList.flag = chunk.flag;
+    eccList.calls.clear();
+    eccList.calls.reserve(received_.size());
+    for (const auto &it : received_) {
+        eccList.calls.push_back(it.second);
+    }
+    total_ = 0;
+    lastIndex_ = 0;
+    received_.clear();
+    isNewAssembly = false;
+    stats_.completed++;
+    return EccAssemblyResult::COMPLETE;
+}
+
+bool CellularCallEccAssembler::CheckTimeout(int64_t nowMs, std::vector<EccIndexRange> &missing)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (received_.empty() || nowMs - startMs_ < ECC_ASSEMBLY_TIMEOUT_MS) {
+        return false;
+    }
+    GetMissingRangesLocked(missing);
+    total_ = 0;
+    lastIndex_ = 0;
+    received_.clear();
+    stats_.timeouts++;
+    return true;
+}
+
+void CellularCallEccAssembler::GetMissingRangesLocked(std::vector<EccIndexRange> &missing) const
+{
+    missing.clear();
+    int32_t next = 1;
+    for (const auto &it : received_) {
+        if (it.first > next) {
+            missing.push_back({ next, it.first - 1 });
+        }
+        next = it.first + 1;
+    }
+    if (next <= total_) {
+        missing.push_back({ next, total_ });
+    }
+}
+
+void CellularCallEccAssembler::Reset()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    total_ = 0;
+    lastIndex_ = 0;
+    received_.clear();
+}
+
+bool CellularCallEccAssembler::TryRequery(int64_t nowMs)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    // the query in flight answers with the whole list
+    if (nowMs - lastRequeryMs_ < ECC_REQUERY_MIN_INTERVAL_MS) {
+        stats_.suppressedRequeries++;
+        return false;
+    }
+    lastRequeryMs_ = nowMs;
+    stats_.requeries++;
+    return true;
+}
+
+void CellularCallEccAssembler::GetStats(EccAssemblyStats &stats)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    stats = stats_;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,324 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_ecc_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "securec.h"
+#include "telephony_errors.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr uint32_t FNV_OFFSET_BASIS = 2166136261u;
+static constexpr uint32_t FNV_PRIME = 16777619u;
+static constexpr mode_t ECC_CACHE_FILE_MODE = 0640;
+
+CellularCallEccCache::CellularCallEccCache() {}
+
+CellularCallEccCache::~CellularCallEccCache()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    UnmapLocked();
+}
+
+uint32_t CellularCallEccCache::GetChecksum(const uint8_t *data, size_t size)
+{
+    uint32_t checksum = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < size; i++) {
+        checksum ^= data[i];
+        checksum *= FNV_PRIME;
+    }
+    return checksum;
+}
+
+int32_t CellularCallEccCache::Open(const std::string &path)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    UnmapLocked();
+    verifiedPlmns_.clear();
+    path_ = path;
+    isOpened_ = true;
+    return MapLocked();
+}
+
+void CellularCallEccCache::OpenDefaultLocked()
+{
+    if (isOpened_) {
+        return;
+    }
+    isOpened_ = true;
+    path_ = ECC_CACHE_FILE_PATH;
+    MapLocked();
+}
+
+int32_t CellularCallEccCache::MapLocked()
+{
+    int fd = open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        TELEPHONY_LOGI("no ecc cache, errno:%{public}d", errno);
+        return TELEPHONY_ERR_FAIL;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < static_cast<off_t>(sizeof(FileHeader)) ||
+        fileStat.st_size > static_cast<off_t>(ECC_CACHE_MAX_FILE_SIZE)) {
+        close(fd);
+        stats_.loadFailures++;
+        TELEPHONY_LOGE("ecc cache size is invalid, drop it");
+        unlink(path_.c_str());
+        return TELEPHONY_ERR_FAIL;
+    }
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        stats_.loadFailures++;
+        TELEPHONY_LOGE("mmap ecc cache failed, errno:%{public}d", errno);
+        return TELEPHONY_ERR_FAIL;
+    }
+    data_ = static_cast<uint8_t *>(data);
+    size_ = size;
+    header_ = reinterpret_cast<const FileHeader *>(data_);
+    entries_ = reinterpret_cast<const FileEntry *>(data_ + sizeof(FileHeader));
+    if (!IsValidLocked()) {
+        UnmapLocked();
+        stats_.loadFailures++;
+        TELEPHONY_LOGE("ecc cache is broken or of another version, drop it");
+        unlink(path_.c_str());
+        return TELEPHONY_ERR_FAIL;
+    }
+    pool_ = reinterpret_cast<const char *>(entries_ + header_->entryCount);
+    TELEPHONY_LOGI("ecc cache mapped, entries:%{public}u", header_->entryCount);
+    return TELEPHONY_SUCCESS;
+}
+
+void CellularCallEccCache::UnmapLocked()
+{
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    header_ = nullptr;
+    entries_ = nullptr;
+    pool_ = nullptr;
+}
+
+bool CellularCallEccCache::IsValidLocked() const
+{
+    if (header_->magic != ECC_CACHE_MAGIC || header_->version != ECC_CACHE_VERSION ||
+        header_->entryCount > ECC_CACHE_MAX_ENTRIES) {
+        return false;
+    }
+    size_t tableSize = static_cast<size_t>(header_->entryCount) * sizeof(FileEntry);
+    if (size_ != sizeof(FileHeader) + tableSize + header_->poolSize) {
+        return false;
+    }
+    if (GetChecksum(data_ + sizeof(FileHeader), size_ - sizeof(FileHeader)) != header_->checksum) {
+        return false;
+    }
+    // checked once here, so lookups on the mapping never leave the pool
+    for (uint32_t i = 0; i < header_->entryCount; i++) {
+        const FileEntry &entry = entries_[i];
+        if (entry.plmn[ECC_CACHE_PLMN_LEN - 1] != '\0' ||
+            static_cast<uint64_t>(entry.withCardOffset) + entry.withCardLen > header_->poolSize ||
+            static_cast<uint64_t>(entry.noCardOffset) + entry.noCardLen > header_->poolSize ||
+            static_cast<uint64_t>(entry.fakeOffset) + entry.fakeLen > header_->poolSize) {
+            return false;
+        }
+        if (i > 0 && strncmp(entries_[i - 1].plmn, entry.plmn, ECC_CACHE_PLMN_LEN) >= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const CellularCallEccCache::FileEntry *CellularCallEccCache::FindLocked(const std::string &plmn) const
+{
+    if (header_ == nullptr) {
+        return nullptr;
+    }
+    const FileEntry *begin = entries_;
+    const FileEntry *end = entries_ + header_->entryCount;
+    const FileEntry *it = std::lower_bound(begin, end, plmn, [](const FileEntry &entry, const std::string &key) {
+        return strncmp(entry.plmn, key.c_str(), ECC_CACHE_PLMN_LEN) < 0;
+    });
+    if (it == end || plmn != it->plmn) {
+        return nullptr;
+    }
+    return it;
+}
+
+std::string CellularCallEccCache::GetStringLocked(uint32_t offset, uint16_t len) const
+{
+    return std::string(pool_ + offset, len);
+}
+
+bool CellularCallEccCache::Lookup(const std::string &plmn, EccNum &eccNum, bool &needVerify)
+{
+    needVerify = false;
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    OpenDefaultLocked();
+    const FileEntry *entry = FindLocked(plmn);
+    if (entry == nullptr) {
+        stats_.misses++;
+        return false;
+    }
+    stats_.hits++;
+    eccNum.numeric = plmn;
+    eccNum.ecc_withcard = GetStringLocked(entry->withCardOffset, entry->withCardLen);
+    eccNum.ecc_nocard = GetStringLocked(entry->noCardOffset, entry->noCardLen);
+    eccNum.ecc_fake = GetStringLocked(entry->fakeOffset, entry->fakeLen);
+    needVerify = verifiedPlmns_.find(plmn) == verifiedPlmns_.end();
+    return true;
+}
+
+void CellularCallEccCache::ReadRecordsLocked(std::map<std::string, Record> &records) const
+{
+    if (header_ == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i < header_->entryCount; i++) {
+        const FileEntry &entry = entries_[i];
+        Record &record = records[entry.plmn];
+        record.sequence = entry.sequence;
+        record.withCard = GetStringLocked(entry.withCardOffset, entry.withCardLen);
+        record.noCard = GetStringLocked(entry.noCardOffset, entry.noCardLen);
+        record.fake = GetStringLocked(entry.fakeOffset, entry.fakeLen);
+    }
+}
+
+int32_t CellularCallEccCache::Store(const std::string &plmn, const EccNum &eccNum, bool &isChanged)
+{
+    isChanged = false;
+    uint32_t maxLen = std::numeric_limits<uint16_t>::max();
+    if (plmn.empty() || plmn.size() >= ECC_CACHE_PLMN_LEN || eccNum.ecc_withcard.size() > maxLen ||
+        eccNum.ecc_nocard.size() > maxLen || eccNum.ecc_fake.size() > maxLen) {
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    OpenDefaultLocked();
+    verifiedPlmns_.insert(plmn);
+    std::map<std::string, Record> records;
+    ReadRecordsLocked(records);
+    auto it = records.find(plmn);
+    if (it != records.end() && it->second.withCard == eccNum.ecc_withcard && it->second.noCard == eccNum.ecc_nocard &&
+        it->second.fake == eccNum.ecc_fake) {
+        return TELEPHONY_SUCCESS;
+    }
+    uint32_t sequence = header_ != nullptr ? header_->sequence + 1 : 1;
+    Record &record = records[plmn];
+    record.sequence = sequence;
+    record.withCard = eccNum.ecc_withcard;
+    record.noCard = eccNum.ecc_nocard;
+    record.fake = eccNum.ecc_fake;
+    if (records.size() > ECC_CACHE_MAX_ENTRIES) {
+        auto oldest = std::min_element(records.begin(), records.end(),
+            [](const auto &left, const auto &right) { return left.second.sequence < right.second.sequence; });
+        records.erase(oldest);
+    }
+    int32_t ret = WriteLocked(records, sequence);
+    if (ret == TELEPHONY_SUCCESS) {
+        isChanged = true;
+    }
+    return ret;
+}
+
+int32_t CellularCallEccCache::WriteLocked(const std::map<std::string, Record> &records, uint32_t sequence)
+{
+    std::vector<FileEntry> entries;
+    std::string pool;
+    for (const auto &item : records) {
+        FileEntry entry;
+        if (memcpy_s(entry.plmn, ECC_CACHE_PLMN_LEN, item.first.c_str(), item.first.size()) != EOK) {
+            return TELEPHONY_ERR_ARGUMENT_INVALID;
+        }
+        entry.sequence = item.second.sequence;
+        entry.withCardOffset = static_cast<uint32_t>(pool.size());
+        entry.withCardLen = static_cast<uint16_t>(item.second.withCard.size());
+        pool.append(item.second.withCard);
+        entry.noCardOffset = static_cast<uint32_t>(pool.size());
+        entry.noCardLen = static_cast<uint16_t>(item.second.noCard.size());
+        pool.append(item.second.noCard);
+        entry.fakeOffset = static_cast<uint32_t>(pool.size());
+        entry.fakeLen = static_cast<uint16_t>(item.second.fake.size());
+        pool.append(item.second.fake);
+        entries.push_back(entry);
+    }
+    std::vector<uint8_t> content(sizeof(FileHeader) + entries.size() * sizeof(FileEntry) + pool.size());
+    if (content.size() > ECC_CACHE_MAX_FILE_SIZE) {
+        TELEPHONY_LOGE("ecc cache is too large");
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    FileHeader header;
+    header.magic = ECC_CACHE_MAGIC;
+    header.version = ECC_CACHE_VERSION;
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.poolSize = static_cast<uint32_t>(pool.size());
+    header.sequence = sequence;
+    uint8_t *body = content.data() + sizeof(FileHeader);
+    if (!entries.empty()) {
+        std::copy_n(reinterpret_cast<const uint8_t *>(entries.data()), entries.size() * sizeof(FileEntry), body);
+    }
+    std::copy(pool.begin(), pool.end(), body + entries.size() * sizeof(FileEntry));
+    header.checksum = GetChecksum(body, content.size() - sizeof(FileHeader));
+    std::copy_n(reinterpret_cast<const uint8_t *>(&header), sizeof(FileHeader), content.data());
+
+    std::string tempPath = path_ + ".tmp";
+    int fd = open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, ECC_CACHE_FILE_MODE);
+    if (fd < 0) {
+        TELEPHONY_LOGE("create ecc cache failed, errno:%{public}d", errno);
+        return TELEPHONY_ERR_FAIL;
+    }
+    bool isWritten = write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size()) &&
+        fsync(fd) == 0;
+    close(fd);
+    if (!isWritten || rename(tempPath.c_str(), path_.c_str()) != 0) {
+        TELEPHONY_LOGE("write ecc cache failed, errno:%{public}d", errno);
+        unlink(tempPath.c_str());
+        return TELEPHONY_ERR_FAIL;
+    }
+    stats_.writes++;
+    UnmapLocked();
+    return MapLocked();
+}
+
+void CellularCallEccCache::Clear()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    OpenDefaultLocked();
+    UnmapLocked();
+    verifiedPlmns_.clear();
+    unlink(path_.c_str());
+    TELEPHONY_LOGI("ecc cache is cleared");
+}
+
+void CellularCallEccCache::GetStats(EccCacheStats &stats)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    stats = stats_;
+    stats.isMapped = header_ != nullptr;
+    stats.entryCount = header_ != nullptr ? header_->entryCount : 0;
+}
+} // namespace Telephony
+} // namespace OHOS
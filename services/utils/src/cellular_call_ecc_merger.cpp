@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_ecc_merger.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace OHOS {
+namespace Telephony {
+static constexpr uint64_t ECC_HASH_SEED = 0xcbf29ce484222325ULL;
+static constexpr uint64_t ECC_HASH_MULTIPLIER = 0x100000001b3ULL;
+
+static void HashValue(uint64_t &hash, uint64_t value)
+{
+    hash = (hash ^ value) * ECC_HASH_MULTIPLIER;
+}
+
+static bool IsSameCall(const EmergencyCall &left, const EmergencyCall &right)
+{
+    return left.eccNum == right.eccNum && left.mcc == right.mcc && left.eccType == right.eccType &&
+        left.simpresent == right.simpresent && left.abnormalService == right.abnormalService;
+}
+
+std::string CellularCallEccMerger::GetKey(const EmergencyCall &call)
+{
+    std::string key;
+    key.reserve(call.eccNum.size() + call.mcc.size() + 1);
+    key.append(call.eccNum).append(1, '\0').append(call.mcc);
+    return key;
+}
+
+uint64_t CellularCallEccMerger::GetHash(const std::vector<EmergencyCall> &eccList)
+{
+    std::hash<std::string> stringHash;
+    uint64_t hash = ECC_HASH_SEED;
+    for (const auto &call : eccList) {
+        HashValue(hash, stringHash(call.eccNum));
+        HashValue(hash, stringHash(call.mcc));
+        HashValue(hash, static_cast<uint64_t>(call.eccType));
+        HashValue(hash, static_cast<uint64_t>(call.simpresent));
+        HashValue(hash, static_cast<uint64_t>(call.abnormalService));
+    }
+    return hash;
+}
+
+bool CellularCallEccMerger::SetSource(EccMergeSource source, const std::vector<EmergencyCall> &eccList)
+{
+    uint32_t index = static_cast<uint32_t>(source);
+    if (index >= static_cast<uint32_t>(EccMergeSource::COUNT)) {
+        return false;
+    }
+    uint64_t hash = GetHash(eccList);
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    stats_.updates++;
+    SourceState &state = sources_[index];
+    if (state.hash == hash && state.calls.size() == eccList.size() &&
+        std::equal(eccList.begin(), eccList.end(), state.calls.begin(), IsSameCall)) {
+        stats_.unchanged++;
+        return false;
+    }
+    std::unordered_map<std::string, size_t> positions;
+    positions.reserve(eccList.size());
+    for (size_t i = 0; i < eccList.size(); i++) {
+        positions.emplace(GetKey(eccList[i]), i);
+    }
+    uint32_t bit = 1u << index;
+    for (const auto &it : state.positions) {
+        if (positions.find(it.first) != positions.end()) {
+            continue;
+        }
+        auto mergedIt = merged_.find(it.first);
+        if (mergedIt == merged_.end()) {
+            continue;
+        }
+        mergedIt->second &= ~bit;
+        if (mergedIt->second == 0) {
+            merged_.erase(mergedIt);
+        }
+        stats_.removed++;
+    }
+    for (const auto &it : positions) {
+        if (state.positions.find(it.first) != state.positions.end()) {
+            continue;
+        }
+        merged_[it.first] |= bit;
+        stats_.added++;
+    }
+    state.hash = hash;
+    state.calls = eccList;
+    state.positions.swap(positions);
+    mergedList_ = nullptr;
+    return true;
+}
+
+std::shared_ptr<const std::vector<EmergencyCall>> CellularCallEccMerger::GetMergedList()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (mergedList_ != nullptr) {
+        return mergedList_;
+    }
+    auto mergedList = std::make_shared<std::vector<EmergencyCall>>();
+    mergedList->reserve(merged_.size());
+    for (uint32_t index = 0; index < static_cast<uint32_t>(EccMergeSource::COUNT); index++) {
+        const SourceState &state = sources_[index];
+        for (size_t i = 0; i < state.calls.size(); i++) {
+            std::string key = GetKey(state.calls[i]);
+            auto mergedIt = merged_.find(key);
+            // taken from the first source having the number, at its first position there
+            if (mergedIt == merged_.end() || (mergedIt->second & (~mergedIt->second + 1)) != (1u << index) ||
+                state.positions.at(key) != i) {
+                continue;
+            }
+            mergedList->push_back(state.calls[i]);
+        }
+    }
+    stats_.rebuilds++;
+    mergedList_ = mergedList;
+    return mergedList_;
+}
+
+void CellularCallEccMerger::Clear()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    for (auto &state : sources_) {
+        state = SourceState();
+    }
+    merged_.clear();
+    mergedList_ = nullptr;
+}
+
+void CellularCallEccMerger::GetStats(EccMergeStats &stats)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    stats = stats_;
+}
+} // namespace Telephony
+} // namespace OHOS
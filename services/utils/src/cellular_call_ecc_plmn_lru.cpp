@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_ecc_plmn_lru.h"
+
+#include <iterator>
+
+namespace OHOS {
+namespace Telephony {
+CellularCallEccPlmnLru::CellularCallEccPlmnLru(size_t capacity) : capacity_(capacity == 0 ? 1 : capacity) {}
+
+bool CellularCallEccPlmnLru::Get(const std::string &plmn, EccNum &eccNum)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto it = index_.find(plmn);
+    if (it == index_.end() || !it->second->isValid) {
+        stats_.misses++;
+        return false;
+    }
+    nodes_.splice(nodes_.begin(), nodes_, it->second);
+    eccNum = it->second->eccNum;
+    stats_.hits++;
+    return true;
+}
+
+bool CellularCallEccPlmnLru::Contains(const std::string &plmn)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto it = index_.find(plmn);
+    return it != index_.end() && it->second->isValid;
+}
+
+void CellularCallEccPlmnLru::Put(const std::string &plmn, const EccNum &eccNum)
+{
+    if (plmn.empty()) {
+        return;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto it = index_.find(plmn);
+    if (it != index_.end()) {
+        nodes_.splice(nodes_.begin(), nodes_, it->second);
+        it->second->eccNum = eccNum;
+        it->second->isValid = true;
+        return;
+    }
+    if (nodes_.size() >= capacity_) {
+        index_.erase(nodes_.back().plmn);
+        nodes_.pop_back();
+        stats_.evictions++;
+    }
+    nodes_.push_front({ plmn, eccNum, true });
+    index_[plmn] = nodes_.begin();
+}
+
+bool CellularCallEccPlmnLru::PutIfRoom(const std::string &plmn, const EccNum &eccNum)
+{
+    if (plmn.empty()) {
+        return false;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    if (nodes_.size() >= capacity_ || index_.find(plmn) != index_.end()) {
+        return false;
+    }
+    nodes_.push_back({ plmn, eccNum, true });
+    index_[plmn] = std::prev(nodes_.end());
+    return true;
+}
+
+void CellularCallEccPlmnLru::Invalidate()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    for (auto &node : nodes_) {
+        node.eccNum = EccNum();
+        node.isValid = false;
+    }
+}
+
+void CellularCallEccPlmnLru::Clear()
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    nodes_.clear();
+    index_.clear();
+}
+
+void CellularCallEccPlmnLru::GetInvalidPlmns(std::vector<std::string> &plmns)
+{
+    plmns.clear();
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    for (const auto &node : nodes_) {
+        if (!node.isValid) {
+            plmns.push_back(node.plmn);
+        }
+    }
+}
+
+void CellularCallEccPlmnLru::GetStats(EccPlmnLruStats &stats)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    stats = stats_;
+    stats.size = static_cast<uint32_t>(nodes_.size());
+}
+} // namespace Telephony
+} // namespace OHOS
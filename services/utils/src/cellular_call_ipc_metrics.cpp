@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_ipc_metrics.h"
+
+#include <algorithm>
+
+#include "cellular_call_clock.h"
+#include "cellular_call_hisysevent.h"
+#include "ffrt.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr int64_t IPC_METRICS_REPORT_INTERVAL_US = 3600LL * 1000 * 1000;
+
+CellularCallIpcMetrics::CellularCallIpcMetrics() {}
+
+CellularCallIpcMetrics::~CellularCallIpcMetrics() {}
+
+int32_t CellularCallIpcMetrics::GetLatencyBucket(uint64_t costUs)
+{
+    int32_t bucket = 0;
+    while (bucket < IPC_LATENCY_BUCKET_NUM - 1 && costUs > IPC_LATENCY_BUCKET_BOUNDS_US[bucket]) {
+        bucket++;
+    }
+    return bucket;
+}
+
+CellularCallIpcMetrics::CodeCounter *CellularCallIpcMetrics::FindCounter(CodeTable &table, uint32_t code)
+{
+    uint64_t key = static_cast<uint64_t>(code) + 1;
+    uint32_t start = code % IPC_METRICS_MAX_CODES;
+    for (int32_t i = 0; i < IPC_METRICS_MAX_CODES; i++) {
+        CodeCounter &counter = table.counters[(start + i) % IPC_METRICS_MAX_CODES];
+        uint64_t current = counter.key.load(std::memory_order_acquire);
+        if (current == key) {
+            return &counter;
+        }
+        if (current == 0) {
+            if (counter.key.compare_exchange_strong(current, key, std::memory_order_acq_rel) || current == key) {
+                return &counter;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void CellularCallIpcMetrics::Record(IpcDirection direction, uint32_t code, int32_t result, size_t bytes, int64_t costUs)
+{
+    if (direction < IpcDirection::CALL_MANAGER_INBOUND || direction >= IpcDirection::DIRECTION_BUTT) {
+        return;
+    }
+    CodeTable &table = tables_[static_cast<int32_t>(direction)];
+    CodeCounter *counter = FindCounter(table, code);
+    if (counter == nullptr) {
+        table.overflow.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    uint64_t cost = costUs > 0 ? static_cast<uint64_t>(costUs) : 0;
+    counter->count.fetch_add(1, std::memory_order_relaxed);
+    if (result != 0) {
+        counter->errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    counter->bytes.fetch_add(bytes, std::memory_order_relaxed);
+    counter->totalCostUs.fetch_add(cost, std::memory_order_relaxed);
+    counter->latency[GetLatencyBucket(cost)].fetch_add(1, std::memory_order_relaxed);
+    uint64_t maxCost = counter->maxCostUs.load(std::memory_order_relaxed);
+    while (cost > maxCost && !counter->maxCostUs.compare_exchange_weak(maxCost, cost, std::memory_order_relaxed)) {
+    }
+    TryReportSummary(CellularCallClock::GetInstance()->NowUs());
+}
+
+void CellularCallIpcMetrics::GetStats(IpcDirection direction, std::vector<IpcCodeStats> &stats)
+{
+    stats.clear();
+    if (direction < IpcDirection::CALL_MANAGER_INBOUND || direction >= IpcDirection::DIRECTION_BUTT) {
+        return;
+    }
+    CodeTable &table = tables_[static_cast<int32_t>(direction)];
+    for (const CodeCounter &counter : table.counters) {
+        uint64_t key = counter.key.load(std::memory_order_acquire);
+        if (key == 0) {
+            continue;
+        }
+        IpcCodeStats item;
+        item.code = static_cast<uint32_t>(key - 1);
+        item.count = counter.count.load(std::memory_order_relaxed);
+        item.errors = counter.errors.load(std::memory_order_relaxed);
+        item.bytes = counter.bytes.load(std::memory_order_relaxed);
+        item.totalCostUs = counter.totalCostUs.load(std::memory_order_relaxed);
+        item.maxCostUs = counter.maxCostUs.load(std::memory_order_relaxed);
+        for (int32_t i = 0; i < IPC_LATENCY_BUCKET_NUM; i++) {
+            item.latency[i] = counter.latency[i].load(std::memory_order_relaxed);
+        }
+        stats.push_back(item);
+    }
+    std::sort(stats.begin(), stats.end(),
+        [](const IpcCodeStats &left, const IpcCodeStats &right) { return left.count > right.count; });
+}
+
+uint64_t CellularCallIpcMetrics::GetOverflowCount(IpcDirection direction)
+{
+    if (direction < IpcDirection::CALL_MANAGER_INBOUND || direction >= IpcDirection::DIRECTION_BUTT) {
+        return 0;
+    }
+    return tables_[static_cast<int32_t>(direction)].overflow.load(std::memory_order_relaxed);
+}
+
+void CellularCallIpcMetrics::Reset()
+{
+    for (CodeTable &table : tables_) {
+        for (CodeCounter &counter : table.counters) {
+            counter.key.store(0, std::memory_order_relaxed);
+            counter.count.store(0, std::memory_order_relaxed);
+            counter.errors.store(0, std::memory_order_relaxed);
+            counter.bytes.store(0, std::memory_order_relaxed);
+            counter.totalCostUs.store(0, std::memory_order_relaxed);
+            counter.maxCostUs.store(0, std::memory_order_relaxed);
+            for (auto &bucket : counter.latency) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+        table.overflow.store(0, std::memory_order_relaxed);
+    }
+}
+
+void CellularCallIpcMetrics::TryReportSummary(int64_t now)
+{
+    int64_t lastReportTime = lastReportTimeUs_.load(std::memory_order_relaxed);
+    if (lastReportTime == 0) {
+        // the first transaction only starts the interval
+        lastReportTimeUs_.compare_exchange_strong(lastReportTime, now, std::memory_order_relaxed);
+        return;
+    }
+    if (now - lastReportTime < IPC_METRICS_REPORT_INTERVAL_US) {
+        return;
+    }
+    if (!lastReportTimeUs_.compare_exchange_strong(lastReportTime, now, std::memory_order_relaxed)) {
+        return;
+    }
+    ffrt::submit([this]() { ReportSummary(); });
+}
+
+void CellularCallIpcMetrics::ReportSummary()
+{
+    std::vector<IpcCodeStats> stats;
+    for (int32_t direction = 0; direction < static_cast<int32_t>(IpcDirection::DIRECTION_BUTT); direction++) {
+        GetStats(static_cast<IpcDirection>(direction), stats);
+        if (stats.empty()) {
+            continue;
+        }
+        uint64_t totalCount = 0;
+        uint64_t errorCount = 0;
+        uint64_t maxCostUs = 0;
+        for (const auto &item : stats) {
+            totalCount += item.count;
+            errorCount += item.errors;
+            maxCostUs = std::max(maxCostUs, item.maxCostUs);
+        }
+        TELEPHONY_LOGI("ipc direction:%{public}d total:%{public}llu error:%{public}llu top code:%{public}u",
+            direction, static_cast<unsigned long long>(totalCount), static_cast<unsigned long long>(errorCount),
+            stats[0].code);
+        CellularCallHiSysEvent::WriteIpcStatisticsEvent(direction, static_cast<int64_t>(totalCount),
+            static_cast<int64_t>(errorCount), static_cast<int32_t>(stats[0].code), static_cast<int64_t>(stats[0].count),
+            static_cast<int64_t>(maxCostUs));
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
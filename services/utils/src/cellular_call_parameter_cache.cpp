@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_parameter_cache.h"
+
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <mutex>
+
+#include "parameter.h"
+#include "parameters.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr int32_t DECIMAL_BASE = 10;
+
+CellularCallParameterCache::CellularCallParameterCache() = default;
+
+CellularCallParameterCache::~CellularCallParameterCache()
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (const auto &it : entries_) {
+        RemoveParameterWatcher(it.first.c_str(), ParameterChangedCallback, this);
+    }
+    entries_.clear();
+}
+
+std::string CellularCallParameterCache::GetString(const std::string &key, const std::string &defValue)
+{
+    std::string value = Read(key);
+    return value.empty() ? defValue : value;
+}
+
+int32_t CellularCallParameterCache::GetInt(const std::string &key, int32_t defValue)
+{
+    std::string value = Read(key);
+    if (value.empty()) {
+        return defValue;
+    }
+    char *end = nullptr;
+    errno = 0;
+    long long result = std::strtoll(value.c_str(), &end, DECIMAL_BASE);
+    if (errno != 0 || end == value.c_str() || *end != '\0' || result < INT32_MIN || result > INT32_MAX) {
+        return defValue;
+    }
+    return static_cast<int32_t>(result);
+}
+
+bool CellularCallParameterCache::GetBool(const std::string &key, bool defValue)
+{
+    std::string value = Read(key);
+    if (value == "1" || value == "y" || value == "yes" || value == "on" || value == "true") {
+        return true;
+    }
+    if (value == "0" || value == "n" || value == "no" || value == "off" || value == "false") {
+        return false;
+    }
+    return defValue;
+}
+
+int32_t CellularCallParameterCache::SetString(const std::string &key, const std::string &value)
+{
+    int32_t ret = SetParameter(key.c_str(), value.c_str());
+    if (ret != 0) {
+        TELEPHONY_LOGE("set parameter %{public}s failed, ret:%{public}d", key.c_str(), ret);
+        return ret;
+    }
+    OnParameterChanged(key, value);
+    return ret;
+}
+
+std::string CellularCallParameterCache::Read(const std::string &key)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it != entries_.end() && !it->second.isPending) {
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return it->second.value;
+        }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    bool isWatched = Watch(key);
+    // read after the watcher is registered, so that no change is lost in between
+    std::string value = system::GetParameter(key, "");
+    if (!isWatched) {
+        return value;
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return value;
+    }
+    // a value delivered by the watcher meanwhile is newer than the one read
+    if (it->second.isPending) {
+        it->second.isPending = false;
+        it->second.value = value;
+    }
+    return it->second.value;
+}
+
+bool CellularCallParameterCache::Watch(const std::string &key)
+{
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (entries_.find(key) != entries_.end()) {
+            return true;
+        }
+        entries_.emplace(key, Entry());
+    }
+    if (WatchParameter(key.c_str(), ParameterChangedCallback, this) == 0) {
+        return true;
+    }
+    TELEPHONY_LOGE("watch parameter %{public}s failed", key.c_str());
+    watchFailures_.fetch_add(1, std::memory_order_relaxed);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    entries_.erase(key);
+    return false;
+}
+
+void CellularCallParameterCache::OnParameterChanged(const std::string &key, const std::string &value)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    // the watcher matches the key as a prefix, keys sharing it are not cached
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return;
+    }
+    it->second.isPending = false;
+    it->second.value = value;
+    updates_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CellularCallParameterCache::ParameterChangedCallback(const char *key, const char *value, void *context)
+{
+    if (key == nullptr || context == nullptr) {
+        return;
+    }
+    static_cast<CellularCallParameterCache *>(context)->OnParameterChanged(key, value == nullptr ? "" : value);
+}
+
+void CellularCallParameterCache::GetStats(ParameterCacheStats &stats)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        stats.cachedKeys = static_cast<uint32_t>(entries_.size());
+    }
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.updates = updates_.load(std::memory_order_relaxed);
+    stats.watchFailures = watchFailures_.load(std::memory_order_relaxed);
+}
+} // namespace Telephony
+} // namespace OHOS
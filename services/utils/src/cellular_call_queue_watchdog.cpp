@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_queue_watchdog.h"
+
+#include <algorithm>
+
+#include "cellular_call_hisysevent.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+void CellularCallQueueWatchdog::SetSlotId(int32_t slotId)
+{
+    slotId_ = slotId;
+}
+
+void CellularCallQueueWatchdog::OnDispatch(uint32_t eventId, int64_t waitMs, int64_t runMs, int64_t nowMs)
+{
+    bool isSlowRun = runMs >= QUEUE_WATCHDOG_RUN_THRESHOLD_MS;
+    {
+        std::lock_guard<ffrt::mutex> lock(statsMutex_);
+        QueueWatchdogEventStats &stats = eventStats_[eventId];
+        stats.eventId = eventId;
+        stats.count++;
+        if (waitMs > 0) {
+            stats.maxWaitMs = std::max(stats.maxWaitMs, static_cast<uint64_t>(waitMs));
+        }
+        if (runMs > 0) {
+            stats.maxRunMs = std::max(stats.maxRunMs, static_cast<uint64_t>(runMs));
+        }
+        if (isSlowRun) {
+            stats.slowRunCount++;
+        }
+    }
+    if (isSlowRun) {
+        slowRunCount_.fetch_add(1, std::memory_order_relaxed);
+        TELEPHONY_LOGW("[slot%{public}d] eventId:%{public}u ran %{public}lld ms", slotId_, eventId,
+            static_cast<long long>(runMs));
+        TryReport(eventId, waitMs, runMs, nowMs);
+    }
+    if (waitMs >= 0) {
+        UpdateBackpressure(eventId, waitMs, nowMs);
+    }
+}
+
+void CellularCallQueueWatchdog::UpdateBackpressure(uint32_t eventId, int64_t waitMs, int64_t nowMs)
+{
+    if (waitMs >= QUEUE_WATCHDOG_WAIT_THRESHOLD_MS) {
+        recoverCount_ = 0;
+        if (!backpressure_.exchange(true, std::memory_order_relaxed)) {
+            backpressureCount_.fetch_add(1, std::memory_order_relaxed);
+            TELEPHONY_LOGW("[slot%{public}d] backpressure on, eventId:%{public}u waited %{public}lld ms", slotId_,
+                eventId, static_cast<long long>(waitMs));
+            TryReport(eventId, waitMs, 0, nowMs);
+        }
+        return;
+    }
+    if (!backpressure_.load(std::memory_order_relaxed) || waitMs >= QUEUE_WATCHDOG_RECOVER_THRESHOLD_MS) {
+        recoverCount_ = 0;
+        return;
+    }
+    if (++recoverCount_ >= QUEUE_WATCHDOG_RECOVER_COUNT) {
+        recoverCount_ = 0;
+        backpressure_.store(false, std::memory_order_relaxed);
+        TELEPHONY_LOGI("[slot%{public}d] backpressure off, shed:%{public}llu", slotId_,
+            static_cast<unsigned long long>(shedCount_.load(std::memory_order_relaxed)));
+    }
+}
+
+void CellularCallQueueWatchdog::TryReport(uint32_t eventId, int64_t waitMs, int64_t runMs, int64_t nowMs)
+{
+    if (lastReportTimeMs_ != 0 && nowMs - lastReportTimeMs_ < QUEUE_WATCHDOG_REPORT_INTERVAL_MS) {
+        return;
+    }
+    lastReportTimeMs_ = nowMs;
+    reportCount_.fetch_add(1, std::memory_order_relaxed);
+    CellularCallHiSysEvent::WriteQueueLatencyFaultEvent(slotId_, static_cast<int32_t>(eventId), waitMs, runMs,
+        static_cast<int64_t>(shedCount_.load(std::memory_order_relaxed)));
+}
+
+bool CellularCallQueueWatchdog::IsBackpressure() const
+{
+    return backpressure_.load(std::memory_order_relaxed);
+}
+
+void CellularCallQueueWatchdog::RecordShed(uint32_t eventId)
+{
+    uint64_t shedCount = shedCount_.fetch_add(1, std::memory_order_relaxed) + 1;
+    TELEPHONY_LOGD("[slot%{public}d] shed eventId:%{public}u total:%{public}llu", slotId_, eventId,
+        static_cast<unsigned long long>(shedCount));
+}
+
+void CellularCallQueueWatchdog::GetState(QueueWatchdogState &state) const
+{
+    state.backpressure = backpressure_.load(std::memory_order_relaxed);
+    state.backpressureCount = backpressureCount_.load(std::memory_order_relaxed);
+    state.shedCount = shedCount_.load(std::memory_order_relaxed);
+    state.slowRunCount = slowRunCount_.load(std::memory_order_relaxed);
+    state.reportCount = reportCount_.load(std::memory_order_relaxed);
+}
+
+void CellularCallQueueWatchdog::GetEventStats(std::vector<QueueWatchdogEventStats> &stats)
+{
+    stats.clear();
+    {
+        std::lock_guard<ffrt::mutex> lock(statsMutex_);
+        for (const auto &it : eventStats_) {
+            stats.push_back(it.second);
+        }
+    }
+    std::sort(stats.begin(), stats.end(), [](const QueueWatchdogEventStats &left,
+        const QueueWatchdogEventStats &right) { return left.maxWaitMs > right.maxWaitMs; });
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_startup_orchestrator.h"
+
+#include <algorithm>
+#include <map>
+
+#include "telephony_errors.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+CellularCallStartupOrchestrator::CellularCallStartupOrchestrator(const std::string &stage) : stage_(stage) {}
+
+int32_t CellularCallStartupOrchestrator::AddPhase(
+    const std::string &name, const Task &task, const std::vector<std::string> &dependencies)
+{
+    if (isRun_ || name.empty() || task == nullptr || FindPhase(name) != nullptr) {
+        TELEPHONY_LOGE("[%{public}s] invalid phase %{public}s", stage_.c_str(), name.c_str());
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    Phase phase;
+    phase.info.stage = stage_;
+    phase.info.name = name;
+    phase.task = task;
+    phase.dependencies = dependencies;
+    phases_.push_back(std::move(phase));
+    return TELEPHONY_SUCCESS;
+}
+
+CellularCallStartupOrchestrator::Phase *CellularCallStartupOrchestrator::FindPhase(const std::string &name)
+{
+    for (auto &phase : phases_) {
+        if (phase.info.name == name) {
+            return &phase;
+        }
+    }
+    return nullptr;
+}
+
+bool CellularCallStartupOrchestrator::SortPhases(std::vector<Phase *> &order)
+{
+    std::map<Phase *, size_t> pendingCount;
+    for (auto &phase : phases_) {
+        phase.dependencyPhases.clear();
+        for (const auto &dependency : phase.dependencies) {
+            Phase *dependencyPhase = FindPhase(dependency);
+            if (dependencyPhase == nullptr || dependencyPhase == &phase) {
+                TELEPHONY_LOGE("[%{public}s] %{public}s depends on invalid phase %{public}s", stage_.c_str(),
+                    phase.info.name.c_str(), dependency.c_str());
+                return false;
+            }
+            phase.dependencyPhases.push_back(dependencyPhase);
+        }
+        pendingCount[&phase] = phase.dependencyPhases.size();
+    }
+    // ffrt resolves a dependence against the tasks submitted before, so a phase is submitted after its dependencies
+    order.clear();
+    while (order.size() < phases_.size()) {
+        size_t sortedCount = order.size();
+        for (auto &phase : phases_) {
+            if (pendingCount[&phase] != 0 || std::find(order.begin(), order.end(), &phase) != order.end()) {
+                continue;
+            }
+            order.push_back(&phase);
+            for (auto &other : phases_) {
+                pendingCount[&other] -= static_cast<size_t>(
+                    std::count(other.dependencyPhases.begin(), other.dependencyPhases.end(), &phase));
+            }
+        }
+        if (order.size() == sortedCount) {
+            TELEPHONY_LOGE("[%{public}s] the phases depend on each other", stage_.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t CellularCallStartupOrchestrator::Run()
+{
+    std::vector<ffrt::dependence> allDeps;
+    int32_t ret = SubmitPhases(allDeps);
+    if (ret != TELEPHONY_SUCCESS) {
+        return ret;
+    }
+    ffrt::wait(allDeps);
+    FinishRun();
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CellularCallStartupOrchestrator::RunAsync(const Task &onDone)
+{
+    std::vector<ffrt::dependence> allDeps;
+    int32_t ret = SubmitPhases(allDeps);
+    if (ret != TELEPHONY_SUCCESS) {
+        return ret;
+    }
+    ffrt::submit([this, onDone]() {
+        FinishRun();
+        if (onDone != nullptr) {
+            onDone();
+        }
+    }, allDeps, {});
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t CellularCallStartupOrchestrator::SubmitPhases(std::vector<ffrt::dependence> &allDeps)
+{
+    if (isRun_) {
+        TELEPHONY_LOGE("[%{public}s] already run", stage_.c_str());
+        return TELEPHONY_ERR_FAIL;
+    }
+    std::vector<Phase *> order;
+    if (!SortPhases(order)) {
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    isRun_ = true;
+    clock_ = CellularCallClock::GetInstance();
+    startMs_ = clock_->NowMs();
+    std::shared_ptr<CellularCallClock> clock = clock_;
+    int64_t startMs = startMs_;
+    for (Phase *phase : order) {
+        std::vector<ffrt::dependence> inDeps;
+        for (Phase *dependencyPhase : phase->dependencyPhases) {
+            inDeps.emplace_back(static_cast<const void *>(dependencyPhase));
+        }
+        std::vector<ffrt::dependence> outDeps = { ffrt::dependence(static_cast<const void *>(phase)) };
+        allDeps.emplace_back(static_cast<const void *>(phase));
+        ffrt::submit([phase, clock, startMs]() {
+            int64_t phaseStartMs = clock->NowMs();
+            phase->task();
+            int64_t phaseEndMs = clock->NowMs();
+            phase->info.startMs = phaseStartMs - startMs;
+            phase->info.costMs = phaseEndMs - phaseStartMs;
+            phase->info.isDone = true;
+        }, inDeps, outDeps);
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+void CellularCallStartupOrchestrator::FinishRun()
+{
+    totalCostMs_ = clock_->NowMs() - startMs_;
+    TELEPHONY_LOGI("[%{public}s] %{public}zu phases done in %{public}lld ms", stage_.c_str(), phases_.size(),
+        static_cast<long long>(totalCostMs_));
+}
+
+void CellularCallStartupOrchestrator::GetPhases(std::vector<StartupPhaseInfo> &phases) const
+{
+    phases.clear();
+    for (const auto &phase : phases_) {
+        phases.push_back(phase.info);
+    }
+    std::stable_sort(phases.begin(), phases.end(),
+        [](const StartupPhaseInfo &left, const StartupPhaseInfo &right) { return left.startMs < right.startMs; });
+}
+
+int64_t CellularCallStartupOrchestrator::GetTotalCostMs() const
+{
+    return totalCostMs_;
+}
+
+const std::string &CellularCallStartupOrchestrator::GetStage() const
+{
+    return stage_;
+}
+} // namespace Telephony
+} // namespace OHOS
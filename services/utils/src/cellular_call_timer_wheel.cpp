@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cellular_call_timer_wheel.h"
+
+#include <algorithm>
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr uint64_t TIMER_WHEEL_SLOT_MASK = TIMER_WHEEL_SLOTS - 1;
+static constexpr uint64_t TIMER_WHEEL_MAX_DELTA = (1ULL << (TIMER_WHEEL_LEVEL_BITS * TIMER_WHEEL_LEVELS)) - 1;
+
+CellularCallTimer::CellularCallTimer(
+    const std::shared_ptr<CellularCallTimerWheel> &wheel, CellularCallClock::TimerId timerId)
+    : wheel_(wheel), timerId_(timerId)
+{}
+
+CellularCallTimer::~CellularCallTimer()
+{
+    Cancel();
+}
+
+CellularCallTimer::CellularCallTimer(CellularCallTimer &&other) noexcept
+    : wheel_(std::move(other.wheel_)), timerId_(other.timerId_)
+{
+    other.timerId_ = 0;
+}
+
+CellularCallTimer &CellularCallTimer::operator=(CellularCallTimer &&other) noexcept
+{
+    if (this != &other) {
+        Cancel();
+        wheel_ = std::move(other.wheel_);
+        timerId_ = other.timerId_;
+        other.timerId_ = 0;
+    }
+    return *this;
+}
+
+bool CellularCallTimer::Cancel()
+{
+    CellularCallClock::TimerId timerId = timerId_;
+    timerId_ = 0;
+    auto wheel = wheel_.lock();
+    if (timerId == 0 || wheel == nullptr) {
+        return false;
+    }
+    return wheel->Cancel(timerId);
+}
+
+CellularCallClock::TimerId CellularCallTimer::GetTimerId() const
+{
+    return timerId_;
+}
+
+CellularCallTimerWheel::CellularCallTimerWheel() : clock_(CellularCallClock::GetInstance()) {}
+
+CellularCallTimerWheel::~CellularCallTimerWheel()
+{
+    if (tickTimerId_ != 0) {
+        clock_->Cancel(tickTimerId_);
+    }
+}
+
+void CellularCallTimerWheel::SetSlotId(int32_t slotId)
+{
+    slotId_ = slotId;
+}
+
+uint64_t CellularCallTimerWheel::GetNowTick()
+{
+    int64_t nowMs = clock_->NowMs();
+    if (startMs_ < 0) {
+        startMs_ = nowMs;
+    }
+    return static_cast<uint64_t>(std::max<int64_t>(nowMs - startMs_, 0) / TIMER_WHEEL_TICK_MS);
+}
+
+CellularCallClock::TimerId CellularCallTimerWheel::Arm(const Task &task, int64_t delayMs)
+{
+    if (task == nullptr) {
+        return 0;
+    }
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    uint64_t nowTick = GetNowTick();
+    if (locations_.empty()) {
+        // every bucket is empty, the wheel may jump to the present without cascading
+        currentTick_ = std::max(currentTick_, nowTick);
+    }
+    // round the deadline up so that a timer never fires early
+    int64_t expireMs = clock_->NowMs() - startMs_ + std::max<int64_t>(delayMs, 0);
+    uint64_t expireTick = static_cast<uint64_t>((expireMs + TIMER_WHEEL_TICK_MS - 1) / TIMER_WHEEL_TICK_MS);
+    expireTick = std::max(expireTick, currentTick_ + 1);
+    Bucket pending;
+    CellularCallClock::TimerId timerId = nextTimerId_++;
+    pending.push_back(TimerNode { timerId, std::min(expireTick, currentTick_ + TIMER_WHEEL_MAX_DELTA), task });
+    Place(pending, pending.begin());
+    stats_.armed++;
+    if (tickTimerId_ != 0 && locations_[timerId].level == 0 && expireTick < tickTick_) {
+        // the pending tick skips ahead further than the new timer
+        clock_->Cancel(tickTimerId_);
+        tickTimerId_ = 0;
+    }
+    ScheduleTickLocked();
+    return timerId;
+}
+
+CellularCallTimer CellularCallTimerWheel::ArmScoped(const Task &task, int64_t delayMs)
+{
+    return CellularCallTimer(shared_from_this(), Arm(task, delayMs));
+}
+
+bool CellularCallTimerWheel::Cancel(CellularCallClock::TimerId timerId)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    auto it = locations_.find(timerId);
+    if (it == locations_.end()) {
+        return false;
+    }
+    buckets_[it->second.level][it->second.index].erase(it->second.node);
+    locations_.erase(it);
+    stats_.cancelled++;
+    return true;
+}
+
+void CellularCallTimerWheel::GetStats(TimerWheelStats &stats)
+{
+    std::lock_guard<ffrt::mutex> lock(mutex_);
+    stats = stats_;
+    stats.pending = locations_.size();
+}
+
+void CellularCallTimerWheel::Place(Bucket &from, Bucket::iterator node)
+{
+    uint64_t expireTick = std::max(node->expireTick, currentTick_);
+    uint64_t delta = expireTick - currentTick_;
+    uint32_t level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1 && delta >= (1ULL << (TIMER_WHEEL_LEVEL_BITS * (level + 1)))) {
+        level++;
+    }
+    uint32_t index = static_cast<uint32_t>((expireTick >> (TIMER_WHEEL_LEVEL_BITS * level)) & TIMER_WHEEL_SLOT_MASK);
+    Bucket &to = buckets_[level][index];
+    // splice keeps the node and its iterator, only the location changes
+    to.splice(to.end(), from, node);
+    locations_[node->timerId] = TimerLocation { level, index, node };
+}
+
+void CellularCallTimerWheel::Cascade(uint32_t level)
+{
+    uint32_t index =
+        static_cast<uint32_t>((currentTick_ >> (TIMER_WHEEL_LEVEL_BITS * level)) & TIMER_WHEEL_SLOT_MASK);
+    Bucket &bucket = buckets_[level][index];
+    while (!bucket.empty()) {
+        Place(bucket, bucket.begin());
+        stats_.cascaded++;
+    }
+    if (index == 0 && level + 1 < TIMER_WHEEL_LEVELS) {
+        Cascade(level + 1);
+    }
+}
+
+void CellularCallTimerWheel::OnTick(uint64_t generation)
+{
+    Bucket expired;
+    {
+        std::lock_guard<ffrt::mutex> lock(mutex_);
+        // a tick replaced after it started still catches up, which is harmless
+        if (generation == tickGeneration_) {
+            tickTimerId_ = 0;
+        }
+        uint64_t nowTick = GetNowTick();
+        while (currentTick_ < nowTick && !locations_.empty()) {
+            currentTick_++;
+            uint64_t index = currentTick_ & TIMER_WHEEL_SLOT_MASK;
+            if (index == 0) {
+                Cascade(1);
+            }
+            Bucket &bucket = buckets_[0][index];
+            for (const auto &node : bucket) {
+                locations_.erase(node.timerId);
+            }
+            stats_.fired += bucket.size();
+            expired.splice(expired.end(), bucket);
+        }
+        currentTick_ = std::max(currentTick_, nowTick);
+        ScheduleTickLocked();
+    }
+    for (auto &node : expired) {
+        node.task();
+    }
+}
+
+void CellularCallTimerWheel::ScheduleTickLocked()
+{
+    if (tickTimerId_ != 0 || locations_.empty()) {
+        return;
+    }
+    // wake up at the next due bucket of the lowest level, or at the next cascade
+    uint64_t nextTick = currentTick_ + 1;
+    while ((nextTick & TIMER_WHEEL_SLOT_MASK) != 0 && buckets_[0][nextTick & TIMER_WHEEL_SLOT_MASK].empty()) {
+        nextTick++;
+    }
+    int64_t delayMs = startMs_ + static_cast<int64_t>(nextTick) * TIMER_WHEEL_TICK_MS - clock_->NowMs();
+    std::weak_ptr<CellularCallTimerWheel> weak = weak_from_this();
+    uint64_t generation = ++tickGeneration_;
+    tickTick_ = nextTick;
+    tickTimerId_ = clock_->PostDelayed([weak, generation]() {
+        auto wheel = weak.lock();
+        if (wheel != nullptr) {
+            wheel->OnTick(generation);
+        }
+    }, std::max<int64_t>(delayMs, 0));
+    if (tickTimerId_ == 0) {
+        TELEPHONY_LOGE("[slot%{public}d] post timer wheel tick fail", slotId_);
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
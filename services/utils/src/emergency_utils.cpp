@@ -18,6 +18,7 @@
 #include "shortnumberinfo.h"
 
 #include "cellular_call_config.h"
+#include "cellular_call_parameter_cache.h"
 #include "mmi_code_utils.h"
 #include "module_service_utils.h"
 
@@ -50,9 +51,9 @@ int32_t EmergencyUtils::IsEmergencyCallProcessing(int32_t slotId, const std::str
     CellularCallConfig config;
     ModuleServiceUtils dependDataObtain;
     std::string countryIsoCode = dependDataObtain.GetNetworkCountryCode(slotId);
-    std::vector<EmergencyCall> eccCallList = config.GetEccCallList(slotId);
+    std::shared_ptr<const std::vector<EmergencyCall>> eccCallList = config.GetEccCallListSnapshot(slotId);
     std::string mcc = config.GetMcc(slotId);
-    if (eccCallList.empty()) {
+    if (eccCallList == nullptr || eccCallList->empty()) {
         TELEPHONY_LOGI("eccCallList is nullptr.");
         std::vector<std::string> eccList = { "110", "120", "119", "122", "112", "000", "911", "08", "118", "999" };
         if (std::any_of(eccList.begin(), eccList.end(), [&formatString](std::string eccNum) {
@@ -69,8 +70,9 @@ int32_t EmergencyUtils::IsEmergencyCallProcessing(int32_t slotId, const std::str
         }
     } else {
         //Determine whether the watch device is DYNAMIC_POWEROFF_MODEM
-        bool isDynamicPoweroffModem = system::GetBoolParameter(DYNAMIC_POWEROFF_MODEM, false);
-        for (auto it = eccCallList.begin(); it != eccCallList.end(); it++) {
+        bool isDynamicPoweroffModem =
+            DelayedSingleton<CellularCallParameterCache>::GetInstance()->GetBool(DYNAMIC_POWEROFF_MODEM, false);
+        for (auto it = eccCallList->begin(); it != eccCallList->end(); it++) {
             if ((mcc == it->mcc || isDynamicPoweroffModem) && formatString == it->eccNum) {
                 TELEPHONY_LOGI("IsEmergencyCallProcessing, Complies with sim data.");
                 return TELEPHONY_ERR_SUCCESS;
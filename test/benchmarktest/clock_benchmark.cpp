@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+
+#include "benchmark/benchmark.h"
+#include "cellular_call_clock.h"
+
+namespace OHOS {
+namespace Telephony {
+// far enough that no timer fires while it is measured
+static constexpr int64_t TIMER_DELAY_MS = 10000;
+
+/**
+ * Cost of arming and cancelling one timer, the pattern of the emergency call radio on wait.
+ */
+static void BM_SteadyClockPostCancel(benchmark::State &state)
+{
+    auto clock = std::make_shared<SteadyCellularCallClock>();
+    for (auto _ : state) {
+        CellularCallClock::TimerId timerId = clock->PostDelayed([]() {}, TIMER_DELAY_MS);
+        benchmark::DoNotOptimize(clock->Cancel(timerId));
+    }
+}
+BENCHMARK(BM_SteadyClockPostCancel);
+
+static void BM_VirtualClockPostCancel(benchmark::State &state)
+{
+    auto clock = std::make_shared<VirtualCellularCallClock>();
+    for (auto _ : state) {
+        CellularCallClock::TimerId timerId = clock->PostDelayed([]() {}, TIMER_DELAY_MS);
+        benchmark::DoNotOptimize(clock->Cancel(timerId));
+    }
+}
+BENCHMARK(BM_VirtualClockPostCancel);
+
+/**
+ * Cost of firing timers through the virtual clock, with range(0) timers pending at once.
+ */
+static void BM_VirtualClockAdvance(benchmark::State &state)
+{
+    auto clock = std::make_shared<VirtualCellularCallClock>();
+    int64_t pending = state.range(0);
+    uint64_t fired = 0;
+    for (auto _ : state) {
+        for (int64_t i = 0; i < pending; i++) {
+            clock->PostDelayed([&fired]() { fired++; }, i + 1);
+        }
+        clock->AdvanceMs(pending);
+    }
+    benchmark::DoNotOptimize(fired);
+    state.SetItemsProcessed(static_cast<int64_t>(fired));
+}
+BENCHMARK(BM_VirtualClockAdvance)->Arg(1)->Arg(64)->Arg(1024);
+} // namespace Telephony
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#define private public
+#include "cellular_call_config.h"
+#undef private
+
+namespace OHOS {
+namespace Telephony {
+static constexpr int32_t BENCHMARK_SLOT_ID = 0;
+static constexpr int32_t BENCHMARK_MAPPING_SIZE = 32;
+static constexpr int32_t BENCHMARK_SMALL_DROP = 16;
+static constexpr int32_t BENCHMARK_MASS_DROP = 512;
+// every other failing call reports a reason the mapping does not list
+static constexpr int32_t BENCHMARK_REASON_SPREAD = BENCHMARK_MAPPING_SIZE * 2;
+
+static void InstallMapping()
+{
+    std::vector<std::string> mapping;
+    for (int32_t i = 0; i < BENCHMARK_MAPPING_SIZE; i++) {
+        mapping.push_back(std::to_string(i * 2) + "|vendor reason " + std::to_string(i) + "|" + std::to_string(i));
+    }
+    CellularCallConfig::UpdateSlotConfig(BENCHMARK_SLOT_ID, [&mapping](SlotConfig &config) {
+        config.imsCallDisconnectResoninfoMapping = mapping;
+        config.disconnectReasonTable = CellularCallConfig::ParseDisconnectReasonMapping(mapping);
+        config.disconnectReasonTableVersion++;
+    });
+}
+
+/**
+ * The mapping tokenized again for every failed call, as before the table.
+ */
+static void BM_DisconnectMappingTokenize(benchmark::State &state)
+{
+    InstallMapping();
+    int32_t drops = static_cast<int32_t>(state.range(0));
+    CellularCallConfig config;
+    for (auto _ : state) {
+        for (int32_t call = 0; call < drops; call++) {
+            int32_t reason = call % BENCHMARK_REASON_SPREAD;
+            std::string message;
+            auto vecReasonInfo = config.GetImsCallDisconnectResoninfoMappingConfig(BENCHMARK_SLOT_ID);
+            for (auto reasonInfo : vecReasonInfo) {
+                char *p = nullptr;
+                char *ptr = strtok_r(const_cast<char *>(reasonInfo.c_str()), "|", &p);
+                if (ptr == nullptr || std::atoi(ptr) != reason) {
+                    continue;
+                }
+                ptr = strtok_r(nullptr, "|", &p);
+                if (ptr == nullptr) {
+                    continue;
+                }
+                message = ptr;
+                ptr = strtok_r(nullptr, "|", &p);
+                reason = ptr != nullptr ? std::atoi(ptr) : reason;
+                break;
+            }
+            benchmark::DoNotOptimize(message.data());
+            benchmark::DoNotOptimize(reason);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * drops);
+}
+BENCHMARK(BM_DisconnectMappingTokenize)->Arg(BENCHMARK_SMALL_DROP)->Arg(BENCHMARK_MASS_DROP);
+
+/**
+ * The same burst of failed calls looked up in the table parsed with the operator config.
+ */
+static void BM_DisconnectMappingLookup(benchmark::State &state)
+{
+    InstallMapping();
+    int32_t drops = static_cast<int32_t>(state.range(0));
+    for (auto _ : state) {
+        for (int32_t call = 0; call < drops; call++) {
+            int32_t reason = call % BENCHMARK_REASON_SPREAD;
+            std::string message;
+            DisconnectReasonMapping mapping;
+            if (CellularCallConfig::GetDisconnectReasonMapping(BENCHMARK_SLOT_ID, reason, mapping)) {
+                message = mapping.message;
+                reason = mapping.hasReason ? mapping.reason : reason;
+            }
+            benchmark::DoNotOptimize(message.data());
+            benchmark::DoNotOptimize(reason);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * drops);
+}
+BENCHMARK(BM_DisconnectMappingLookup)->Arg(BENCHMARK_SMALL_DROP)->Arg(BENCHMARK_MASS_DROP);
+} // namespace Telephony
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "cellular_call_ecc_merger.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * The largest emergency list accepted over IPC, see MAX_ECC_SIZE of the stub.
+ */
+static constexpr int32_t BENCHMARK_MAX_ECC_SIZE = 1000;
+static constexpr int32_t BENCHMARK_SMALL_ECC_SIZE = 16;
+static constexpr const char *BENCHMARK_MCC = "460";
+
+static std::vector<EmergencyCall> BuildEccList(int32_t size, int32_t offset)
+{
+    std::vector<EmergencyCall> eccList;
+    eccList.reserve(size);
+    for (int32_t i = 0; i < size; i++) {
+        EmergencyCall call;
+        call.eccNum = std::to_string(offset + i);
+        call.mcc = BENCHMARK_MCC;
+        call.eccType = EccType::TYPE_CATEGORY;
+        call.simpresent = SimpresentType::TYPE_HAS_CARD;
+        call.abnormalService = AbnormalServiceType::TYPE_ALL;
+        eccList.push_back(call);
+    }
+    return eccList;
+}
+
+/**
+ * The merge replaced by the merger: the concatenation of every source deduplicated with a linear search.
+ */
+static void BM_EccFullMerge(benchmark::State &state)
+{
+    int32_t size = static_cast<int32_t>(state.range(0));
+    // half of the radio numbers are repeated by the other sources
+    std::vector<EmergencyCall> radioList = BuildEccList(size / 2, 0);
+    std::vector<EmergencyCall> defaultList = BuildEccList(size / 4, size / 4);
+    std::vector<EmergencyCall> fakeList = BuildEccList(size / 2, size / 2);
+    for (auto _ : state) {
+        std::vector<EmergencyCall> eccList = radioList;
+        eccList.insert(eccList.end(), defaultList.begin(), defaultList.end());
+        eccList.insert(eccList.end(), fakeList.begin(), fakeList.end());
+        std::vector<EmergencyCall> uniqueList;
+        for (auto call : eccList) {
+            if (std::find(uniqueList.begin(), uniqueList.end(), call) == uniqueList.end()) {
+                uniqueList.push_back(call);
+            }
+        }
+        benchmark::DoNotOptimize(uniqueList.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EccFullMerge)->Arg(BENCHMARK_SMALL_ECC_SIZE)->Arg(BENCHMARK_MAX_ECC_SIZE);
+
+/**
+ * A radio report changing one number, only the radio source is applied and the list rebuilt.
+ */
+static void BM_EccIncrementalMerge(benchmark::State &state)
+{
+    int32_t size = static_cast<int32_t>(state.range(0));
+    std::vector<EmergencyCall> radioLists[] = { BuildEccList(size / 2, 0), BuildEccList(size / 2, 0) };
+    radioLists[1].back().eccNum.append("0");
+    CellularCallEccMerger merger;
+    merger.SetSource(EccMergeSource::DEFAULT, BuildEccList(size / 4, size / 4));
+    merger.SetSource(EccMergeSource::FAKE, BuildEccList(size / 2, size / 2));
+    size_t index = 0;
+    for (auto _ : state) {
+        index ^= 1;
+        merger.SetSource(EccMergeSource::RADIO, radioLists[index]);
+        benchmark::DoNotOptimize(merger.GetMergedList());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EccIncrementalMerge)->Arg(BENCHMARK_SMALL_ECC_SIZE)->Arg(BENCHMARK_MAX_ECC_SIZE);
+
+/**
+ * A repeated report with the same numbers, detected by the hash of the source.
+ */
+static void BM_EccUnchangedMerge(benchmark::State &state)
+{
+    int32_t size = static_cast<int32_t>(state.range(0));
+    std::vector<EmergencyCall> radioList = BuildEccList(size / 2, 0);
+    CellularCallEccMerger merger;
+    merger.SetSource(EccMergeSource::RADIO, radioList);
+    merger.SetSource(EccMergeSource::DEFAULT, BuildEccList(size / 4, size / 4));
+    merger.SetSource(EccMergeSource::FAKE, BuildEccList(size / 2, size / 2));
+    merger.GetMergedList();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(merger.SetSource(EccMergeSource::RADIO, radioList));
+        benchmark::DoNotOptimize(merger.GetMergedList());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EccUnchangedMerge)->Arg(BENCHMARK_SMALL_ECC_SIZE)->Arg(BENCHMARK_MAX_ECC_SIZE);
+} // namespace Telephony
+} // namespace OHOS
+
+BENCHMARK_MAIN();
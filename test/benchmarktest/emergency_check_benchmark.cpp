@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "cellular_call_parameter_cache.h"
+#include "parameters.h"
+#include "tel_ril_call_parcel.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr int32_t BENCHMARK_ECC_SIZE = 16;
+static constexpr const char *BENCHMARK_MCC = "460";
+static constexpr const char *BENCHMARK_DIAL_NUMBER = "999";
+// a key not set on the device, both reads fall back to the default like on a phone
+static constexpr const char *BENCHMARK_DYNAMIC_POWEROFF_MODEM = "const.telephony.dynamic_poweroff_modem";
+
+static std::vector<EmergencyCall> BuildEccList()
+{
+    std::vector<EmergencyCall> eccList;
+    eccList.reserve(BENCHMARK_ECC_SIZE);
+    for (int32_t i = 0; i < BENCHMARK_ECC_SIZE; i++) {
+        EmergencyCall call;
+        call.eccNum = std::to_string(i);
+        call.mcc = BENCHMARK_MCC;
+        eccList.push_back(call);
+    }
+    return eccList;
+}
+
+static bool MatchEccList(const std::vector<EmergencyCall> &eccList, bool isDynamicPoweroffModem)
+{
+    for (const auto &call : eccList) {
+        if ((call.mcc == BENCHMARK_MCC || isDynamicPoweroffModem) && call.eccNum == BENCHMARK_DIAL_NUMBER) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * The emergency check reading the parameter from the parameter service, as before the cache.
+ */
+static void BM_EmergencyCheckDirectRead(benchmark::State &state)
+{
+    std::vector<EmergencyCall> eccList = BuildEccList();
+    for (auto _ : state) {
+        bool isDynamicPoweroffModem = system::GetBoolParameter(BENCHMARK_DYNAMIC_POWEROFF_MODEM, false);
+        benchmark::DoNotOptimize(MatchEccList(eccList, isDynamicPoweroffModem));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EmergencyCheckDirectRead);
+
+/**
+ * The same check reading the parameter from the watched cache.
+ */
+static void BM_EmergencyCheckCachedRead(benchmark::State &state)
+{
+    std::vector<EmergencyCall> eccList = BuildEccList();
+    auto cache = DelayedSingleton<CellularCallParameterCache>::GetInstance();
+    cache->GetBool(BENCHMARK_DYNAMIC_POWEROFF_MODEM, false);
+    for (auto _ : state) {
+        bool isDynamicPoweroffModem = cache->GetBool(BENCHMARK_DYNAMIC_POWEROFF_MODEM, false);
+        benchmark::DoNotOptimize(MatchEccList(eccList, isDynamicPoweroffModem));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EmergencyCheckCachedRead);
+} // namespace Telephony
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <map>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+#define private public
+#include "cellular_call_config.h"
+#undef private
+#include "ffrt.h"
+
+namespace OHOS {
+namespace Telephony {
+static constexpr int32_t BENCHMARK_SLOT_ID = 0;
+static constexpr int32_t READER_THREADS = 4;
+
+/**
+ * Read of the fields checked on every dial, from one snapshot.
+ */
+static void BM_SlotConfigRead(benchmark::State &state)
+{
+    if (state.thread_index == 0) {
+        CellularCallConfig::InitDefaultOperatorConfig();
+    }
+    for (auto _ : state) {
+        std::shared_ptr<const SlotConfig> config = CellularCallConfig::GetSlotConfig(BENCHMARK_SLOT_ID);
+        benchmark::DoNotOptimize(config->volteSupported && config->readyToCall);
+        benchmark::DoNotOptimize(config->domainPreferenceMode);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SlotConfigRead)->Threads(1)->Threads(READER_THREADS);
+
+/**
+ * The same read against a mutex protected map, the layout the snapshots replace.
+ */
+static void BM_LockedMapRead(benchmark::State &state)
+{
+    static ffrt::mutex mutex;
+    static std::map<int32_t, bool> volteSupported = { { BENCHMARK_SLOT_ID, true } };
+    static std::map<int32_t, bool> readyToCall = { { BENCHMARK_SLOT_ID, true } };
+    static std::map<int32_t, int32_t> domainPreferenceMode = { { BENCHMARK_SLOT_ID, 0 } };
+    for (auto _ : state) {
+        std::lock_guard<ffrt::mutex> lock(mutex);
+        benchmark::DoNotOptimize(volteSupported[BENCHMARK_SLOT_ID] && readyToCall[BENCHMARK_SLOT_ID]);
+        benchmark::DoNotOptimize(domainPreferenceMode[BENCHMARK_SLOT_ID]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LockedMapRead)->Threads(1)->Threads(READER_THREADS);
+
+/**
+ * Readers while thread 0 keeps publishing new versions, as during an operator config update.
+ */
+static void BM_SlotConfigReadWhileUpdate(benchmark::State &state)
+{
+    if (state.thread_index == 0) {
+        CellularCallConfig::InitDefaultOperatorConfig();
+    }
+    bool readyToCall = false;
+    for (auto _ : state) {
+        if (state.thread_index == 0) {
+            readyToCall = !readyToCall;
+            CellularCallConfig::UpdateSlotConfig(
+                BENCHMARK_SLOT_ID, [readyToCall](SlotConfig &config) { config.readyToCall = readyToCall; });
+            continue;
+        }
+        std::shared_ptr<const SlotConfig> config = CellularCallConfig::GetSlotConfig(BENCHMARK_SLOT_ID);
+        benchmark::DoNotOptimize(config->volteSupported && config->readyToCall);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SlotConfigReadWhileUpdate)->Threads(READER_THREADS);
+} // namespace Telephony
+} // namespace OHOS
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+#include "cellular_call_handler.h"
+#include "common_event_support.h"
+
+namespace OHOS {
+namespace Telephony {
+// neither id has a handler function, the handler only records the queue wait and drops them
+static constexpr uint32_t FLOOD_EVENT_ID = 0xF000;
+static constexpr uint32_t PROBE_EVENT_ID = 0xF001;
+static constexpr uint64_t FLOOD_MAX_PENDING = 4096;
+static constexpr int32_t FLOOD_BATCH = 64;
+static constexpr int32_t FLOODED_SLOT = 0;
+static constexpr int32_t MEASURED_SLOT = 1;
+
+static std::shared_ptr<CellularCallHandler> CreateSlotHandler(int32_t slotId)
+{
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_OPERATOR_CONFIG_CHANGED);
+    EventFwk::CommonEventSubscribeInfo subscriberInfo(matchingSkills);
+    auto handler =
+        std::make_shared<CellularCallHandler>(subscriberInfo, "CellularCallHandler" + std::to_string(slotId));
+    handler->SetSlotId(slotId);
+    return handler;
+}
+
+static uint64_t GetHandledCount(const std::shared_ptr<CellularCallHandler> &handler)
+{
+    EventLaneWaitStats stats;
+    handler->GetLaneWaitStats(CellularCallEventLane::NORMAL, stats);
+    return stats.count;
+}
+
+/**
+ * Round trip of one event on the measured slot, with or without another thread keeping the queue of
+ * the flooded slot full. Both numbers should stay the same as long as the slots do not share a runner.
+ */
+static void BM_CrossSlotEventLatency(benchmark::State &state)
+{
+    auto flooded = CreateSlotHandler(FLOODED_SLOT);
+    auto measured = CreateSlotHandler(MEASURED_SLOT);
+    std::atomic<bool> flooding { state.range(0) != 0 };
+    std::thread flooder([&flooded, &flooding]() {
+        uint64_t sent = 0;
+        while (flooding.load(std::memory_order_relaxed)) {
+            if (sent - GetHandledCount(flooded) >= FLOOD_MAX_PENDING) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (int32_t i = 0; i < FLOOD_BATCH; i++) {
+                flooded->SendEvent(FLOOD_EVENT_ID, 0, CellularCallHandler::GetEventPriority(FLOOD_EVENT_ID));
+            }
+            sent += FLOOD_BATCH;
+        }
+    });
+    for (auto _ : state) {
+        uint64_t handled = GetHandledCount(measured);
+        measured->SendEvent(PROBE_EVENT_ID, 0, CellularCallHandler::GetEventPriority(PROBE_EVENT_ID));
+        while (GetHandledCount(measured) == handled) {
+            std::this_thread::yield();
+        }
+    }
+    flooding.store(false, std::memory_order_relaxed);
+    flooder.join();
+    flooded->RemoveAllEvents();
+}
+BENCHMARK(BM_CrossSlotEventLatency)->ArgName("flood")->Arg(0)->Arg(1)->UseRealTime();
+} // namespace Telephony
+} // namespace OHOS
+
+BENCHMARK_MAIN();
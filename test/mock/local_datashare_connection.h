@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LOCAL_DATASHARE_CONNECTION_H
+#define LOCAL_DATASHARE_CONNECTION_H
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "cellular_call_datashare_pool.h"
+#include "telephony_errors.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief In memory stand-in of the ecc and settings providers, {Kill} simulates the provider process dying.
+ */
+class LocalDataShareProvider : public std::enable_shared_from_this<LocalDataShareProvider> {
+public:
+    void SetEccRow(const std::string &numeric, const EccNum &eccNum)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        EccNum &row = eccRows_[numeric];
+        row = eccNum;
+        row.numeric = numeric;
+        row.mcc = numeric.substr(0, ECC_MCC_LEN);
+    }
+
+    void SetSetting(const std::string &key, const std::string &value)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        settings_[key] = value;
+    }
+
+    /**
+     * @brief Every connection made before stops answering, the new ones work
+     */
+    void Kill()
+    {
+        generation_++;
+    }
+
+    void SetAvailable(bool isAvailable)
+    {
+        isAvailable_ = isAvailable;
+    }
+
+    CellularCallDataSharePool::Connector GetConnector()
+    {
+        std::weak_ptr<LocalDataShareProvider> weakProvider = shared_from_this();
+        return [weakProvider](const std::string &uri, const std::string &extUri)
+            -> std::shared_ptr<CellularCallDataShareConnection> {
+            auto provider = weakProvider.lock();
+            if (provider == nullptr || !provider->isAvailable_) {
+                return nullptr;
+            }
+            provider->connectCount_++;
+            return std::make_shared<Connection>(provider);
+        };
+    }
+
+    int32_t GetConnectCount() const
+    {
+        return connectCount_;
+    }
+
+    int32_t GetLiveConnectionCount() const
+    {
+        return liveConnectionCount_;
+    }
+
+    int32_t GetEccQueryCount() const
+    {
+        return eccQueryCount_;
+    }
+
+    int32_t GetObserverCount() const
+    {
+        return observerCount_;
+    }
+
+private:
+    static constexpr size_t ECC_MCC_LEN = 3;
+
+    class Connection : public CellularCallDataShareConnection {
+    public:
+        explicit Connection(const std::shared_ptr<LocalDataShareProvider> &provider)
+            : provider_(provider), generation_(provider->generation_)
+        {
+            provider_->liveConnectionCount_++;
+        }
+
+        ~Connection() override
+        {
+            provider_->liveConnectionCount_--;
+        }
+
+        int32_t QueryEccList(const std::string &uriString, const std::vector<std::string> &numerics,
+            const std::vector<std::string> &mccs, std::vector<EccNum> &eccVec) override
+        {
+            if (!IsAlive()) {
+                return TELEPHONY_ERR_LOCAL_PTR_NULL;
+            }
+            provider_->eccQueryCount_++;
+            std::lock_guard<std::mutex> lock(provider_->mutex_);
+            for (const auto &it : provider_->eccRows_) {
+                if (std::find(numerics.begin(), numerics.end(), it.first) != numerics.end() ||
+                    std::find(mccs.begin(), mccs.end(), it.second.mcc) != mccs.end()) {
+                    eccVec.push_back(it.second);
+                }
+            }
+            return TELEPHONY_SUCCESS;
+        }
+
+        int32_t Query(const std::string &uriString, const std::string &key, std::string &value) override
+        {
+            if (!IsAlive()) {
+                return TELEPHONY_ERR_LOCAL_PTR_NULL;
+            }
+            std::lock_guard<std::mutex> lock(provider_->mutex_);
+            auto it = provider_->settings_.find(key);
+            if (it == provider_->settings_.end()) {
+                return TELEPHONY_ERR_DATABASE_READ_FAIL;
+            }
+            value = it->second;
+            return TELEPHONY_SUCCESS;
+        }
+
+        int32_t RegisterObserver(const std::string &uriString,
+            const sptr<AAFwk::IDataAbilityObserver> &observer) override
+        {
+            if (!IsAlive()) {
+                return TELEPHONY_ERR_LOCAL_PTR_NULL;
+            }
+            provider_->observerCount_++;
+            return TELEPHONY_SUCCESS;
+        }
+
+    private:
+        bool IsAlive() const
+        {
+            return generation_ == provider_->generation_;
+        }
+
+        std::shared_ptr<LocalDataShareProvider> provider_;
+        int32_t generation_ = 0;
+    };
+
+    std::mutex mutex_;
+    std::map<std::string, EccNum> eccRows_;
+    std::map<std::string, std::string> settings_;
+    std::atomic<int32_t> generation_ { 0 };
+    std::atomic<bool> isAvailable_ { true };
+    std::atomic<int32_t> connectCount_ { 0 };
+    std::atomic<int32_t> liveConnectionCount_ { 0 };
+    std::atomic<int32_t> eccQueryCount_ { 0 };
+    std::atomic<int32_t> observerCount_ { 0 };
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // LOCAL_DATASHARE_CONNECTION_H
@@ -14,16 +14,21 @@
  */
 
 #include "gtest/gtest.h"
+#include <future>
 #include <random>
 
 #define private public
 #define protected public
 #include "cellular_call_callback.h"
+#include "cellular_call_clock.h"
 #include "cellular_call_handler.h"
+#include "cellular_call_ipc_metrics.h"
 #include "cellular_call_proxy.h"
 #include "cellular_call_register.h"
 #include "cellular_call_service.h"
+#include "cellular_call_startup_orchestrator.h"
 #include "cellular_call_supplement.h"
+#include "cellular_call_timer_wheel.h"
 #include "config_request.h"
 #include "core_service_client.h"
 #include "cs_control.h"
@@ -1393,6 +1398,440 @@ HWTEST_F(Cs2Test, cellular_call_CellularCallConfig_0001, Function | MediumTest |
     EXPECT_EQ(CellularCallConfig.IsReadyToCall(SIM1_SLOTID), TELEPHONY_SUCCESS);
 }
 
+/**
+ * @tc.number   cellular_call_CellularCallCallback_0001
+ * @tc.name     CellularCallCallback dispatches loopback calls to the local service without ipc
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallCallback_0001, Function | MediumTest | Level3)
+{
+    auto service = DelayedSingleton<CellularCallService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    auto state = service->state_;
+    auto context = service->GetSlotContext(SIM1_SLOTID);
+    ASSERT_TRUE(context != nullptr);
+    // without a slot handler the local task runs in place, so its effect is visible on return
+    auto handler = context->handler;
+    context->handler = nullptr;
+    auto csControl = service->GetCsControl(SIM1_SLOTID);
+    service->SetCsControl(SIM1_SLOTID, std::make_shared<CSControl>());
+    CellularCallConfig config;
+    CellularCallCallback cellularCallCallback;
+
+    service->state_ = ServiceRunningState::STATE_RUNNING;
+    config.SetReadyToCall(SIM1_SLOTID, false);
+    cellularCallCallback.SetReadyToCall(SIM1_SLOTID, 0, true);
+    EXPECT_TRUE(config.IsReadyToCall(SIM1_SLOTID));
+
+    // a stopped service is reached through the system ability, which does not exist in the test
+    service->state_ = ServiceRunningState::STATE_STOPPED;
+    config.SetReadyToCall(SIM1_SLOTID, false);
+    cellularCallCallback.SetReadyToCall(SIM1_SLOTID, 0, true);
+    EXPECT_FALSE(config.IsReadyToCall(SIM1_SLOTID));
+
+    service->state_ = state;
+    service->SetCsControl(SIM1_SLOTID, csControl);
+    context->handler = handler;
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallIpcMetrics_0001
+ * @tc.name     CellularCallIpcMetrics keeps count, errors, bytes and latency per interface code
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallIpcMetrics_0001, Function | MediumTest | Level3)
+{
+    CellularCallIpcMetrics &metrics = DelayedRefSingleton<CellularCallIpcMetrics>::GetInstance();
+    metrics.Reset();
+    uint32_t code = static_cast<uint32_t>(CellularCallInterfaceCode::DIAL);
+    metrics.Record(IpcDirection::CALL_MANAGER_INBOUND, code, TELEPHONY_SUCCESS, 100, 50);
+    metrics.Record(IpcDirection::CALL_MANAGER_INBOUND, code, TELEPHONY_ERR_FAIL, 200, 20000);
+    metrics.Record(IpcDirection::DIRECTION_BUTT, code, TELEPHONY_SUCCESS, 100, 50);
+    std::vector<IpcCodeStats> stats;
+    metrics.GetStats(IpcDirection::CALL_MANAGER_INBOUND, stats);
+    auto it = std::find_if(stats.begin(), stats.end(), [code](const IpcCodeStats &item) { return item.code == code; });
+    ASSERT_TRUE(it != stats.end());
+    EXPECT_EQ(it->count, 2u);
+    EXPECT_EQ(it->errors, 1u);
+    EXPECT_EQ(it->bytes, 300u);
+    EXPECT_EQ(it->maxCostUs, 20000u);
+    EXPECT_EQ(it->latency[0], 1u);
+    EXPECT_EQ(it->latency[CellularCallIpcMetrics::GetLatencyBucket(20000)], 1u);
+
+    for (uint32_t i = 0; i <= IPC_METRICS_MAX_CODES; i++) {
+        metrics.Record(IpcDirection::IMS_OUTBOUND, i, TELEPHONY_SUCCESS, 0, 0);
+    }
+    EXPECT_EQ(metrics.GetOverflowCount(IpcDirection::IMS_OUTBOUND), 1u);
+    metrics.GetStats(IpcDirection::IMS_OUTBOUND, stats);
+    EXPECT_EQ(stats.size(), static_cast<size_t>(IPC_METRICS_MAX_CODES));
+    metrics.Reset();
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallHandler_EventLane_0001
+ * @tc.name     CellularCallHandler classifies events into lanes and records their queue wait
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallHandler_EventLane_0001, Function | MediumTest | Level3)
+{
+    EXPECT_EQ(CellularCallHandler::GetEventLane(RadioEvent::RADIO_IMS_CALL_STATUS_INFO),
+        CellularCallEventLane::IMMEDIATE);
+    EXPECT_EQ(CellularCallHandler::GetEventLane(RadioEvent::RADIO_GET_CALL_FORWARD), CellularCallEventLane::NORMAL);
+    // NETWORK_STATE_CHANGED of the handler
+    const uint32_t networkStateChanged = 10006;
+    EXPECT_EQ(CellularCallHandler::GetEventLane(networkStateChanged), CellularCallEventLane::HIGH);
+    EXPECT_EQ(CellularCallHandler::GetEventPriority(networkStateChanged), CellularCallHandler::Priority::HIGH);
+    EXPECT_EQ(CellularCallHandler::GetEventLane(RadioEvent::RADIO_CALL_DATA_USAGE_CHANGED),
+        CellularCallEventLane::IDLE);
+    EXPECT_EQ(CellularCallHandler::GetEventPriority(RadioEvent::RADIO_DIAL), CellularCallHandler::Priority::IMMEDIATE);
+    EXPECT_EQ(
+        CellularCallHandler::GetEventPriority(RadioEvent::RADIO_GET_CALL_WAIT), CellularCallHandler::Priority::LOW);
+
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_OPERATOR_CONFIG_CHANGED);
+    EventFwk::CommonEventSubscribeInfo subscriberInfo(matchingSkills);
+    CellularCallHandler handler { subscriberInfo };
+    auto event = AppExecFwk::InnerEvent::Get(RadioEvent::RADIO_IMS_CALL_STATUS_INFO);
+    event->SetHandleTime(AppExecFwk::InnerEvent::Clock::now() - std::chrono::milliseconds(20));
+    handler.RecordQueueWait(RadioEvent::RADIO_IMS_CALL_STATUS_INFO, event);
+    EventLaneWaitStats stats;
+    handler.GetLaneWaitStats(CellularCallEventLane::IMMEDIATE, stats);
+    EXPECT_EQ(stats.count, 1u);
+    EXPECT_GE(stats.maxWaitMs, 20u);
+    EXPECT_EQ(stats.histogram[0], 0u);
+    handler.GetLaneWaitStats(CellularCallEventLane::IDLE, stats);
+    EXPECT_EQ(stats.count, 0u);
+    handler.GetLaneWaitStats(CellularCallEventLane::LANE_BUTT, stats);
+    EXPECT_EQ(stats.count, 0u);
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallService_SlotContext_0001
+ * @tc.name     CellularCallService keeps the state of every slot in its own context
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallService_SlotContext_0001, Function | MediumTest | Level3)
+{
+    CellularCallService service;
+    EXPECT_EQ(service.GetSlotContext(-1), nullptr);
+    EXPECT_EQ(service.GetSlotContext(SIM_SLOT_COUNT), nullptr);
+    auto csControl = std::make_shared<CSControl>();
+    service.SetCsControl(SIM_SLOT_COUNT, csControl);
+    EXPECT_EQ(service.GetCsControl(SIM_SLOT_COUNT), nullptr);
+    service.SetCsControl(DEFAULT_SIM_SLOT_ID, csControl);
+    EXPECT_EQ(service.GetCsControl(DEFAULT_SIM_SLOT_ID), csControl);
+    EXPECT_EQ(service.GetImsControl(DEFAULT_SIM_SLOT_ID), nullptr);
+    EXPECT_EQ(service.GetHandler(DEFAULT_SIM_SLOT_ID), nullptr);
+    if (SIM_SLOT_COUNT > 1) {
+        EXPECT_NE(service.GetSlotContext(SIM_SLOT_0), service.GetSlotContext(SIM_SLOT_1));
+        EXPECT_EQ(service.GetCsControl(SIM_SLOT_1), nullptr);
+    }
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallQueueWatchdog_0001
+ * @tc.name     CellularCallQueueWatchdog enters and leaves backpressure and sheds idle events
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallQueueWatchdog_0001, Function | MediumTest | Level3)
+{
+    CellularCallQueueWatchdog watchdog;
+    int64_t now = CellularCallClock::GetInstance()->NowMs();
+    watchdog.OnDispatch(RadioEvent::RADIO_DIAL, 0, 0, now);
+    EXPECT_FALSE(watchdog.IsBackpressure());
+    watchdog.OnDispatch(RadioEvent::RADIO_GET_CALL_WAIT, QUEUE_WATCHDOG_WAIT_THRESHOLD_MS, 0, now);
+    EXPECT_TRUE(watchdog.IsBackpressure());
+    for (uint32_t i = 0; i < QUEUE_WATCHDOG_RECOVER_COUNT - 1; i++) {
+        watchdog.OnDispatch(RadioEvent::RADIO_DIAL, 0, 0, now);
+    }
+    EXPECT_TRUE(watchdog.IsBackpressure());
+    watchdog.OnDispatch(RadioEvent::RADIO_DIAL, 0, 0, now);
+    EXPECT_FALSE(watchdog.IsBackpressure());
+    watchdog.OnDispatch(RadioEvent::RADIO_DIAL, 0, QUEUE_WATCHDOG_RUN_THRESHOLD_MS, now);
+    QueueWatchdogState state;
+    watchdog.GetState(state);
+    EXPECT_EQ(state.backpressureCount, 1u);
+    EXPECT_EQ(state.slowRunCount, 1u);
+    EXPECT_EQ(state.reportCount, 1u);
+    std::vector<QueueWatchdogEventStats> stats;
+    watchdog.GetEventStats(stats);
+    ASSERT_EQ(stats.size(), 2u);
+    EXPECT_EQ(stats[0].eventId, static_cast<uint32_t>(RadioEvent::RADIO_GET_CALL_WAIT));
+
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_OPERATOR_CONFIG_CHANGED);
+    EventFwk::CommonEventSubscribeInfo subscriberInfo(matchingSkills);
+    CellularCallHandler handler { subscriberInfo };
+    EXPECT_FALSE(handler.ShouldShedEvent(RadioEvent::RADIO_CALL_DATA_USAGE_CHANGED));
+    handler.GetQueueWatchdog().OnDispatch(RadioEvent::RADIO_GET_CALL_WAIT, QUEUE_WATCHDOG_WAIT_THRESHOLD_MS, 0, now);
+    EXPECT_TRUE(handler.ShouldShedEvent(RadioEvent::RADIO_CALL_DATA_USAGE_CHANGED));
+    EXPECT_FALSE(handler.ShouldShedEvent(RadioEvent::RADIO_IMS_CALL_STATUS_INFO));
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallHandler_TelemetryQueue_0001
+ * @tc.name     CellularCallHandler bounds telemetry events and collapses state like reports per call
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallHandler_TelemetryQueue_0001, Function | MediumTest | Level3)
+{
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_OPERATOR_CONFIG_CHANGED);
+    EventFwk::CommonEventSubscribeInfo subscriberInfo(matchingSkills);
+    auto handler = std::make_shared<CellularCallHandler>(subscriberInfo);
+    EXPECT_NE(handler->SetTelemetryQueueLimit(RadioEvent::RADIO_DIAL, 1), TELEPHONY_SUCCESS);
+    EXPECT_NE(handler->SetTelemetryQueueLimit(RadioEvent::RADIO_CALL_SESSION_EVENT_CHANGED, 0), TELEPHONY_SUCCESS);
+    EXPECT_EQ(handler->SetTelemetryQueueLimit(RadioEvent::RADIO_CALL_SESSION_EVENT_CHANGED, 2), TELEPHONY_SUCCESS);
+    {
+        // keep the reports queued, the drain is triggered by hand below
+        std::lock_guard<ffrt::mutex> lock(handler->telemetryMutex_);
+        for (auto &it : handler->telemetryQueues_) {
+            it.second.drainPosted = true;
+        }
+    }
+    for (int32_t i = 0; i < 3; i++) {
+        auto sessionEvent = std::make_shared<ImsCallSessionEventInfo>();
+        sessionEvent->callIndex = i;
+        EXPECT_TRUE(CellularCallHandler::SendTelemetryEvent(
+            handler, RadioEvent::RADIO_CALL_SESSION_EVENT_CHANGED, sessionEvent->callIndex, sessionEvent));
+        auto dataUsage = std::make_shared<ImsCallDataUsageInfo>();
+        dataUsage->dataUsage = i;
+        EXPECT_TRUE(CellularCallHandler::SendTelemetryEvent(
+            handler, RadioEvent::RADIO_CALL_DATA_USAGE_CHANGED, dataUsage->callIndex, dataUsage));
+    }
+    std::vector<TelemetryQueueStats> stats;
+    handler->GetTelemetryQueueStats(stats);
+    for (const auto &item : stats) {
+        if (item.eventId == RadioEvent::RADIO_CALL_SESSION_EVENT_CHANGED) {
+            EXPECT_EQ(item.pending, 2u);
+            EXPECT_EQ(item.dropped, 1u);
+        } else if (item.eventId == RadioEvent::RADIO_CALL_DATA_USAGE_CHANGED) {
+            EXPECT_EQ(item.pending, 1u);
+            EXPECT_EQ(item.collapsed, 2u);
+        }
+    }
+    auto drainEvent = AppExecFwk::InnerEvent::Get(
+        handler->TELEMETRY_DRAIN_ID, static_cast<int64_t>(RadioEvent::RADIO_CALL_SESSION_EVENT_CHANGED));
+    handler->HandleTelemetryDrain(drainEvent);
+    handler->GetTelemetryQueueStats(stats);
+    for (const auto &item : stats) {
+        if (item.eventId == RadioEvent::RADIO_CALL_SESSION_EVENT_CHANGED) {
+            EXPECT_EQ(item.pending, 0u);
+        }
+    }
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallHandler_TelemetryQueue_0002
+ * @tc.name     CellularCallHandler keeps the latest report of every call under backpressure
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallHandler_TelemetryQueue_0002, Function | MediumTest | Level3)
+{
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_OPERATOR_CONFIG_CHANGED);
+    EventFwk::CommonEventSubscribeInfo subscriberInfo(matchingSkills);
+    auto handler = std::make_shared<CellularCallHandler>(subscriberInfo);
+    {
+        std::lock_guard<ffrt::mutex> lock(handler->telemetryMutex_);
+        for (auto &it : handler->telemetryQueues_) {
+            it.second.drainPosted = true;
+        }
+    }
+    handler->GetQueueWatchdog().backpressure_.store(true);
+    for (int32_t i = 0; i < 4; i++) {
+        auto peerDimensions = std::make_shared<ImsCallPeerDimensionsInfo>();
+        peerDimensions->callIndex = i % 2;
+        peerDimensions->width = i;
+        EXPECT_TRUE(CellularCallHandler::SendTelemetryEvent(
+            handler, RadioEvent::RADIO_CALL_PEER_DIMENSIONS_CHANGED, peerDimensions->callIndex, peerDimensions));
+    }
+    std::vector<TelemetryQueueStats> stats;
+    handler->GetTelemetryQueueStats(stats);
+    for (const auto &item : stats) {
+        if (item.eventId == RadioEvent::RADIO_CALL_PEER_DIMENSIONS_CHANGED) {
+            EXPECT_EQ(item.pending, 2u);
+            EXPECT_EQ(item.collapsed, 2u);
+            EXPECT_EQ(item.dropped, 0u);
+        }
+    }
+    QueueWatchdogState state;
+    handler->GetQueueWatchdog().GetState(state);
+    EXPECT_EQ(state.shedCount, 0u);
+}
+
+/**
+ * @tc.number   cellular_call_VirtualCellularCallClock_0001
+ * @tc.name     VirtualCellularCallClock runs delayed work in deadline order only when the time moves
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_VirtualCellularCallClock_0001, Function | MediumTest | Level3)
+{
+    auto clock = std::make_shared<VirtualCellularCallClock>();
+    std::vector<int32_t> order;
+    EXPECT_EQ(clock->PostDelayed(nullptr, 0), 0u);
+    clock->PostDelayed([&order]() { order.push_back(2); }, 200);
+    clock->PostDelayed([&order]() { order.push_back(1); }, 100);
+    CellularCallClock::TimerId cancelled = clock->PostDelayed([&order]() { order.push_back(3); }, 150);
+    EXPECT_EQ(clock->GetPendingCount(), 3u);
+    EXPECT_TRUE(clock->Cancel(cancelled));
+    EXPECT_FALSE(clock->Cancel(cancelled));
+    clock->AdvanceMs(99);
+    EXPECT_TRUE(order.empty());
+    clock->AdvanceMs(1);
+    ASSERT_EQ(order.size(), 1u);
+    clock->SleepMs(100);
+    ASSERT_EQ(order.size(), 2u);
+    EXPECT_EQ(order[1], 2);
+    EXPECT_EQ(clock->NowMs(), 200);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool isReady = false;
+    std::unique_lock<std::mutex> lock(mutex);
+    EXPECT_FALSE(clock->WaitFor(lock, cv, 1000, [&isReady]() { return isReady; }));
+    EXPECT_EQ(clock->NowMs(), 1200);
+    clock->PostDelayed([&mutex, &isReady]() {
+        std::lock_guard<std::mutex> readyLock(mutex);
+        isReady = true;
+    }, 300);
+    EXPECT_TRUE(clock->WaitFor(lock, cv, 1000, [&isReady]() { return isReady; }));
+    EXPECT_EQ(clock->NowMs(), 1500);
+
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_OPERATOR_CONFIG_CHANGED);
+    EventFwk::CommonEventSubscribeInfo subscriberInfo(matchingSkills);
+    auto handler = std::make_shared<CellularCallHandler>(subscriberInfo);
+    CellularCallClock::SetInstance(clock);
+    EXPECT_TRUE(CellularCallClock::GetInstance()->SendEvent(
+        handler, EVENT_EXECUTE_POST_DIAL, std::make_shared<PostDialData>(), 500));
+    EXPECT_FALSE(handler->HasInnerEvent(EVENT_EXECUTE_POST_DIAL));
+    EXPECT_EQ(clock->GetPendingCount(), 1u);
+    handler->RemoveAllEvents();
+    handler = nullptr;
+    clock->AdvanceMs(500);
+    EXPECT_EQ(clock->GetPendingCount(), 0u);
+    CellularCallClock::SetInstance(nullptr);
+    EXPECT_NE(CellularCallClock::GetInstance(), clock);
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallTimerWheel_0001
+ * @tc.name     CellularCallTimerWheel fires on time across levels and cancels with the owner
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallTimerWheel_0001, Function | MediumTest | Level3)
+{
+    auto clock = std::make_shared<VirtualCellularCallClock>();
+    CellularCallClock::SetInstance(clock);
+    auto wheel = std::make_shared<CellularCallTimerWheel>();
+    std::vector<int64_t> firedMs;
+    auto record = [&firedMs, clock]() { firedMs.push_back(clock->NowMs()); };
+    EXPECT_EQ(wheel->Arm(nullptr, 0), 0u);
+    wheel->Arm(record, 3000);
+    CellularCallClock::TimerId cancelled = wheel->Arm(record, 1000);
+    {
+        CellularCallTimer scoped = wheel->ArmScoped(record, 500);
+        EXPECT_NE(scoped.GetTimerId(), 0u);
+    }
+    wheel->Arm(record, 60 * 1000);
+    EXPECT_TRUE(wheel->Cancel(cancelled));
+    EXPECT_FALSE(wheel->Cancel(cancelled));
+    clock->AdvanceMs(2999);
+    EXPECT_TRUE(firedMs.empty());
+    clock->AdvanceMs(1);
+    ASSERT_EQ(firedMs.size(), 1u);
+    EXPECT_EQ(firedMs[0], 3000);
+    clock->AdvanceMs(60 * 1000);
+    ASSERT_EQ(firedMs.size(), 2u);
+    EXPECT_GE(firedMs[1], 60 * 1000);
+    EXPECT_LT(firedMs[1], 60 * 1000 + TIMER_WHEEL_TICK_MS);
+    TimerWheelStats stats;
+    wheel->GetStats(stats);
+    EXPECT_EQ(stats.pending, 0u);
+    EXPECT_EQ(stats.fired, 2u);
+    EXPECT_EQ(stats.cancelled, 2u);
+    EXPECT_EQ(clock->GetPendingCount(), 0u);
+
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_OPERATOR_CONFIG_CHANGED);
+    EventFwk::CommonEventSubscribeInfo subscriberInfo(matchingSkills);
+    auto handler = std::make_shared<CellularCallHandler>(subscriberInfo);
+    int32_t index = 0;
+    handler->RequestSsRequestCommandIndex(index);
+    handler->SaveSsRequestCommand(std::make_shared<SsRequestCommand>(), index);
+    SsRequestCommand ss;
+    EXPECT_EQ(handler->GetSsRequestCommand(index, ss), TELEPHONY_SUCCESS);
+    clock->AdvanceMs(60 * 1000);
+    EXPECT_NE(handler->GetSsRequestCommand(index, ss), TELEPHONY_SUCCESS);
+    CellularCallClock::SetInstance(nullptr);
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallHandler_BroadcastDebounce_0001
+ * @tc.name     CellularCallHandler handles the first broadcast at once and coalesces the rest of a burst
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallHandler_BroadcastDebounce_0001, Function | MediumTest | Level3)
+{
+    auto clock = std::make_shared<VirtualCellularCallClock>();
+    CellularCallClock::SetInstance(clock);
+    EventFwk::MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(EventFwk::CommonEventSupport::COMMON_EVENT_NETWORK_STATE_CHANGED);
+    EventFwk::CommonEventSubscribeInfo subscriberInfo(matchingSkills);
+    auto handler = std::make_shared<CellularCallHandler>(subscriberInfo);
+    EventFwk::CommonEventData eventData;
+    AAFwk::Want want;
+    want.SetAction(EventFwk::CommonEventSupport::COMMON_EVENT_NETWORK_STATE_CHANGED);
+    eventData.SetWant(want);
+    for (int32_t i = 0; i < 5; i++) {
+        handler->OnReceiveEvent(eventData);
+        clock->AdvanceMs(100);
+    }
+    std::vector<BroadcastDebounceStats> stats;
+    handler->GetBroadcastDebounceStats(stats);
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].received, 5u);
+    EXPECT_EQ(stats[0].leading, 1u);
+    EXPECT_EQ(stats[0].coalesced, 3u);
+    EXPECT_EQ(stats[0].trailing, 0u);
+    clock->AdvanceMs(BROADCAST_SETTLE_MS);
+    handler->GetBroadcastDebounceStats(stats);
+    EXPECT_EQ(stats[0].trailing, 1u);
+
+    // a burst longer than the max defer is still handled on time
+    for (int64_t elapsedMs = 0; elapsedMs <= BROADCAST_MAX_DEFER_MS; elapsedMs += 100) {
+        handler->OnReceiveEvent(eventData);
+        clock->AdvanceMs(100);
+    }
+    handler->GetBroadcastDebounceStats(stats);
+    EXPECT_EQ(stats[0].trailing, 2u);
+    handler->RemoveAllEvents();
+    CellularCallClock::SetInstance(nullptr);
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallConfig_OperatorConfigFingerprint_0001
+ * @tc.name     Equal operator configs share a fingerprint and an applied one is recognized
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallConfig_OperatorConfigFingerprint_0001, Function | MediumTest | Level3)
+{
+    OperatorConfig poc;
+    poc.boolValue[KEY_VOLTE_SUPPORTED_BOOL] = true;
+    poc.stringArrayValue[KEY_EMERGENCY_CALL_STRING_ARRAY] = { "110", "120" };
+    OperatorConfig same = poc;
+    uint64_t fingerprint = CellularCallConfig::GetOperatorConfigFingerprint(poc);
+    EXPECT_EQ(fingerprint, CellularCallConfig::GetOperatorConfigFingerprint(same));
+    same.stringArrayValue[KEY_EMERGENCY_CALL_STRING_ARRAY] = { "110120" };
+    EXPECT_NE(fingerprint, CellularCallConfig::GetOperatorConfigFingerprint(same));
+
+    CellularCallConfig::RecordOperatorConfigApplied(SIM1_SLOTID, fingerprint, 1);
+    EXPECT_TRUE(CellularCallConfig::IsOperatorConfigApplied(SIM1_SLOTID, fingerprint, 1));
+    EXPECT_FALSE(CellularCallConfig::IsOperatorConfigApplied(SIM1_SLOTID, fingerprint, 0));
+    EXPECT_FALSE(CellularCallConfig::IsOperatorConfigApplied(SIM2_SLOTID, fingerprint, 1));
+}
+
 /**
  * @tc.number   EncapsulationCallReportInfo_0001
  * @tc.name     CsControl
@@ -1422,5 +1861,109 @@ HWTEST_F(Cs2Test, EncapsulationCallReportInfo_0002, Function | MediumTest | Leve
     CallReportInfo reportInfo = csControl->EncapsulationCallReportInfo(SIM1_SLOTID, callInfo);
     EXPECT_EQ("aaa", reportInfo.name);
 }
+
+/**
+ * @tc.number   cellular_call_CellularCallService_CoreServiceReady_0001
+ * @tc.name     RegisterHandler never sleeps and the registration to core service is done only once
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallService_CoreServiceReady_0001, Function | MediumTest | Level3)
+{
+    auto clock = std::make_shared<VirtualCellularCallClock>();
+    CellularCallClock::SetInstance(clock);
+    CellularCallService service;
+    service.bindTime_ = 1000;
+    EXPECT_EQ(service.GetSpendTime(), "0");
+    service.OnCoreServiceReady();
+    std::string readyTime = service.GetCoreServiceReadyTime();
+    EXPECT_NE(readyTime, "0");
+    service.OnCoreServiceReady();
+    EXPECT_EQ(service.GetCoreServiceReadyTime(), readyTime);
+
+    bool isInitFinished = CoreManagerInner::GetInstance().IsInitFinished();
+    if (!isInitFinished) {
+        service.RegisterHandler();
+        EXPECT_FALSE(service.isCoreServiceRegistered_.load());
+        EXPECT_EQ(service.coreServiceRetryCount_, 1u);
+    }
+    EXPECT_EQ(clock->NowMs(), 0);
+    service.isCoreServiceRegistered_ = true;
+    uint32_t retryCount = service.coreServiceRetryCount_;
+    service.RegisterHandler();
+    EXPECT_EQ(service.coreServiceRetryCount_, retryCount);
+    service.endTime_ = 1500;
+    EXPECT_EQ(service.GetSpendTime(), "500");
+    CellularCallClock::SetInstance(nullptr);
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallStartupOrchestrator_0001
+ * @tc.name     CellularCallStartupOrchestrator runs a phase only after its dependencies and rejects invalid graphs
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallStartupOrchestrator_0001, Function | MediumTest | Level3)
+{
+    std::atomic<int32_t> doneMask { 0 };
+    std::atomic<int32_t> maskSeenByLast { -1 };
+    CellularCallStartupOrchestrator orchestrator("Test");
+    EXPECT_EQ(orchestrator.AddPhase("Last", [&doneMask, &maskSeenByLast]() {
+        maskSeenByLast = doneMask.load();
+    }, { "First", "Second" }), TELEPHONY_SUCCESS);
+    EXPECT_EQ(orchestrator.AddPhase("First", [&doneMask]() { doneMask |= 1; }), TELEPHONY_SUCCESS);
+    EXPECT_EQ(orchestrator.AddPhase("Second", [&doneMask]() { doneMask |= 2; }), TELEPHONY_SUCCESS);
+    EXPECT_NE(orchestrator.AddPhase("First", []() {}), TELEPHONY_SUCCESS);
+    EXPECT_NE(orchestrator.AddPhase("Empty", nullptr), TELEPHONY_SUCCESS);
+    EXPECT_EQ(orchestrator.Run(), TELEPHONY_SUCCESS);
+    EXPECT_EQ(maskSeenByLast.load(), 3);
+    EXPECT_NE(orchestrator.Run(), TELEPHONY_SUCCESS);
+    std::vector<StartupPhaseInfo> phases;
+    orchestrator.GetPhases(phases);
+    ASSERT_EQ(phases.size(), 3u);
+    for (const auto &phase : phases) {
+        EXPECT_TRUE(phase.isDone);
+        EXPECT_EQ(phase.stage, "Test");
+        EXPECT_GE(phase.costMs, 0);
+    }
+    EXPECT_EQ(phases.back().name, "Last");
+
+    bool isRun = false;
+    CellularCallStartupOrchestrator cycle("Cycle");
+    cycle.AddPhase("A", [&isRun]() { isRun = true; }, { "B" });
+    cycle.AddPhase("B", [&isRun]() { isRun = true; }, { "A" });
+    EXPECT_EQ(cycle.Run(), TELEPHONY_ERR_ARGUMENT_INVALID);
+    CellularCallStartupOrchestrator unknown("Unknown");
+    unknown.AddPhase("A", [&isRun]() { isRun = true; }, { "Missing" });
+    EXPECT_EQ(unknown.Run(), TELEPHONY_ERR_ARGUMENT_INVALID);
+    EXPECT_FALSE(isRun);
+}
+
+/**
+ * @tc.number   cellular_call_CellularCallStartupOrchestrator_0002
+ * @tc.name     CellularCallStartupOrchestrator runs the done callback without the caller waiting, after every phase
+ * @tc.desc     Function test
+ */
+HWTEST_F(Cs2Test, cellular_call_CellularCallStartupOrchestrator_0002, Function | MediumTest | Level3)
+{
+    constexpr int64_t waitDoneSeconds = 5;
+    std::atomic<int32_t> doneMask { 0 };
+    auto orchestrator = std::make_shared<CellularCallStartupOrchestrator>("Async");
+    orchestrator->AddPhase("First", [&doneMask]() { doneMask |= 1; });
+    orchestrator->AddPhase("Second", [&doneMask]() { doneMask |= 2; }, { "First" });
+    std::promise<int32_t> maskSeenByDone;
+    std::future<int32_t> future = maskSeenByDone.get_future();
+    EXPECT_EQ(orchestrator->RunAsync([orchestrator, &doneMask, &maskSeenByDone]() {
+        maskSeenByDone.set_value(doneMask.load());
+    }), TELEPHONY_SUCCESS);
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(waitDoneSeconds)), std::future_status::ready);
+    EXPECT_EQ(future.get(), 3);
+    EXPECT_NE(orchestrator->RunAsync(nullptr), TELEPHONY_SUCCESS);
+
+    bool isDone = false;
+    auto cycle = std::make_shared<CellularCallStartupOrchestrator>("Cycle");
+    cycle->AddPhase("A", []() {}, { "B" });
+    cycle->AddPhase("B", []() {}, { "A" });
+    EXPECT_EQ(cycle->RunAsync([&isDone]() { isDone = true; }), TELEPHONY_ERR_ARGUMENT_INVALID);
+    EXPECT_FALSE(isDone);
+}
 } // namespace Telephony
 } // namespace OHOS
@@ -15,6 +15,8 @@
 
 #define private public
 #define protected public
+#include <unistd.h>
+
 #include "core_manager_inner.h"
 #include "cellular_call_config.h"
 #include "cellular_call_handler.h"
@@ -27,6 +29,7 @@
 #include "ims_call_client.h"
 #include "ims_control.h"
 #include "ims_error.h"
+#include "ims_event_channel.h"
 #include "securec.h"
 #include "call_manager_errors.h"
 #include "cellular_call_interface.h"
@@ -591,6 +594,37 @@ HWTEST_F(Ims2Test, cellular_call_ImsControl_0003, Function | MediumTest | Level3
     ASSERT_TRUE(imsControl->isPendingEmcFlag());
     imsControl->SkipWaitForRadioOn();
 }
+
+/**
+ * @tc.number   cellular_call_ImsControl_0004
+ * @tc.name     Test the pending emergency call of a slot without handler
+ * @tc.desc     Function test
+ */
+HWTEST_F(Ims2Test, cellular_call_ImsControl_0004, Function | MediumTest | Level3)
+{
+    auto clock = std::make_shared<VirtualCellularCallClock>();
+    CellularCallClock::SetInstance(clock);
+    auto imsControl = std::make_shared<IMSControl>();
+    CellularCallInfo callInfo;
+    EXPECT_EQ(InitCellularCallInfo(SIM1_SLOTID, PHONE_NUMBER, callInfo), TELEPHONY_SUCCESS);
+    callInfo.slotId = INVALID_SLOTID;
+    EXPECT_EQ(imsControl->SavePendingEmcCallInfo(callInfo), TELEPHONY_SUCCESS);
+    EXPECT_TRUE(imsControl->isPendingEmcFlag());
+    ASSERT_NE(imsControl->waitForRadioOnWheel_, nullptr);
+    TimerWheelStats stats;
+    imsControl->waitForRadioOnWheel_->GetStats(stats);
+    EXPECT_EQ(stats.pending, 1u);
+    imsControl->SkipWaitForRadioOn();
+    imsControl->waitForRadioOnWheel_->GetStats(stats);
+    EXPECT_EQ(stats.pending, 0u);
+    EXPECT_EQ(stats.cancelled, 1u);
+
+    EXPECT_EQ(imsControl->SavePendingEmcCallInfo(callInfo), TELEPHONY_SUCCESS);
+    constexpr int64_t waitForRadioOnMs = 10000;
+    clock->AdvanceMs(waitForRadioOnMs);
+    EXPECT_FALSE(imsControl->isPendingEmcFlag());
+    CellularCallClock::SetInstance(nullptr);
+}
 #endif
 /**
  * @tc.number   cellular_call_CellularCallConnectionIMS_0001
@@ -982,6 +1016,185 @@ HWTEST_F(Ims2Test, cellular_call_ImsCallClient_0001, Function | MediumTest | Lev
     EXPECT_TRUE(listen != nullptr);
 }
 
+/**
+ * @tc.number   cellular_call_ImsCallClient_0002
+ * @tc.name     test ImsCallClient fails fast while backing off and connects once the backoff passed
+ * @tc.desc     Function test
+ */
+HWTEST_F(Ims2Test, cellular_call_ImsCallClient_0002, Function | MediumTest | Level3)
+{
+    auto imsCallClient = DelayedSingleton<ImsCallClient>::GetInstance();
+    imsCallClient->UnInit();
+    imsCallClient->connectState_ = ImsConnectState::DEAD;
+    imsCallClient->nextRetryTime_ = INT64_MAX;
+    uint32_t attempts = imsCallClient->connectAttempts_;
+    EXPECT_EQ(imsCallClient->GetImsCallProxy(), nullptr);
+    EXPECT_EQ(imsCallClient->connectAttempts_.load(), attempts);
+    EXPECT_EQ(imsCallClient->GetConnectState(), ImsConnectState::DEAD);
+    EXPECT_EQ(imsCallClient->Dial(ImsCallInfo(), CLIRMode::DEFAULT), TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL);
+
+    imsCallClient->ResetBackoff();
+    imsCallClient->GetImsCallProxy();
+    EXPECT_EQ(imsCallClient->connectAttempts_.load(), attempts + 1);
+    EXPECT_NE(imsCallClient->GetConnectState(), ImsConnectState::CONNECTING);
+
+    ImsConnectionStats stats;
+    imsCallClient->GetConnectionStats(stats);
+    EXPECT_EQ(stats.connectAttempts, attempts + 1);
+    imsCallClient->UnInit();
+    EXPECT_EQ(imsCallClient->GetConnectState(), ImsConnectState::DISCONNECTED);
+}
+
+/**
+ * @tc.number   cellular_call_ImsCallClient_0003
+ * @tc.name     test the reconnect backoff of ImsCallClient follows the cellular call clock
+ * @tc.desc     Function test
+ */
+HWTEST_F(Ims2Test, cellular_call_ImsCallClient_0003, Function | MediumTest | Level3)
+{
+    auto clock = std::make_shared<VirtualCellularCallClock>();
+    CellularCallClock::SetInstance(clock);
+    auto imsCallClient = DelayedSingleton<ImsCallClient>::GetInstance();
+    imsCallClient->UnInit();
+    imsCallClient->ResetBackoff();
+    imsCallClient->connectState_ = ImsConnectState::CONNECTING;
+    imsCallClient->OnConnectFailed();
+    EXPECT_EQ(imsCallClient->GetConnectState(), ImsConnectState::DISCONNECTED);
+    EXPECT_FALSE(imsCallClient->TryEnterConnecting());
+    ImsConnectionStats stats;
+    imsCallClient->GetConnectionStats(stats);
+    EXPECT_GT(stats.nextRetryDelayMs, 0);
+
+    clock->AdvanceMs(stats.nextRetryDelayMs);
+    EXPECT_TRUE(imsCallClient->TryEnterConnecting());
+    imsCallClient->connectState_ = ImsConnectState::DISCONNECTED;
+    imsCallClient->disconnectTime_ = 0;
+    imsCallClient->ResetBackoff();
+    CellularCallClock::SetInstance(nullptr);
+}
+
+/**
+ * @tc.number   cellular_call_ImsCallClient_ImsCapabilityDiff_0001
+ * @tc.name     test only the changed ims capabilities are sent, until the service reconnects
+ * @tc.desc     Function test
+ */
+HWTEST_F(Ims2Test, cellular_call_ImsCallClient_ImsCapabilityDiff_0001, Function | MediumTest | Level3)
+{
+    auto imsCallClient = DelayedSingleton<ImsCallClient>::GetInstance();
+    imsCallClient->ClearPushedImsCapabilities();
+    ImsCapability volte;
+    volte.imsCapabilityType = ImsCapabilityType::CAPABILITY_TYPE_VOICE;
+    volte.imsRadioTech = ImsRegTech::IMS_REG_TECH_LTE;
+    volte.enable = true;
+    ImsCapability ut;
+    ut.imsCapabilityType = ImsCapabilityType::CAPABILITY_TYPE_UT;
+    ut.imsRadioTech = ImsRegTech::IMS_REG_TECH_LTE;
+    ImsCapabilityList list;
+    list.imsCapabilities = { volte, ut };
+    ImsCapabilityList changedList;
+    imsCallClient->GetChangedImsCapabilities(SIM1_SLOTID, list, changedList);
+    EXPECT_EQ(changedList.imsCapabilities.size(), 2u);
+    imsCallClient->RecordPushedImsCapabilities(SIM1_SLOTID, changedList);
+    imsCallClient->GetChangedImsCapabilities(SIM1_SLOTID, list, changedList);
+    EXPECT_TRUE(changedList.imsCapabilities.empty());
+    imsCallClient->GetChangedImsCapabilities(SIM2_SLOTID, list, changedList);
+    EXPECT_EQ(changedList.imsCapabilities.size(), 2u);
+
+    list.imsCapabilities[1].enable = true;
+    imsCallClient->GetChangedImsCapabilities(SIM1_SLOTID, list, changedList);
+    ASSERT_EQ(changedList.imsCapabilities.size(), 1u);
+    EXPECT_EQ(changedList.imsCapabilities[0].imsCapabilityType, ImsCapabilityType::CAPABILITY_TYPE_UT);
+    imsCallClient->ClearPushedImsCapabilities();
+    imsCallClient->GetChangedImsCapabilities(SIM1_SLOTID, list, changedList);
+    EXPECT_EQ(changedList.imsCapabilities.size(), 2u);
+}
+
+/**
+ * @tc.number   cellular_call_ImsCallClient_ImsCapabilityDiff_0002
+ * @tc.name     test pushes of ims capabilities overlapping in the ipc record nothing
+ * @tc.desc     Function test
+ */
+HWTEST_F(Ims2Test, cellular_call_ImsCallClient_ImsCapabilityDiff_0002, Function | MediumTest | Level3)
+{
+    auto imsCallClient = DelayedSingleton<ImsCallClient>::GetInstance();
+    imsCallClient->ClearPushedImsCapabilities();
+    ImsCapability volte;
+    volte.imsCapabilityType = ImsCapabilityType::CAPABILITY_TYPE_VOICE;
+    volte.imsRadioTech = ImsRegTech::IMS_REG_TECH_LTE;
+    volte.enable = true;
+    ImsCapabilityList enableList;
+    enableList.imsCapabilities = { volte };
+    ImsCapabilityList disableList = enableList;
+    disableList.imsCapabilities[0].enable = false;
+    ImsCapabilityList changedList;
+
+    auto enableTicket = imsCallClient->StartImsCapabilityPush(SIM1_SLOTID, enableList);
+    imsCallClient->GetChangedImsCapabilities(SIM1_SLOTID, disableList, changedList);
+    EXPECT_EQ(changedList.imsCapabilities.size(), 1u);
+    auto disableTicket = imsCallClient->StartImsCapabilityPush(SIM1_SLOTID, disableList);
+    imsCallClient->FinishImsCapabilityPush(SIM1_SLOTID, enableTicket, enableList, true);
+    imsCallClient->FinishImsCapabilityPush(SIM1_SLOTID, disableTicket, disableList, true);
+    imsCallClient->GetChangedImsCapabilities(SIM1_SLOTID, disableList, changedList);
+    EXPECT_EQ(changedList.imsCapabilities.size(), 1u);
+
+    auto ticket = imsCallClient->StartImsCapabilityPush(SIM1_SLOTID, disableList);
+    imsCallClient->FinishImsCapabilityPush(SIM1_SLOTID, ticket, disableList, true);
+    imsCallClient->GetChangedImsCapabilities(SIM1_SLOTID, disableList, changedList);
+    EXPECT_TRUE(changedList.imsCapabilities.empty());
+
+    ticket = imsCallClient->StartImsCapabilityPush(SIM1_SLOTID, enableList);
+    imsCallClient->ClearPushedImsCapabilities();
+    imsCallClient->FinishImsCapabilityPush(SIM1_SLOTID, ticket, enableList, true);
+    imsCallClient->GetChangedImsCapabilities(SIM1_SLOTID, enableList, changedList);
+    EXPECT_EQ(changedList.imsCapabilities.size(), 1u);
+    imsCallClient->ClearPushedImsCapabilities();
+}
+
+/**
+ * @tc.number   cellular_call_ImsEventChannel_0001
+ * @tc.name     test ImsEventChannel delivers events in order and drops them once the ring is full
+ * @tc.desc     Function test
+ */
+HWTEST_F(Ims2Test, cellular_call_ImsEventChannel_0001, Function | MediumTest | Level3)
+{
+    EXPECT_EQ(ImsEventChannel::Create(0), nullptr);
+    EXPECT_EQ(ImsEventChannel::Create(3), nullptr);
+    uint32_t capacity = 4;
+    auto consumer = ImsEventChannel::Create(capacity);
+    ASSERT_NE(consumer, nullptr);
+    sptr<Ashmem> ashmem = consumer->GetAshmem();
+    sptr<Ashmem> producerAshmem = new Ashmem(dup(ashmem->GetAshmemFd()), ashmem->GetAshmemSize());
+    auto producer = ImsEventChannel::Attach(producerAshmem, dup(consumer->GetEventFd()));
+    ASSERT_NE(producer, nullptr);
+    EXPECT_EQ(producer->GetCapacity(), capacity);
+
+    ImsCallPeerDimensionsInfo info;
+    for (uint32_t i = 0; i <= capacity; i++) {
+        info.callIndex = static_cast<int32_t>(i);
+        EXPECT_EQ(producer->Publish(SIM1_SLOTID, ImsEventChannelType::PEER_DIMENSIONS_CHANGED, info), i < capacity);
+    }
+    EXPECT_EQ(consumer->GetDroppedCount(), 1);
+    consumer->ClearDoorbell();
+    ImsEventRecord record;
+    for (uint32_t i = 0; i < capacity; i++) {
+        ASSERT_TRUE(consumer->Consume(record));
+        ImsCallPeerDimensionsInfo received;
+        ASSERT_EQ(record.length, sizeof(received));
+        memcpy_s(&received, sizeof(received), record.payload, record.length);
+        EXPECT_EQ(received.callIndex, static_cast<int32_t>(i));
+        EXPECT_EQ(record.type, static_cast<int32_t>(ImsEventChannelType::PEER_DIMENSIONS_CHANGED));
+    }
+    EXPECT_FALSE(consumer->Consume(record));
+    EXPECT_TRUE(producer->Publish(SIM1_SLOTID, ImsEventChannelType::PEER_DIMENSIONS_CHANGED, info));
+
+    auto imsCallClient = DelayedSingleton<ImsCallClient>::GetInstance();
+    sptr<ImsCallCallbackInterface> callback = new ImsCallCallbackStub();
+    record.length = 0;
+    EXPECT_EQ(imsCallClient->DispatchChannelEvent(callback, record), TELEPHONY_ERR_READ_DATA_FAIL);
+    record.type = static_cast<int32_t>(ImsEventChannelType::EVENT_TYPE_BUTT);
+    EXPECT_EQ(imsCallClient->DispatchChannelEvent(callback, record), TELEPHONY_ERR_ARGUMENT_INVALID);
+}
+
 /**
  * @tc.number   cellular_call_NvCfgFinishedIndication_0001
  * @tc.name     test for NvCfgFinishedIndication
@@ -1088,11 +1301,14 @@ HWTEST_F(Ims2Test, cellular_call_HandleNetworkStateChange_0001, Function | Mediu
         status = networkState;
         return 0;
     });
-    CellularCallConfig::shouldCheckImsAfterNvUpdate_[slotId] = true;
-    CellularCallConfig::networkServiceState_[slotId] = CellularCallConfig::cellularNetworkState();
+    CellularCallConfig::UpdateSlotConfig(slotId, [](SlotConfig &slotConfig) {
+        slotConfig.shouldCheckImsAfterNvUpdate = true;
+        slotConfig.isInService = false;
+        slotConfig.isRoaming = false;
+    });
     CellularCallConfig config;
     config.HandleNetworkStateChange(slotId);
-    ASSERT_FALSE(CellularCallConfig::shouldCheckImsAfterNvUpdate_[slotId]);
+    ASSERT_FALSE(CellularCallConfig::GetSlotConfig(slotId)->shouldCheckImsAfterNvUpdate);
 }
 
 /**
@@ -1110,11 +1326,14 @@ HWTEST_F(Ims2Test, cellular_call_HandleNetworkStateChange_0002, Function | Mediu
         status = networkState;
         return 0;
     });
-    CellularCallConfig::shouldCheckImsAfterNvUpdate_[slotId] = false;
-    CellularCallConfig::networkServiceState_[slotId] = CellularCallConfig::cellularNetworkState();
+    CellularCallConfig::UpdateSlotConfig(slotId, [](SlotConfig &slotConfig) {
+        slotConfig.shouldCheckImsAfterNvUpdate = false;
+        slotConfig.isInService = false;
+        slotConfig.isRoaming = false;
+    });
     CellularCallConfig config;
     config.HandleNetworkStateChange(slotId);
-    ASSERT_FALSE(CellularCallConfig::shouldCheckImsAfterNvUpdate_[slotId]);
+    ASSERT_FALSE(CellularCallConfig::GetSlotConfig(slotId)->shouldCheckImsAfterNvUpdate);
 }
 } // namespace Telephony
 } // namespace OHOS
@@ -21,6 +21,9 @@
 #include "cellular_call_connection_satellite.h"
 #include "call_manager_base.h"
 #include "cellular_call_service.h"
+#include "ims_call_client.h"
+#include "ims_call_proxy.h"
+#include "ipc_object_stub.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -39,6 +42,37 @@ void ImsConnectionTest::TearDownTestCase() {}
 void ImsConnectionTest::SetUp() {}
 
 void ImsConnectionTest::TearDown() {}
+
+class ImsBatchCountStub : public IPCObjectStub {
+public:
+    ImsBatchCountStub() : IPCObjectStub(u"ImsBatchCountStub") {}
+
+    int OnRemoteRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        if (code == static_cast<uint32_t>(ImsCallInterfaceCode::IMS_BATCH_REQUEST)) {
+            batchCount_++;
+            if (batchError_ != ERR_NONE) {
+                return batchError_;
+            }
+            data.ReadInterfaceToken();
+            data.ReadInt32();
+            int32_t size = data.ReadInt32();
+            reply.WriteInt32(TELEPHONY_SUCCESS);
+            reply.WriteInt32Vector(std::vector<int32_t>(size, TELEPHONY_SUCCESS));
+            return ERR_NONE;
+        }
+        if (code == static_cast<uint32_t>(ImsCallInterfaceCode::IMS_REJECT_WITH_REASON)) {
+            rejectCount_++;
+            reply.WriteInt32(TELEPHONY_SUCCESS);
+            return ERR_NONE;
+        }
+        return IPCObjectStub::OnRemoteRequest(code, data, reply, option);
+    }
+
+    int32_t batchError_ = ERR_NONE;
+    int32_t batchCount_ = 0;
+    int32_t rejectCount_ = 0;
+};
 /**
  * @tc.number   Telephony_CellularCallConnectionIMSTest_0001
  * @tc.name     Test CellularCallConnectionIMS
@@ -312,6 +346,49 @@ HWTEST_F(ImsConnectionTest, CellularCallConnectionIMSTest_0021, Function | Mediu
 #endif
 }
 
+/**
+ * @tc.number   Telephony_CellularCallConnectionIMSTest_0022
+ * @tc.name     Test CellularCallConnectionIMS RejectAllRequest
+ * @tc.desc     Function test
+ */
+HWTEST_F(ImsConnectionTest, CellularCallConnectionIMSTest_0022, Function | MediumTest | Level1)
+{
+    auto cellularCallConnectionIMS = std::make_shared<CellularCallConnectionIMS>();
+    int32_t slotId = 0;
+    std::vector<std::pair<std::string, int32_t>> calls;
+    for (int32_t index = 0; index <= IMS_BATCH_OPERATION_MAX_SIZE; index++) {
+        calls.emplace_back("0000000", index);
+    }
+    int32_t ret = cellularCallConnectionIMS->RejectAllRequest(slotId, calls);
+    EXPECT_NE(ret, TELEPHONY_SUCCESS);
+
+    ImsCallInfo callInfo;
+    std::string longNumber(kMaxNumberLength, '1');
+    EXPECT_EQ(cellularCallConnectionIMS->BuildImsCallInfo(slotId, longNumber, 0, callInfo),
+        TELEPHONY_ERR_STRCPY_FAIL);
+    EXPECT_EQ(cellularCallConnectionIMS->BuildImsCallInfo(slotId, "0000000", 1, callInfo), TELEPHONY_SUCCESS);
+    EXPECT_EQ(callInfo.index, 1);
+
+    auto imsCallClient = DelayedSingleton<ImsCallClient>::GetInstance();
+    sptr<ImsBatchCountStub> stub = new ImsBatchCountStub();
+    imsCallClient->imsCallProxy_ = new ImsCallProxy(stub);
+    calls.pop_back();
+    EXPECT_EQ(cellularCallConnectionIMS->RejectAllRequest(slotId, calls), TELEPHONY_SUCCESS);
+    EXPECT_EQ(stub->batchCount_, 1);
+    EXPECT_EQ(stub->rejectCount_, 0);
+    // a service without batch support ran nothing, every call is rejected on its own
+    stub->batchError_ = IPC_STUB_UNKNOW_TRANS_ERR;
+    EXPECT_EQ(cellularCallConnectionIMS->RejectAllRequest(slotId, calls), TELEPHONY_SUCCESS);
+    EXPECT_EQ(stub->batchCount_, 2);
+    EXPECT_EQ(stub->rejectCount_, IMS_BATCH_OPERATION_MAX_SIZE);
+    // a transaction failing after it was sent may have run the batch, nothing is rejected twice
+    stub->batchError_ = ERR_TRANSACTION_FAILED;
+    EXPECT_NE(cellularCallConnectionIMS->RejectAllRequest(slotId, calls), TELEPHONY_SUCCESS);
+    EXPECT_EQ(stub->batchCount_, 3);
+    EXPECT_EQ(stub->rejectCount_, IMS_BATCH_OPERATION_MAX_SIZE);
+    imsCallClient->imsCallProxy_ = nullptr;
+}
+
 /**
  * @tc.number   Telephony_CellularCallConnectionSatelliteTest_0001
  * @tc.name     Test CellularCallConnectionSatellite
@@ -38,9 +38,11 @@
 #include "standardize_utils.h"
 #include "cellular_call_rdb_helper.h"
 #include "cellular_call_dump_helper.h"
+#include "cellular_call_ecc_cache.h"
 #include "emergency_utils.h"
 #include "satellite_call_client.h"
 #include "telephony_ext_wrapper.h"
+#include "local_datashare_connection.h"
 #include "mock_sim_manager.h"
 #include "gmock/gmock.h"
 
@@ -61,6 +63,8 @@ const int32_t ACTIVATE_ACTION = 1;
 const std::string PHONE_NUMBER = "00000000";
 const int32_t DEFAULT_INDEX = 1;
 const int32_t FIVE_MINUTES = 5;
+const int32_t REGISTER_WAIT_COUNT = 100;
+const int32_t REGISTER_WAIT_INTERVAL_MS = 50;
 } // namespace
 
 class DemoHandler : public AppExecFwk::EventHandler {
@@ -109,6 +113,14 @@ bool IsMmiCodeMockFalse(int32_t slotId, std::string &number)
     return false;
 }
 
+void WaitForCoreServiceRegistered(CellularCallService &service)
+{
+    // the registration runs on ffrt and uses the service, so the service must outlive it
+    for (int32_t i = 0; i < REGISTER_WAIT_COUNT && !service.isCoreServiceRegistered_.load(); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(REGISTER_WAIT_INTERVAL_MS));
+    }
+}
+
 int32_t ZeroBranch1Test::InitCellularCallInfo(int32_t accountId, std::string phonenumber, CellularCallInfo &callInfo)
 {
     callInfo.accountId = accountId;
@@ -833,6 +845,9 @@ HWTEST_F(ZeroBranch1Test, Telephony_CellularCallService_004, Function | MediumTe
     cellularCall.SetSrvccState(SrvccState::SRVCC_NONE);
     cellularCall.GetSrvccState();
     cellularCall.RegisterHandler();
+    if (cellularCall.isCoreServiceRegistering_) {
+        WaitForCoreServiceRegistered(cellularCall);
+    }
 #ifdef CALL_MANAGER_AUTO_START_OPTIMIZE
     cellularCall.StartCallManagerService();
     ASSERT_EQ(cellularCall.RequestCameraCapabilities(SIM1_SLOTID, DEFAULT_INDEX), INVALID_VALUE);
@@ -840,7 +855,11 @@ HWTEST_F(ZeroBranch1Test, Telephony_CellularCallService_004, Function | MediumTe
     ASSERT_EQ(cellularCall.RequestCameraCapabilities(SIM1_SLOTID, DEFAULT_INDEX), TELEPHONY_SUCCESS);
 #endif
     cellularCall.Init();
-    cellularCall.RegisterCoreServiceHandler();
+    cellularCall.isCoreServiceRegistered_ = false;
+    if (cellularCall.RegisterCoreServiceHandler()) {
+        WaitForCoreServiceRegistered(cellularCall);
+    }
+    EXPECT_TRUE(cellularCall.isCoreServiceRegistered_.load());
     cellularCall.CreateHandler();
     cellularCall.SendEventRegisterHandler();
     cellularCall.IsValidSlotId(SIM1_SLOTID);
@@ -1261,15 +1280,163 @@ HWTEST_F(ZeroBranch1Test, Telephony_CellularCallRdbHelper_001, Function | Medium
     rdbHelper->RegisterEccDataObserver(callback);
     std::vector<std::string> callListWithCard;
     std::vector<std::string> callListNoCard;
-    config.hplmnEccList_[0].plmn = "";
+    config.UpdateSlotUpdateState(0, [](SlotUpdateState &state) {
+        state.hplmnEccList = std::make_shared<const PlmnEccList>(PlmnEccList { "", {} });
+    });
     bool isHplmnEccList = false;
     config.ProcessHplmnEccList(0, "", isHplmnEccList, callListWithCard, callListNoCard);
-    config.hplmnEccList_[0].plmn = "test";
+    config.UpdateSlotUpdateState(0, [](SlotUpdateState &state) {
+        state.hplmnEccList = std::make_shared<const PlmnEccList>(PlmnEccList { "test", {} });
+    });
     config.ProcessHplmnEccList(0, "", isHplmnEccList, callListWithCard, callListNoCard);
     callListNoCard.push_back("element1");
     config.ProcessHplmnEccList(0, "test", isHplmnEccList, callListWithCard, callListNoCard);
 }
 
+/**
+ * @tc.number	Telephony_CellularCallRdbHelper_002
+ * @tc.name 	Test the data share connection reuse, reconnect and idle expiry
+ * @tc.desc 	Function test
+ */
+HWTEST_F(ZeroBranch1Test, Telephony_CellularCallRdbHelper_002, Function | MediumTest | Level3)
+{
+    auto clock = std::make_shared<VirtualCellularCallClock>();
+    CellularCallClock::SetInstance(clock);
+    auto provider = std::make_shared<LocalDataShareProvider>();
+    EccNum eccNum;
+    eccNum.numeric = "46001";
+    eccNum.ecc_withcard = "110,120";
+    provider->SetEccRow(eccNum.numeric, eccNum);
+    provider->SetSetting("key", "value");
+    auto rdbHelper = DelayedSingleton<CellularCallRdbHelper>::GetInstance();
+    rdbHelper->SetConnector(provider->GetConnector());
+    DataSharePoolStats before;
+    rdbHelper->GetDataShareStats(before);
+
+    std::vector<EccNum> eccVec;
+    EXPECT_EQ(rdbHelper->QueryEccList("46001", eccVec), TELEPHONY_SUCCESS);
+    eccVec.clear();
+    EXPECT_EQ(rdbHelper->QueryEccList("46001", eccVec), TELEPHONY_SUCCESS);
+    ASSERT_EQ(eccVec.size(), 1u);
+    EXPECT_EQ(eccVec[0].ecc_withcard, "110,120");
+    EXPECT_EQ(provider->GetConnectCount(), 1);
+    EXPECT_EQ(provider->GetLiveConnectionCount(), 1);
+
+    provider->Kill();
+    eccVec.clear();
+    EXPECT_EQ(rdbHelper->QueryEccList("46001", eccVec), TELEPHONY_SUCCESS);
+    EXPECT_EQ(eccVec.size(), 1u);
+    EXPECT_EQ(provider->GetConnectCount(), 2);
+    EXPECT_EQ(provider->GetLiveConnectionCount(), 1);
+    sptr<AAFwk::IDataAbilityObserver> callback = sptr<CellularCallService::EmergencyInfoObserver>::MakeSptr();
+    rdbHelper->RegisterEccDataObserver(callback);
+    EXPECT_EQ(provider->GetObserverCount(), 1);
+    EXPECT_EQ(provider->GetConnectCount(), 2);
+
+    std::string value;
+    EXPECT_EQ(rdbHelper->Query("datashare:///settings", "key", value), TELEPHONY_SUCCESS);
+    EXPECT_EQ(value, "value");
+    EXPECT_EQ(provider->GetLiveConnectionCount(), 2);
+    clock->AdvanceMs(DATASHARE_IDLE_TIMEOUT_MS - 1);
+    EXPECT_EQ(provider->GetLiveConnectionCount(), 2);
+    clock->AdvanceMs(1);
+    EXPECT_EQ(provider->GetLiveConnectionCount(), 0);
+
+    provider->SetAvailable(false);
+    EXPECT_NE(rdbHelper->QueryEccList("46001", eccVec), TELEPHONY_SUCCESS);
+    DataSharePoolStats after;
+    rdbHelper->GetDataShareStats(after);
+    EXPECT_EQ(after.connects - before.connects, 3u);
+    EXPECT_EQ(after.reconnects - before.reconnects, 1u);
+    EXPECT_EQ(after.expires - before.expires, 2u);
+    EXPECT_EQ(after.activeConnections, 0u);
+    uint32_t eccIndex = static_cast<uint32_t>(DataShareOperation::QUERY_ECC_LIST);
+    EXPECT_EQ(after.operations[eccIndex].count - before.operations[eccIndex].count, 4u);
+    EXPECT_EQ(after.operations[eccIndex].failures - before.operations[eccIndex].failures, 1u);
+    rdbHelper->SetConnector(nullptr);
+    CellularCallClock::SetInstance(nullptr);
+}
+
+/**
+ * @tc.number	Telephony_CellularCallConfig_EccPlmnLru
+ * @tc.name 	Test the batched ecc query, the PLMN lru and the prefetch of a new country
+ * @tc.desc 	Function test
+ */
+HWTEST_F(ZeroBranch1Test, Telephony_CellularCallConfig_EccPlmnLru, Function | MediumTest | Level3)
+{
+    CellularCallEccPlmnLru lru(2);
+    EccNum eccNum;
+    lru.Put("46001", eccNum);
+    lru.Put("46002", eccNum);
+    EXPECT_TRUE(lru.Get("46001", eccNum));
+    lru.Put("46003", eccNum);
+    EXPECT_FALSE(lru.Contains("46002"));
+    lru.Invalidate();
+    EXPECT_FALSE(lru.Get("46001", eccNum));
+    std::vector<std::string> invalidPlmns;
+    lru.GetInvalidPlmns(invalidPlmns);
+    ASSERT_EQ(invalidPlmns.size(), 2u);
+    EXPECT_EQ(invalidPlmns[0], "46003");
+    EccPlmnLruStats lruStats;
+    lru.GetStats(lruStats);
+    EXPECT_EQ(lruStats.evictions, 1u);
+    lru.Clear();
+    lru.Put("46001", eccNum);
+    EXPECT_TRUE(lru.PutIfRoom("46002", eccNum));
+    EXPECT_FALSE(lru.PutIfRoom("46003", eccNum));
+    EXPECT_FALSE(lru.Contains("46003"));
+    lru.Put("46011", eccNum);
+    EXPECT_TRUE(lru.Contains("46001"));
+    EXPECT_FALSE(lru.Contains("46002"));
+
+    auto eccCache = DelayedSingleton<CellularCallEccCache>::GetInstance();
+    eccCache->Open("/data/local/tmp/cellular_call_ecc_plmn_lru_test.bin");
+    eccCache->Clear();
+    CellularCallConfig::eccPlmnLru_.Clear();
+    auto provider = std::make_shared<LocalDataShareProvider>();
+    for (const auto &numeric : { "46001", "46002", "46011", "310260", "310410" }) {
+        eccNum.ecc_withcard = std::string("112,") + numeric;
+        provider->SetEccRow(numeric, eccNum);
+    }
+    auto rdbHelper = DelayedSingleton<CellularCallRdbHelper>::GetInstance();
+    rdbHelper->SetConnector(provider->GetConnector());
+    CellularCallConfig config;
+    config.UpdateSlotConfig(SIM1_SLOTID, [](SlotConfig &slotConfig) { slotConfig.curPlmn = "46001"; });
+
+    std::vector<EccNum> eccVec;
+    EXPECT_EQ(config.QueryEccList(SIM1_SLOTID, "46002", eccVec), TELEPHONY_SUCCESS);
+    ASSERT_EQ(eccVec.size(), 1u);
+    EXPECT_EQ(eccVec[0].ecc_withcard, "112,46002");
+    EXPECT_EQ(provider->GetEccQueryCount(), 1);
+    eccVec.clear();
+    EXPECT_EQ(config.QueryEccList(SIM1_SLOTID, "46001", eccVec), TELEPHONY_SUCCESS);
+    ASSERT_EQ(eccVec.size(), 1u);
+    EXPECT_EQ(eccVec[0].ecc_withcard, "112,46001");
+    EXPECT_EQ(config.eccListSource_, EccListSource::MEMORY);
+    EXPECT_EQ(provider->GetEccQueryCount(), 1);
+
+    CellularCallConfig::eccPlmnLru_.Invalidate();
+    eccVec.clear();
+    EXPECT_EQ(config.QueryEccList(SIM1_SLOTID, "46011", eccVec), TELEPHONY_SUCCESS);
+    EXPECT_EQ(provider->GetEccQueryCount(), 2);
+    EXPECT_TRUE(CellularCallConfig::eccPlmnLru_.Contains("46001"));
+    EXPECT_TRUE(CellularCallConfig::eccPlmnLru_.Contains("46002"));
+
+    CellularCallConfig::PrefetchEccList("310260");
+    EXPECT_EQ(provider->GetEccQueryCount(), 3);
+    EXPECT_TRUE(CellularCallConfig::eccPlmnLru_.Contains("310260"));
+    EXPECT_TRUE(CellularCallConfig::eccPlmnLru_.Contains("310410"));
+    EXPECT_TRUE(CellularCallConfig::eccPlmnLru_.Contains("46001"));
+    EXPECT_TRUE(CellularCallConfig::eccPlmnLru_.Contains("46002"));
+    CellularCallConfig::PrefetchEccList("310260");
+    EXPECT_EQ(provider->GetEccQueryCount(), 3);
+
+    config.UpdateSlotConfig(SIM1_SLOTID, [](SlotConfig &slotConfig) { slotConfig.curPlmn = ""; });
+    CellularCallConfig::eccPlmnLru_.Clear();
+    eccCache->Clear();
+    rdbHelper->SetConnector(nullptr);
+}
+
 /**
  * @tc.number	Telephony_CellularCallDumpHelper_001
  * @tc.name 	Test error branch
@@ -12,9 +12,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+
 #define private public
 #define protected public
 
+#include "cellular_call_clock.h"
 #include "cellular_call_config.h"
 #include "cellular_call_connection_ims.h"
 #include "cellular_call_handler.h"
@@ -38,6 +43,8 @@
 #include "standardize_utils.h"
 #include "cellular_call_rdb_helper.h"
 #include "cellular_call_dump_helper.h"
+#include "cellular_call_ecc_cache.h"
+#include "cellular_call_parameter_cache.h"
 #include "emergency_utils.h"
 #ifdef CELLULAR_CALL_SATELLITE
 #include "satellite_call_client.h"
@@ -165,16 +172,16 @@ HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_001, TestSize.Level1)
     bool enabled = false;
     config.SetImsSwitchStatus(INVALID_SLOTID, enabled);
     config.SetImsSwitchStatus(SIM1_SLOTID, enabled);
-    config.volteSupported_[SIM1_SLOTID] = true;
-    config.volteSupported_[INVALID_SLOTID] = true;
-    config.volteProvisioningSupported_[SIM1_SLOTID] = true;
-    config.volteProvisioningSupported_[INVALID_SLOTID] = true;
+    config.UpdateSlotConfig(SIM1_SLOTID, [](SlotConfig &slotConfig) {
+        slotConfig.volteSupported = true;
+        slotConfig.volteProvisioningSupported = true;
+    });
     config.SetImsSwitchStatus(INVALID_SLOTID, enabled);
     config.SetImsSwitchStatus(SIM1_SLOTID, true);
-    config.volteSupported_[SIM1_SLOTID] = enabled;
-    config.volteSupported_[INVALID_SLOTID] = enabled;
-    config.volteProvisioningSupported_[SIM1_SLOTID] = enabled;
-    config.volteProvisioningSupported_[INVALID_SLOTID] = enabled;
+    config.UpdateSlotConfig(SIM1_SLOTID, [enabled](SlotConfig &slotConfig) {
+        slotConfig.volteSupported = enabled;
+        slotConfig.volteProvisioningSupported = enabled;
+    });
     config.GetImsSwitchStatus(SIM1_SLOTID, enabled);
     config.saveImsSwitchStatusToLocalForPowerOn(SIM1_SLOTID);
     config.saveImsSwitchStatusToLocalForPowerOn(INVALID_SLOTID);
@@ -237,21 +244,22 @@ HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_002, Function | MediumTest
     config.UpdateImsConfiguration(INVALID_SLOTID, -1, false);
     ASSERT_FALSE(config.GetCarrierVtAvailbleConfig(INVALID_SLOTID));
     OperatorConfig poc;
-    config.ParseAndCacheOperatorConfigs(SIM1_SLOTID, poc);
+    uint32_t changes = OPERATOR_CONFIG_CHANGE_NONE;
+    config.ParseAndCacheOperatorConfigs(SIM1_SLOTID, poc, config.GetOperatorConfigFingerprint(poc), changes);
     config.UpdateImsCapabilities(SIM1_SLOTID, true, false, -1);
     config.SaveImsSwitch(SIM1_SLOTID, true);
     config.IsUtProvisioned(SIM1_SLOTID);
-    config.utProvisioningSupported_[SIM1_SLOTID] = true;
+    config.UpdateSlotConfig(SIM1_SLOTID, [](SlotConfig &slotConfig) { slotConfig.utProvisioningSupported = true; });
     config.IsUtProvisioned(SIM1_SLOTID);
-    config.utProvisioningSupported_[SIM1_SLOTID] = false;
+    config.UpdateSlotConfig(SIM1_SLOTID, [](SlotConfig &slotConfig) { slotConfig.utProvisioningSupported = false; });
     config.ResetImsSwitch(SIM1_SLOTID);
     config.HandleSimAccountLoaded(SIM1_SLOTID);
     config.HandleSimAccountLoaded(INVALID_SLOTID);
-    ASSERT_FALSE(config.utProvisioningSupported_[SIM1_SLOTID]);
+    ASSERT_FALSE(config.GetSlotConfig(SIM1_SLOTID)->utProvisioningSupported);
     config.SetClearCode(SIM1_SLOTID, 0);
     config.SetClearCode(SIM1_SLOTID, 1);
     config.SetClearCode(SIM1_SLOTID, 18432);
-    config.imsSipCauseEnable_[SIM1_SLOTID] = true;
+    config.UpdateSlotConfig(SIM1_SLOTID, [](SlotConfig &slotConfig) { slotConfig.imsSipCauseEnable = true; });
     config.SetClearCode(SIM1_SLOTID, 18432);
     SetParameter("telephony.call.disconnectCode", "0");
     config.SetClearCode(SIM1_SLOTID, 18918);
@@ -260,6 +268,452 @@ HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_002, Function | MediumTest
     ASSERT_EQ(code, 0);
 }
 
+/**
+ * @tc.number   Telephony_CellularCallConfig_Snapshot
+ * @tc.name     Test operator config and ecc list snapshots
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_Snapshot, Function | MediumTest | Level3)
+{
+    CellularCallConfig config;
+    OperatorConfig poc;
+    poc.boolValue[KEY_VOLTE_SUPPORTED_BOOL] = true;
+    poc.intValue[KEY_CALL_WAITING_SERVICE_CLASS_INT] = 1;
+    auto snapshot = CellularCallConfig::ParseOperatorConfigs(poc);
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_TRUE(snapshot->boolValues.at(KEY_VOLTE_SUPPORTED_BOOL));
+    EXPECT_EQ(snapshot->boolValues.count(KEY_HIDE_IMS_SWITCH_BOOL), 0u);
+    EXPECT_TRUE(snapshot->hasCallWaitingServiceClass);
+    EXPECT_FALSE(snapshot->hasNrModeSupportedList);
+
+    config.UpdateSlotConfig(SIM1_SLOTID, [](SlotConfig &slotConfig) { slotConfig.volteSupported = false; });
+    OperatorConfigParseResult result;
+    result.slotId = SIM1_SLOTID;
+    result.snapshot = snapshot;
+    result.generation = config.GetSlotUpdateState(SIM1_SLOTID)->operatorConfigGeneration + 1;
+    config.ApplyImsConfiguration(result);
+    EXPECT_FALSE(config.GetSlotConfig(SIM1_SLOTID)->volteSupported);
+    config.CacheOperatorConfigs(SIM1_SLOTID, *snapshot);
+    EXPECT_TRUE(config.GetSlotConfig(SIM1_SLOTID)->volteSupported);
+
+    EmergencyCall call112 = config.BuildDefaultEmergencyCall("112", SimpresentType::TYPE_HAS_CARD);
+    CellularCallEccMerger &merger = config.eccMergers_[SIM1_SLOTID];
+    merger.Clear();
+    auto publishMergedList = [&config, &merger]() {
+        auto mergedList = merger.GetMergedList();
+        config.UpdateSlotConfig(SIM1_SLOTID, [&mergedList](SlotConfig &slotConfig) {
+            slotConfig.eccList = mergedList;
+        });
+    };
+    EXPECT_TRUE(merger.SetSource(EccMergeSource::DEFAULT, { call112, call112 }));
+    publishMergedList();
+    auto eccSnapshot = config.GetEccCallListSnapshot(SIM1_SLOTID);
+    ASSERT_NE(eccSnapshot, nullptr);
+    EXPECT_EQ(eccSnapshot->size(), 1u);
+    EXPECT_TRUE(merger.SetSource(EccMergeSource::DEFAULT, {}));
+    publishMergedList();
+    EXPECT_EQ(eccSnapshot->size(), 1u);
+    EXPECT_TRUE(config.GetEccCallList(SIM1_SLOTID).empty());
+    merger.Clear();
+}
+
+/**
+ * @tc.number   Telephony_CellularCallConfig_EccPublish
+ * @tc.name     Test that the ecc list is published before the update returns
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_EccPublish, Function | MediumTest | Level3)
+{
+    CellularCallConfig config;
+    config.InitModeActive();
+    std::vector<EmergencyCall> eccList = config.GetEccCallList(SIM1_SLOTID);
+    EXPECT_FALSE(eccList.empty());
+    size_t defaultSize = eccList.size();
+
+    EmergencyInfoList radioList;
+    EmergencyInfo info;
+    info.eccNum = "12345";
+    radioList.calls.push_back(info);
+    radioList.callSize = static_cast<int32_t>(radioList.calls.size());
+    config.UpdateEmergencyCallFromRadio(SIM1_SLOTID, radioList);
+    eccList = config.GetEccCallList(SIM1_SLOTID);
+    ASSERT_FALSE(eccList.empty());
+    EXPECT_EQ(eccList[0].eccNum, "12345");
+    EXPECT_GE(eccList.size(), defaultSize);
+
+    radioList.calls.clear();
+    radioList.callSize = 0;
+    config.UpdateEmergencyCallFromRadio(SIM1_SLOTID, radioList);
+    eccList = config.GetEccCallList(SIM1_SLOTID);
+    EXPECT_TRUE(std::none_of(eccList.begin(), eccList.end(),
+        [](const EmergencyCall &call) { return call.eccNum == "12345"; }));
+    config.InitModeActive();
+}
+
+/**
+ * @tc.number   Telephony_CellularCallConfig_SlotConfig
+ * @tc.name     Test the versioned slot config snapshots
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_SlotConfig, Function | MediumTest | Level3)
+{
+    CellularCallConfig config;
+    std::shared_ptr<const SlotConfig> before = CellularCallConfig::GetSlotConfig(SIM1_SLOTID);
+    ASSERT_NE(before, nullptr);
+    bool volteSupported = before->volteSupported;
+    CellularCallConfig::UpdateSlotConfig(SIM1_SLOTID, [volteSupported](SlotConfig &slotConfig) {
+        slotConfig.volteSupported = !volteSupported;
+        slotConfig.readyToCall = false;
+    });
+    std::shared_ptr<const SlotConfig> after = CellularCallConfig::GetSlotConfig(SIM1_SLOTID);
+    EXPECT_EQ(after->version, before->version + 1);
+    EXPECT_EQ(before->volteSupported, volteSupported);
+    EXPECT_NE(after->volteSupported, volteSupported);
+    EXPECT_FALSE(config.IsReadyToCall(SIM1_SLOTID));
+    config.SetReadyToCall(SIM1_SLOTID, true);
+    EXPECT_EQ(CellularCallConfig::GetSlotConfig(SIM1_SLOTID)->version, after->version + 1);
+    EXPECT_TRUE(config.IsReadyToCall(SIM1_SLOTID));
+    CellularCallConfig::UpdateSlotConfig(SIM1_SLOTID,
+        [volteSupported](SlotConfig &slotConfig) { slotConfig.volteSupported = volteSupported; });
+
+    CellularCallConfig::UpdateSlotConfig(INVALID_SLOTID, [](SlotConfig &slotConfig) { slotConfig.readyToCall = true; });
+    std::shared_ptr<const SlotConfig> invalid = CellularCallConfig::GetSlotConfig(INVALID_SLOTID);
+    ASSERT_NE(invalid, nullptr);
+    EXPECT_EQ(invalid->version, 0u);
+    EXPECT_FALSE(invalid->readyToCall);
+}
+
+/**
+ * @tc.number   Telephony_CellularCallConfig_OperatorConfigCache
+ * @tc.name     Test the fingerprinted operator config parse cache
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_OperatorConfigCache, Function | MediumTest | Level3)
+{
+    CellularCallConfig config;
+    OperatorConfig poc;
+    poc.boolValue[KEY_VOLTE_SUPPORTED_BOOL] = true;
+    poc.boolValue[KEY_VIDEO_CALL_WAITING_ON_BOOL] = true;
+    uint64_t fingerprint = CellularCallConfig::GetOperatorConfigFingerprint(poc);
+    OperatorConfigCacheStats before;
+    CellularCallConfig::GetOperatorConfigCacheStats(SIM1_SLOTID, before);
+    auto snapshot = CellularCallConfig::GetParsedOperatorConfigs(SIM1_SLOTID, poc, fingerprint);
+    EXPECT_EQ(CellularCallConfig::GetParsedOperatorConfigs(SIM1_SLOTID, poc, fingerprint), snapshot);
+    OperatorConfigCacheStats stats;
+    CellularCallConfig::GetOperatorConfigCacheStats(SIM1_SLOTID, stats);
+    EXPECT_EQ(stats.parses, before.parses + 1);
+    EXPECT_EQ(stats.parseHits, before.parseHits + 1);
+
+    config.RecordOperatorConfigApplied(SIM1_SLOTID, fingerprint, INVALID_OPERATOR_CONFIG_STATE);
+    config.UpdateSlotConfig(SIM1_SLOTID, [](SlotConfig &slotConfig) {
+        slotConfig.volteSupported = false;
+        slotConfig.videoCallWaiting = true;
+    });
+    EXPECT_EQ(config.CacheOperatorConfigs(SIM1_SLOTID, *snapshot),
+        static_cast<uint32_t>(OPERATOR_CONFIG_CHANGE_IMS_CAPABILITY));
+    EXPECT_EQ(config.CacheOperatorConfigs(SIM1_SLOTID, *snapshot),
+        static_cast<uint32_t>(OPERATOR_CONFIG_CHANGE_NONE));
+    poc.boolValue[KEY_VIDEO_CALL_WAITING_ON_BOOL] = false;
+    uint64_t changedFingerprint = CellularCallConfig::GetOperatorConfigFingerprint(poc);
+    EXPECT_NE(changedFingerprint, fingerprint);
+    uint32_t changes = OPERATOR_CONFIG_CHANGE_NONE;
+    EXPECT_EQ(config.ParseAndCacheOperatorConfigs(SIM1_SLOTID, poc, changedFingerprint, changes), TELEPHONY_SUCCESS);
+    EXPECT_EQ(changes, static_cast<uint32_t>(OPERATOR_CONFIG_CHANGE_VIDEO_CALL_WAITING));
+    EXPECT_FALSE(config.GetSlotConfig(SIM1_SLOTID)->videoCallWaiting);
+    CellularCallConfig::GetOperatorConfigCacheStats(SIM1_SLOTID, stats);
+    EXPECT_EQ(stats.parses, before.parses + 2);
+    EXPECT_EQ(stats.applies, before.applies + 3);
+    EXPECT_EQ(stats.unchangedApplies, before.unchangedApplies + 1);
+    EXPECT_EQ(stats.lastChanges, static_cast<uint32_t>(OPERATOR_CONFIG_CHANGE_VIDEO_CALL_WAITING));
+}
+
+/**
+ * @tc.number   Telephony_CellularCallConfig_OperatorConfigOrdering
+ * @tc.name     Test an unchanged operator config after a loaded sim account keeps the full push
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_OperatorConfigOrdering, Function | MediumTest | Level3)
+{
+    CellularCallConfig config;
+    bool isOpcChanged = false;
+    uint64_t simLoaded = CellularCallConfig::NewOperatorConfigRequest(SIM1_SLOTID, isOpcChanged);
+    isOpcChanged = true;
+    uint64_t opcChanged = CellularCallConfig::NewOperatorConfigRequest(SIM1_SLOTID, isOpcChanged);
+    EXPECT_EQ(opcChanged, simLoaded + 1);
+    EXPECT_FALSE(isOpcChanged);
+
+    OperatorConfig poc;
+    OperatorConfigParseResult result;
+    result.slotId = SIM1_SLOTID;
+    result.snapshot = CellularCallConfig::ParseOperatorConfigs(poc);
+    result.generation = simLoaded;
+    config.ApplyImsConfiguration(result);
+    EXPECT_TRUE(config.GetSlotUpdateState(SIM1_SLOTID)->isFullImsPushPending);
+    result.generation = opcChanged;
+    config.ApplyImsConfiguration(result);
+    EXPECT_FALSE(config.GetSlotUpdateState(SIM1_SLOTID)->isFullImsPushPending);
+
+    isOpcChanged = true;
+    CellularCallConfig::NewOperatorConfigRequest(SIM1_SLOTID, isOpcChanged);
+    EXPECT_TRUE(isOpcChanged);
+}
+
+/**
+ * @tc.number   Telephony_CellularCallConfig_DisconnectReasonMapping
+ * @tc.name     Test the parsed disconnect reason mapping and its swap on config change
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_DisconnectReasonMapping, Function | MediumTest | Level3)
+{
+    std::vector<std::string> mapping = { "", "7", "5|busy|5|9", "5|other|3", "6||declined", "abc|unknown" };
+    auto table = CellularCallConfig::ParseDisconnectReasonMapping(mapping);
+    ASSERT_EQ(table->size(), 3u);
+    EXPECT_EQ(table->count(7), 0u);
+    EXPECT_EQ(table->at(5).message, "busy");
+    EXPECT_TRUE(table->at(5).hasReason);
+    EXPECT_EQ(table->at(5).reason, 9);
+    EXPECT_EQ(table->at(6).message, "declined");
+    EXPECT_FALSE(table->at(6).hasReason);
+    EXPECT_EQ(table->at(0).message, "unknown");
+
+    CellularCallConfig config;
+    OperatorConfigSnapshot snapshot;
+    snapshot.hasDisconnectReasonMapping = true;
+    snapshot.disconnectReasonMapping = mapping;
+    snapshot.disconnectReasonTable = table;
+    config.CacheOperatorConfigs(SIM1_SLOTID, snapshot);
+    uint64_t version = config.GetSlotConfig(SIM1_SLOTID)->disconnectReasonTableVersion;
+    DisconnectReasonMapping item;
+    ASSERT_TRUE(CellularCallConfig::GetDisconnectReasonMapping(SIM1_SLOTID, 5, item));
+    EXPECT_EQ(item.reason, 9);
+    EXPECT_FALSE(CellularCallConfig::GetDisconnectReasonMapping(SIM1_SLOTID, 7, item));
+    EXPECT_FALSE(CellularCallConfig::GetDisconnectReasonMapping(SIM_SLOT_COUNT, 5, item));
+    config.CacheOperatorConfigs(SIM1_SLOTID, snapshot);
+    EXPECT_EQ(config.GetSlotConfig(SIM1_SLOTID)->disconnectReasonTableVersion, version);
+
+    snapshot.disconnectReasonMapping = { "7|congestion|3" };
+    snapshot.disconnectReasonTable = CellularCallConfig::ParseDisconnectReasonMapping(snapshot.disconnectReasonMapping);
+    EXPECT_NE(config.CacheOperatorConfigs(SIM1_SLOTID, snapshot) & OPERATOR_CONFIG_CHANGE_DISCONNECT_MAPPING, 0u);
+    EXPECT_EQ(config.GetSlotConfig(SIM1_SLOTID)->disconnectReasonTableVersion, version + 1);
+    EXPECT_FALSE(CellularCallConfig::GetDisconnectReasonMapping(SIM1_SLOTID, 5, item));
+    ASSERT_TRUE(CellularCallConfig::GetDisconnectReasonMapping(SIM1_SLOTID, 7, item));
+    EXPECT_EQ(item.message, "congestion");
+}
+
+/**
+ * @tc.number   Telephony_CellularCallEccMerger_001
+ * @tc.name     Test the incremental merge of the ecc sources
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallEccMerger_001, Function | MediumTest | Level3)
+{
+    CellularCallConfig config;
+    EmergencyCall radio112 = config.BuildDefaultEmergencyCall("112", SimpresentType::TYPE_HAS_CARD);
+    radio112.eccType = EccType::TYPE_POLICE;
+    EmergencyCall default112 = config.BuildDefaultEmergencyCall("112", SimpresentType::TYPE_HAS_CARD);
+    EmergencyCall default911 = config.BuildDefaultEmergencyCall("911", SimpresentType::TYPE_HAS_CARD);
+    EmergencyCall fake120 = config.BuildDefaultEmergencyCall("120", SimpresentType::TYPE_HAS_CARD);
+    CellularCallEccMerger merger;
+    EXPECT_TRUE(merger.SetSource(EccMergeSource::DEFAULT, { default112, default911, default911 }));
+    EXPECT_TRUE(merger.SetSource(EccMergeSource::RADIO, { radio112 }));
+    EXPECT_TRUE(merger.SetSource(EccMergeSource::FAKE, { fake120, default911 }));
+    auto mergedList = merger.GetMergedList();
+    ASSERT_EQ(mergedList->size(), 3u);
+    EXPECT_EQ((*mergedList)[0].eccNum, "112");
+    EXPECT_EQ((*mergedList)[0].eccType, EccType::TYPE_POLICE);
+    EXPECT_EQ((*mergedList)[1].eccNum, "911");
+    EXPECT_EQ((*mergedList)[2].eccNum, "120");
+
+    EXPECT_FALSE(merger.SetSource(EccMergeSource::FAKE, { fake120, default911 }));
+    EXPECT_EQ(merger.GetMergedList(), mergedList);
+    EXPECT_TRUE(merger.SetSource(EccMergeSource::RADIO, {}));
+    mergedList = merger.GetMergedList();
+    ASSERT_EQ(mergedList->size(), 3u);
+    EXPECT_EQ((*mergedList)[0].eccType, default112.eccType);
+    EXPECT_TRUE(merger.SetSource(EccMergeSource::DEFAULT, {}));
+    mergedList = merger.GetMergedList();
+    ASSERT_EQ(mergedList->size(), 2u);
+    EXPECT_EQ((*mergedList)[0].eccNum, "120");
+    EccMergeStats stats;
+    merger.GetStats(stats);
+    EXPECT_EQ(stats.unchanged, 1u);
+    EXPECT_EQ(stats.rebuilds, 3u);
+    merger.Clear();
+    EXPECT_TRUE(merger.GetMergedList()->empty());
+}
+
+/**
+ * @tc.number   Telephony_CellularCallEccAssembler_001
+ * @tc.name     Test the assembly of the chunked ecc report
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallEccAssembler_001, Function | MediumTest | Level3)
+{
+    auto buildChunk = [](int32_t total, std::vector<int32_t> indexes) {
+        EmergencyInfoList chunk;
+        for (auto index : indexes) {
+            EmergencyInfo info;
+            info.index = index;
+            info.total = total;
+            info.eccNum = std::to_string(index);
+            chunk.calls.push_back(info);
+        }
+        chunk.callSize = static_cast<int32_t>(chunk.calls.size());
+        return chunk;
+    };
+    CellularCallEccAssembler assembler;
+    EmergencyInfoList eccList;
+    bool isNewAssembly = false;
+    EXPECT_EQ(assembler.AddChunk(buildChunk(2, { 1, 2 }), 0, eccList, isNewAssembly), EccAssemblyResult::COMPLETE);
+    EXPECT_EQ(eccList.calls.size(), 2u);
+    EXPECT_EQ(assembler.AddChunk(buildChunk(4, { 3, 4 }), 0, eccList, isNewAssembly), EccAssemblyResult::PARTIAL);
+    EXPECT_TRUE(isNewAssembly);
+    EXPECT_EQ(assembler.AddChunk(buildChunk(4, { 4 }), 0, eccList, isNewAssembly), EccAssemblyResult::PARTIAL);
+    EXPECT_FALSE(isNewAssembly);
+    EXPECT_EQ(assembler.AddChunk(buildChunk(4, { 2, 1 }), 0, eccList, isNewAssembly), EccAssemblyResult::COMPLETE);
+    ASSERT_EQ(eccList.calls.size(), 4u);
+    EXPECT_EQ(eccList.callSize, 4);
+    EXPECT_EQ(eccList.calls[0].eccNum, "1");
+    EXPECT_EQ(eccList.calls[3].eccNum, "4");
+
+    std::vector<EccIndexRange> missing;
+    EXPECT_EQ(assembler.AddChunk(buildChunk(3, { 1 }), 0, eccList, isNewAssembly), EccAssemblyResult::PARTIAL);
+    EXPECT_EQ(assembler.AddChunk(buildChunk(6, { 2, 5 }), 10, eccList, isNewAssembly), EccAssemblyResult::PARTIAL);
+    EXPECT_TRUE(isNewAssembly);
+    EXPECT_FALSE(assembler.CheckTimeout(ECC_ASSEMBLY_TIMEOUT_MS, missing));
+    EXPECT_TRUE(assembler.CheckTimeout(ECC_ASSEMBLY_TIMEOUT_MS + 10, missing));
+    ASSERT_EQ(missing.size(), 3u);
+    EXPECT_EQ(missing[0].begin, 1);
+    EXPECT_EQ(missing[0].end, 1);
+    EXPECT_EQ(missing[1].begin, 3);
+    EXPECT_EQ(missing[1].end, 4);
+    EXPECT_EQ(missing[2].begin, 6);
+    EXPECT_EQ(missing[2].end, 6);
+    EXPECT_FALSE(assembler.CheckTimeout(ECC_ASSEMBLY_TIMEOUT_MS * 2, missing));
+
+    EXPECT_EQ(assembler.AddChunk(buildChunk(2, { 3 }), 0, eccList, isNewAssembly), EccAssemblyResult::INVALID);
+    EXPECT_TRUE(assembler.TryRequery(0));
+    EXPECT_FALSE(assembler.TryRequery(ECC_REQUERY_MIN_INTERVAL_MS - 1));
+    EXPECT_TRUE(assembler.TryRequery(ECC_REQUERY_MIN_INTERVAL_MS));
+    EccAssemblyStats stats;
+    assembler.GetStats(stats);
+    EXPECT_EQ(stats.completed, 2u);
+    EXPECT_EQ(stats.outOfOrder, 5u);
+    EXPECT_EQ(stats.duplicates, 1u);
+    EXPECT_EQ(stats.restarts, 1u);
+    EXPECT_EQ(stats.invalid, 1u);
+    EXPECT_EQ(stats.timeouts, 1u);
+    EXPECT_EQ(stats.requeries, 2u);
+    EXPECT_EQ(stats.suppressedRequeries, 1u);
+}
+
+/**
+ * @tc.number   Telephony_CellularCallParameterCache_001
+ * @tc.name     Test the reads served by the parameter cache
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallParameterCache_001, Function | MediumTest | Level3)
+{
+    const std::string key = "telephony.cellular_call.test.parameter_cache";
+    CellularCallParameterCache cache;
+    EXPECT_EQ(cache.GetInt(key, 5), 5);
+    ParameterCacheStats stats;
+    cache.GetStats(stats);
+    EXPECT_EQ(stats.misses, 1u);
+    ASSERT_EQ(stats.cachedKeys, 1u);
+
+    cache.OnParameterChanged(key, "12");
+    EXPECT_EQ(cache.GetInt(key, 5), 12);
+    EXPECT_EQ(cache.GetString(key, ""), "12");
+    cache.OnParameterChanged(key, "12abc");
+    EXPECT_EQ(cache.GetInt(key, 5), 5);
+    EXPECT_TRUE(cache.GetBool(key, true));
+    cache.OnParameterChanged(key, "on");
+    EXPECT_TRUE(cache.GetBool(key, false));
+    cache.OnParameterChanged(key, "false");
+    EXPECT_FALSE(cache.GetBool(key, true));
+    // a key sharing the watched prefix is not cached
+    cache.OnParameterChanged(key + ".other", "1");
+    cache.GetStats(stats);
+    EXPECT_EQ(stats.cachedKeys, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 6u);
+    EXPECT_EQ(stats.updates, 4u);
+}
+
+/**
+ * @tc.number   Telephony_CellularCallEccCache_001
+ * @tc.name     Test the persisted ecc cache
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallEccCache_001, Function | MediumTest | Level3)
+{
+    std::string path = "/data/local/tmp/cellular_call_ecc_cache_test.bin";
+    unlink(path.c_str());
+    CellularCallEccCache eccCache;
+    EXPECT_NE(eccCache.Open(path), TELEPHONY_SUCCESS);
+    EccNum eccNum;
+    eccNum.ecc_withcard = "110,119,120";
+    eccNum.ecc_nocard = "112,911";
+    bool isChanged = false;
+    EXPECT_EQ(eccCache.Store("46001", eccNum, isChanged), TELEPHONY_SUCCESS);
+    EXPECT_TRUE(isChanged);
+    EXPECT_EQ(eccCache.Store("46001", eccNum, isChanged), TELEPHONY_SUCCESS);
+    EXPECT_FALSE(isChanged);
+    EXPECT_NE(eccCache.Store("123456789", eccNum, isChanged), TELEPHONY_SUCCESS);
+
+    CellularCallEccCache warmCache;
+    ASSERT_EQ(warmCache.Open(path), TELEPHONY_SUCCESS);
+    EccNum cached;
+    bool needVerify = false;
+    ASSERT_TRUE(warmCache.Lookup("46001", cached, needVerify));
+    EXPECT_TRUE(needVerify);
+    EXPECT_EQ(cached.ecc_withcard, eccNum.ecc_withcard);
+    EXPECT_EQ(cached.ecc_nocard, eccNum.ecc_nocard);
+    EXPECT_FALSE(warmCache.Lookup("46000", cached, needVerify));
+    EXPECT_EQ(warmCache.Store("46001", eccNum, isChanged), TELEPHONY_SUCCESS);
+    EXPECT_TRUE(warmCache.Lookup("46001", cached, needVerify));
+    EXPECT_FALSE(needVerify);
+
+    int fd = open(path.c_str(), O_WRONLY);
+    ASSERT_GE(fd, 0);
+    // corrupt the string pool at the end of the file
+    lseek(fd, -1, SEEK_END);
+    EXPECT_EQ(write(fd, "0", 1), 1);
+    close(fd);
+    CellularCallEccCache brokenCache;
+    EXPECT_NE(brokenCache.Open(path), TELEPHONY_SUCCESS);
+    EccCacheStats stats;
+    brokenCache.GetStats(stats);
+    EXPECT_EQ(stats.loadFailures, 1u);
+    EXPECT_FALSE(brokenCache.Lookup("46001", cached, needVerify));
+    brokenCache.Clear();
+}
+
+/**
+ * @tc.number   Telephony_CellularCallConfig_EccReady
+ * @tc.name     Test the time to the right ecc list
+ * @tc.desc     Function test
+ */
+HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_EccReady, Function | MediumTest | Level3)
+{
+    CellularCallConfig::RecordEccReady(SIM1_SLOTID, EccListSource::MEMORY);
+    EccReadyStats before;
+    CellularCallConfig::GetEccReadyStats(SIM1_SLOTID, before);
+    EXPECT_EQ(before.requestTimeMs, 0);
+    int64_t nowMs = CellularCallClock::GetInstance()->NowMs();
+    CellularCallConfig::UpdateSlotUpdateState(
+        SIM1_SLOTID, [nowMs](SlotUpdateState &state) { state.eccReadyStats.requestTimeMs = nowMs; });
+    CellularCallConfig::RecordEccReady(SIM1_SLOTID, EccListSource::DISK_CACHE);
+    EccReadyStats after;
+    CellularCallConfig::GetEccReadyStats(SIM1_SLOTID, after);
+    EXPECT_EQ(after.requestTimeMs, 0);
+    EXPECT_EQ(after.readyCount, before.readyCount + 1);
+    EXPECT_EQ(after.lastSource, EccListSource::DISK_CACHE);
+    EXPECT_GE(after.lastReadyCostMs, 0);
+    EXPECT_GE(after.bootReadyCostMs, 0);
+}
+
 /**
  * @tc.number   Telephony_CellularCallConfig_VoNRSwitchStatus
  * @tc.name     Test Cellular Call Config
@@ -1151,10 +1605,12 @@ HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_UpdateImsVoiceCapabilities
     CellularCallConfig config;
     ImsCapabilityList imsCapabilityList;
     int32_t VONR_SWITCH_STATUS_OFF = 0;
-    config.volteSupported_[SIM1_SLOTID] = false;
-    config.imsGbaRequired_[SIM1_SLOTID] = false;
-    config.vonrSwithStatus_[SIM1_SLOTID] = VONR_SWITCH_STATUS_OFF;
-    config.nrModeSupportedList_[SIM1_SLOTID] = {CARRIER_NR_AVAILABILITY_NSA, CARRIER_NR_AVAILABILITY_SA};
+    config.UpdateSlotConfig(SIM1_SLOTID, [VONR_SWITCH_STATUS_OFF](SlotConfig &slotConfig) {
+        slotConfig.volteSupported = false;
+        slotConfig.imsGbaRequired = false;
+        slotConfig.vonrSwitchStatus = VONR_SWITCH_STATUS_OFF;
+        slotConfig.nrModeSupportedList = {CARRIER_NR_AVAILABILITY_NSA, CARRIER_NR_AVAILABILITY_SA};
+    });
     config.UpdateImsVoiceCapabilities(SIM1_SLOTID, imsCapabilityList);
     ASSERT_EQ(imsCapabilityList.imsCapabilities.size(), 1);
 }
@@ -1168,8 +1624,10 @@ HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_UpdateImsVoiceCapabilities
 {
     CellularCallConfig config;
     ImsCapabilityList imsCapabilityList;
-    config.volteSupported_[INVALID_SLOTID] = true;
-    config.imsGbaRequired_[INVALID_SLOTID] = false;
+    config.UpdateSlotConfig(INVALID_SLOTID, [](SlotConfig &slotConfig) {
+        slotConfig.volteSupported = true;
+        slotConfig.imsGbaRequired = false;
+    });
     config.UpdateImsVoiceCapabilities(INVALID_SLOTID, imsCapabilityList);
     ASSERT_EQ(imsCapabilityList.imsCapabilities.size(), 1);
 }
@@ -1186,14 +1644,18 @@ HWTEST_F(ZeroBranchTest, Telephony_CellularCallConfig_UpdateImsVoiceCapabilities
     ImsCapabilityList imsCapabilityList2;
     int32_t VONR_SWITCH_STATUS_OFF = 0;
     int32_t VONR_SWITCH_STATUS_ON = 1;
-    config.volteSupported_[SIM1_SLOTID] = true;
-    config.volteSupported_[SIM2_SLOTID] = true;
-    config.imsGbaRequired_[SIM1_SLOTID] = false;
-    config.imsGbaRequired_[SIM2_SLOTID] = false;
-    config.vonrSwithStatus_[SIM1_SLOTID] = VONR_SWITCH_STATUS_ON;
-    config.vonrSwithStatus_[SIM2_SLOTID] = VONR_SWITCH_STATUS_OFF;
-    config.nrModeSupportedList_[SIM1_SLOTID] = {CARRIER_NR_AVAILABILITY_NSA, CARRIER_NR_AVAILABILITY_SA};
-    config.nrModeSupportedList_[SIM2_SLOTID] = {CARRIER_NR_AVAILABILITY_NSA, CARRIER_NR_AVAILABILITY_SA};
+    config.UpdateSlotConfig(SIM1_SLOTID, [VONR_SWITCH_STATUS_ON](SlotConfig &slotConfig) {
+        slotConfig.volteSupported = true;
+        slotConfig.imsGbaRequired = false;
+        slotConfig.vonrSwitchStatus = VONR_SWITCH_STATUS_ON;
+        slotConfig.nrModeSupportedList = {CARRIER_NR_AVAILABILITY_NSA, CARRIER_NR_AVAILABILITY_SA};
+    });
+    config.UpdateSlotConfig(SIM2_SLOTID, [VONR_SWITCH_STATUS_OFF](SlotConfig &slotConfig) {
+        slotConfig.volteSupported = true;
+        slotConfig.imsGbaRequired = false;
+        slotConfig.vonrSwitchStatus = VONR_SWITCH_STATUS_OFF;
+        slotConfig.nrModeSupportedList = {CARRIER_NR_AVAILABILITY_NSA, CARRIER_NR_AVAILABILITY_SA};
+    });
     config.UpdateImsVoiceCapabilities(SIM1_SLOTID, imsCapabilityList1);
     config.UpdateImsVoiceCapabilities(SIM2_SLOTID, imsCapabilityList2);
     ASSERT_EQ(imsCapabilityList1.imsCapabilities.size(), 2);